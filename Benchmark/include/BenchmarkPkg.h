@@ -0,0 +1,168 @@
+#ifndef BENCHMARKPKG_H
+#define BENCHMARKPKG_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace UtilityLib
+{
+    namespace Benchmark
+    {
+        // Helpers shared by the benchmark programs
+        //
+        // Every measurement runs the function a few times and keeps the fastest run,
+        // which filters out most of the noise from other processes and cold caches
+        // Build in Release, Debug numbers say nothing about the real speed
+
+        // Runs of a measurement by default
+        inline constexpr size_t DEFAULT_REPEAT_COUNT = 5;
+
+        // Written by DoNotOptimize(), never read
+        inline const void* volatile OptimizationSink = nullptr;
+
+        // DoNotOptimize()
+        //
+        // Summary:
+        // Makes the value observable, so the compiler cannot drop the computation that produced it
+        //
+        // Arguments:
+        // const T& value  --- In
+        //
+        // Returns:
+        template<typename T>
+        void DoNotOptimize(const T& value)
+        {
+            OptimizationSink = &value;
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+
+        // MeasureSeconds()
+        //
+        // Summary:
+        // Returns the fastest of repeatCount runs of func, in seconds
+        //
+        // Arguments:
+        // FuncT func           --- In
+        // size_t repeatCount   --- In (default DEFAULT_REPEAT_COUNT)
+        //
+        // Returns:
+        // double
+        template<typename FuncT>
+        double MeasureSeconds(FuncT func, size_t repeatCount = DEFAULT_REPEAT_COUNT)
+        {
+            double best = std::numeric_limits<double>::max();
+            for (size_t i = 0; i < repeatCount; i++)
+            {
+                auto start = std::chrono::steady_clock::now();
+                func();
+                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                best = std::min(best, elapsed.count());
+            }
+
+            return best;
+        }
+
+        // PrintHeader()
+        //
+        // Summary:
+        // Prints the title of a group of results
+        //
+        // Arguments:
+        // std::string_view title  --- In
+        //
+        // Returns:
+        inline void PrintHeader(std::string_view title)
+        {
+            std::printf("\n%.*s\n", static_cast<int>(title.size()), title.data());
+        }
+
+        // PrintThroughput()
+        //
+        // Summary:
+        // Prints time and MB/s of a run that processed byteCount bytes
+        //
+        // Arguments:
+        // std::string_view name  --- In
+        // size_t byteCount       --- In
+        // double seconds         --- In
+        //
+        // Returns:
+        inline void PrintThroughput(std::string_view name, size_t byteCount, double seconds)
+        {
+            std::printf("  %-40.*s %12.3f ms %12.1f MB/s\n", static_cast<int>(name.size()), name.data(),
+                seconds * 1e3, static_cast<double>(byteCount) / seconds / 1e6);
+        }
+
+        // PrintPerItem()
+        //
+        // Summary:
+        // Prints time of a run and the time it took per item
+        //
+        // Arguments:
+        // std::string_view name  --- In
+        // size_t itemCount       --- In
+        // double seconds         --- In
+        //
+        // Returns:
+        inline void PrintPerItem(std::string_view name, size_t itemCount, double seconds)
+        {
+            std::printf("  %-40.*s %12.3f ms %12.1f ns/item\n", static_cast<int>(name.size()), name.data(),
+                seconds * 1e3, seconds * 1e9 / static_cast<double>(itemCount));
+        }
+
+        // MakeLogText()
+        //
+        // Summary:
+        // Returns size bytes of log like lines, the same text for the same arguments
+        //
+        // Arguments:
+        // size_t size    --- In
+        // uint32_t seed  --- In (default 1)
+        //
+        // Returns:
+        // std::string
+        inline std::string MakeLogText(size_t size, uint32_t seed = 1)
+        {
+            static constexpr std::string_view WORD_LIST[] = {
+                "INFO", "WARN", "ERROR", "tftp", "session", "accepted", "client", "192.168.1.20", "port", "69",
+                "octet", "block", "sent", "bytes", "timeout", "retry", "pxe/boot/initrd", "file.bin", "ok", "done" };
+
+            std::string text;
+            text.reserve(size);
+            uint32_t state = seed;
+            size_t lineSize = 0;
+            while (text.size() < size)
+            {
+                // xorshift32, enough to make the lines uneven
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+
+                std::string_view word = WORD_LIST[state % std::size(WORD_LIST)];
+                text.append(word);
+                lineSize += word.size() + 1;
+                if (lineSize > 40 + (state >> 8) % 80)
+                {
+                    text.push_back('\n');
+                    lineSize = 0;
+                }
+                else
+                {
+                    text.push_back(' ');
+                }
+            }
+            text.resize(size);
+
+            return text;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,91 @@
+#include "BenchmarkPkg.h"
+#include "FormatPkg.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+using namespace UtilityLib;
+using namespace UtilityLib::Benchmark;
+
+namespace
+{
+    // Format() and snprintf() must give the same text, checked before timing anything
+    template<String::FixedStringCls Fmt>
+    bool CheckSame(const char* printfFormat, double value)
+    {
+        char formatted[512];
+        char printed[512];
+        size_t size = 0;
+        String::StringError error = String::Format<Fmt>(formatted, size, value);
+        std::snprintf(printed, sizeof(printed), printfFormat, value);
+        if (error != String::StringError::Success || std::strcmp(formatted, printed) != 0)
+        {
+            std::printf("  mismatch for %s: \"%s\" (error %d), snprintf \"%s\"\n", printfFormat, formatted, static_cast<int>(error), printed);
+            return false;
+        }
+
+        return true;
+    }
+
+    // Extremes of every notation, 5e-324 (smallest denormal) once needed a longer buffer than the field had
+    bool CheckFloatingFields()
+    {
+        const double valueList[] = { 5e-324, -5e-324, DBL_MIN, DBL_MAX, -DBL_MAX, 0.0, -123.456, 1e22, INFINITY, -INFINITY, NAN };
+        bool isSame = true;
+        for (double value : valueList)
+        {
+            isSame &= CheckSame<"[{:f}]">("[%f]", value);
+            isSame &= CheckSame<"[{:e}]">("[%e]", value);
+            isSame &= CheckSame<"[{:g}]">("[%g]", value);
+            isSame &= CheckSame<"[{:.64f}]">("[%.64f]", value);
+            isSame &= CheckSame<"[{:.64e}]">("[%.64e]", value);
+            isSame &= CheckSame<"[{:012.3f}]">("[%012.3f]", value);
+        }
+
+        return isSame;
+    }
+}
+
+// Format() against snprintf() on a typical transfer log line
+int main()
+{
+    PrintHeader("floating point fields against snprintf");
+    if (CheckFloatingFields() == false)
+    {
+        return 1;
+    }
+    std::printf("  all equal\n");
+
+    const size_t count = 1000000;
+    PrintHeader("1M log lines into a stack buffer");
+
+    double seconds = MeasureSeconds([&]()
+        {
+            char line[128];
+            for (size_t i = 0; i < count; i++)
+            {
+                DoNotOptimize(std::snprintf(line, sizeof(line), "%s:%u sent %zu bytes (%.1f ms), checksum %#010x",
+                    "192.168.1.20", 69u, i * 512, static_cast<double>(i) * 0.25, static_cast<uint32_t>(i * 2654435761u)));
+            }
+        });
+    PrintPerItem("snprintf", count, seconds);
+
+    seconds = MeasureSeconds([&]()
+        {
+            char line[128];
+            size_t size = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                String::Format<"{}:{} sent {} bytes ({:.1f} ms), checksum {:#010x}">(line, size,
+                    std::string_view("192.168.1.20"), 69u, i * 512, static_cast<double>(i) * 0.25, static_cast<uint32_t>(i * 2654435761u));
+                DoNotOptimize(size);
+            }
+        });
+    PrintPerItem("Format", count, seconds);
+
+    return 0;
+}
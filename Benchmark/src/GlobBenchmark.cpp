@@ -0,0 +1,141 @@
+#include "BenchmarkPkg.h"
+#include "GlobPatternCls.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fnmatch.h>
+#endif
+
+using namespace UtilityLib;
+using namespace UtilityLib::Benchmark;
+
+namespace
+{
+    // Glob to ECMAScript regex, the way the rules were matched before GlobPatternCls
+    // Only covers the syntax used below: '*', '?', '[...]' and literal bytes
+    std::string GlobToRegex(std::string_view pattern)
+    {
+        std::string regex;
+        for (size_t i = 0; i < pattern.size(); i++)
+        {
+            char ch = pattern[i];
+            if (ch == '*')
+            {
+                regex += ".*";
+            }
+            else if (ch == '?')
+            {
+                regex += '.';
+            }
+            else if (ch == '[')
+            {
+                size_t end = pattern.find(']', i + 1);
+                regex += pattern.substr(i, end - i + 1);
+                i = end;
+            }
+            else
+            {
+                if (std::string_view("\\^$.|+()[]{}").find(ch) != std::string_view::npos)
+                {
+                    regex += '\\';
+                }
+                regex += ch;
+            }
+        }
+
+        return regex;
+    }
+
+    std::vector<std::string> MakePathList(size_t count)
+    {
+        static constexpr std::string_view DIRECTORY_LIST[] = { "pxe", "boot", "srv/tftp", "images", "cfg" };
+        static constexpr std::string_view FILE_LIST[] = { "initrd0", "initrd.img", "vmlinuz", "pxelinux.0", "menu.c32",
+            "ldlinux.c32", "firmware.bin", "default", "boot.cfg", "splash.png" };
+
+        std::vector<std::string> pathList;
+        pathList.reserve(count);
+        uint32_t state = 7;
+        for (size_t i = 0; i < count; i++)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            std::string path(DIRECTORY_LIST[state % std::size(DIRECTORY_LIST)]);
+            path += "/host" + std::to_string((state >> 8) % 200) + "/";
+            path += FILE_LIST[(state >> 16) % std::size(FILE_LIST)];
+            pathList.push_back(std::move(path));
+        }
+
+        return pathList;
+    }
+
+    void Run(std::string_view pattern, const std::vector<std::string>& pathList)
+    {
+        const size_t repeatCount = 3;
+        std::string title = "pattern ";
+        title += pattern;
+        PrintHeader(title);
+
+        std::regex regex(GlobToRegex(pattern), std::regex::ECMAScript | std::regex::optimize);
+        size_t regexCount = 0;
+        double seconds = MeasureSeconds([&]()
+            {
+                regexCount = 0;
+                for (const std::string& path : pathList)
+                {
+                    regexCount += std::regex_match(path, regex) ? 1 : 0;
+                }
+            }, repeatCount);
+        PrintPerItem("std::regex_match", pathList.size(), seconds);
+
+#if !defined(_WIN32)
+        std::string patternString(pattern);
+        seconds = MeasureSeconds([&]()
+            {
+                size_t count = 0;
+                for (const std::string& path : pathList)
+                {
+                    count += fnmatch(patternString.c_str(), path.c_str(), 0) == 0 ? 1 : 0;
+                }
+                DoNotOptimize(count);
+            }, repeatCount);
+        PrintPerItem("fnmatch", pathList.size(), seconds);
+#endif
+
+        String::GlobPatternCls glob(pattern);
+        size_t globCount = 0;
+        seconds = MeasureSeconds([&]()
+            {
+                globCount = 0;
+                for (const std::string& path : pathList)
+                {
+                    globCount += glob.Match(path) ? 1 : 0;
+                }
+            }, repeatCount);
+        PrintPerItem("GlobPatternCls::Match", pathList.size(), seconds);
+
+        seconds = MeasureSeconds([&]() { DoNotOptimize(String::FilterMatching(pathList, glob)); }, repeatCount);
+        PrintPerItem("FilterMatching (copies matches)", pathList.size(), seconds);
+
+        std::printf("  matches: regex %zu, glob %zu\n", regexCount, globCount);
+    }
+}
+
+// GlobPatternCls against std::regex (and fnmatch() where it exists)
+int main()
+{
+    const std::vector<std::string> pathList = MakePathList(200000);
+
+    Run("*.bin", pathList);
+    Run("pxe/*/initrd?", pathList);
+    Run("*host1*[0-9]/*.c32", pathList);
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include "BenchmarkPkg.h"
+#include "HashPkg.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <string_view>
+
+using namespace UtilityLib;
+using namespace UtilityLib::Benchmark;
+
+namespace
+{
+    // CRC32 (IEEE) one byte per table lookup, the usual code found in most projects
+    uint32_t Crc32Bytewise(std::string_view data)
+    {
+        static const std::array<uint32_t, 256> TABLE = []()
+            {
+                std::array<uint32_t, 256> table = {};
+                for (uint32_t i = 0; i < 256; i++)
+                {
+                    uint32_t crc = i;
+                    for (int bit = 0; bit < 8; bit++)
+                    {
+                        crc = (crc >> 1) ^ ((crc & 1) != 0 ? 0xEDB88320u : 0);
+                    }
+                    table[i] = crc;
+                }
+                return table;
+            }();
+
+        uint32_t crc = 0xFFFFFFFFu;
+        for (unsigned char byte : data)
+        {
+            crc = (crc >> 8) ^ TABLE[(crc ^ byte) & 0xFF];
+        }
+
+        return crc ^ 0xFFFFFFFFu;
+    }
+
+    // Hash64StreamCls fed with pieces of pieceSize bytes, like blocks read from a file or a socket
+    uint64_t Hash64Stream(std::string_view data, size_t pieceSize)
+    {
+        String::Hash64StreamCls stream;
+        for (size_t offset = 0; offset < data.size(); offset += pieceSize)
+        {
+            stream.Update(data.substr(offset, pieceSize));
+        }
+
+        return stream.Finish();
+    }
+
+    // Hashes every key once, reports time per key
+    template<typename FuncT>
+    void RunKeys(std::string_view name, const std::string& text, size_t keySize, FuncT func)
+    {
+        const size_t keyCount = text.size() / keySize;
+        double seconds = MeasureSeconds([&]()
+            {
+                uint64_t sum = 0;
+                for (size_t i = 0; i < keyCount; i++)
+                {
+                    sum += func(std::string_view(text).substr(i * keySize, keySize));
+                }
+                DoNotOptimize(sum);
+            });
+        PrintPerItem(name, keyCount, seconds);
+    }
+}
+
+// HashPkg throughput on a large buffer and on short keys, against std::hash and a bytewise CRC32
+// Optional argument: buffer size in MB (default 256)
+int main(int argc, char* argv[])
+{
+    const size_t size = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256) * 1024 * 1024;
+    const std::string text = MakeLogText(size);
+    const std::string_view data = text;
+
+    PrintHeader(std::to_string(size / (1024 * 1024)) + " MB buffer");
+
+    double seconds = MeasureSeconds([&]() { DoNotOptimize(std::hash<std::string_view>()(data)); });
+    PrintThroughput("std::hash<std::string_view>", size, seconds);
+    seconds = MeasureSeconds([&]() { DoNotOptimize(String::Hash64(data)); });
+    PrintThroughput("Hash64", size, seconds);
+    seconds = MeasureSeconds([&]() { DoNotOptimize(Hash64Stream(data, 64 * 1024)); });
+    PrintThroughput("Hash64StreamCls, 64 KB pieces", size, seconds);
+    seconds = MeasureSeconds([&]() { DoNotOptimize(Hash64Stream(data, 1500)); });
+    PrintThroughput("Hash64StreamCls, 1500 byte pieces", size, seconds);
+
+    seconds = MeasureSeconds([&]() { DoNotOptimize(Crc32Bytewise(data)); });
+    PrintThroughput("bytewise table CRC32", size, seconds);
+    seconds = MeasureSeconds([&]() { DoNotOptimize(String::Crc32(data)); });
+    PrintThroughput("Crc32", size, seconds);
+    seconds = MeasureSeconds([&]() { DoNotOptimize(String::Crc32c(data)); });
+    PrintThroughput("Crc32c", size, seconds);
+
+    // Cache keys are short, the setup and finalization cost counts there
+    for (size_t keySize : { 16, 64, 256 })
+    {
+        const std::string keyText = MakeLogText(keySize * 100000, 7);
+        PrintHeader("100000 keys of " + std::to_string(keySize) + " bytes");
+        RunKeys("std::hash<std::string_view>", keyText, keySize, [](std::string_view key) { return std::hash<std::string_view>()(key); });
+        RunKeys("Hash64", keyText, keySize, [](std::string_view key) { return String::Hash64(key); });
+        RunKeys("Crc32c", keyText, keySize, [](std::string_view key) { return String::Crc32c(key); });
+    }
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "BenchmarkPkg.h"
+#include "NumberPkg.h"
+#include "StringPkg.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace UtilityLib;
+using namespace UtilityLib::Benchmark;
+
+namespace
+{
+    // IntegralToString() as it was before NumberPkg, one insert at begin() per digit
+    template<typename T>
+    std::string InsertIntegralToString(T val)
+    {
+        std::string result;
+        while (val > 0)
+        {
+            result.insert(result.begin(), static_cast<char>(val % 10 + '0'));
+            val /= 10;
+        }
+
+        return result;
+    }
+
+    std::vector<uint64_t> MakeIntegralList(size_t count)
+    {
+        std::vector<uint64_t> valueList(count);
+        uint64_t state = 88172645463325252ull;
+        for (uint64_t& value : valueList)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            // Mix of short and long numbers, like ports, sizes and counters
+            value = state >> (state % 60);
+        }
+
+        return valueList;
+    }
+
+    std::vector<double> MakeFloatingList(size_t count)
+    {
+        std::vector<double> valueList(count);
+        uint64_t state = 2463534242ull;
+        for (double& value : valueList)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            value = static_cast<double>(state % 1000000007ull) / static_cast<double>(1 + state % 1000);
+        }
+
+        return valueList;
+    }
+}
+
+// NumberPkg against the insert based IntegralToString() it replaced, std::to_string() and snprintf()
+int main()
+{
+    const size_t count = 1000000;
+    const std::vector<uint64_t> integralList = MakeIntegralList(count);
+    const std::vector<double> floatingList = MakeFloatingList(count);
+
+    PrintHeader("1M uint64_t values to text");
+
+    double seconds = MeasureSeconds([&]()
+        {
+            for (uint64_t value : integralList)
+            {
+                DoNotOptimize(InsertIntegralToString(value));
+            }
+        });
+    PrintPerItem("old IntegralToString (insert)", count, seconds);
+
+    seconds = MeasureSeconds([&]()
+        {
+            for (uint64_t value : integralList)
+            {
+                DoNotOptimize(std::to_string(value));
+            }
+        });
+    PrintPerItem("std::to_string", count, seconds);
+
+    seconds = MeasureSeconds([&]()
+        {
+            char buffer[32];
+            for (uint64_t value : integralList)
+            {
+                DoNotOptimize(std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value)));
+            }
+        });
+    PrintPerItem("snprintf into buffer", count, seconds);
+
+    seconds = MeasureSeconds([&]()
+        {
+            for (uint64_t value : integralList)
+            {
+                DoNotOptimize(String::IntegralToString(value));
+            }
+        });
+    PrintPerItem("IntegralToString", count, seconds);
+
+    seconds = MeasureSeconds([&]()
+        {
+            char buffer[String::MAX_INTEGRAL_CHARS<uint64_t>];
+            for (uint64_t value : integralList)
+            {
+                DoNotOptimize(String::FormatIntegral(value, buffer));
+            }
+        });
+    PrintPerItem("FormatIntegral into buffer", count, seconds);
+
+    PrintHeader("1M double values to shortest round trip text");
+
+    seconds = MeasureSeconds([&]()
+        {
+            char buffer[32];
+            for (double value : floatingList)
+            {
+                DoNotOptimize(std::snprintf(buffer, sizeof(buffer), "%.17g", value));
+            }
+        });
+    PrintPerItem("snprintf(\"%.17g\") into buffer", count, seconds);
+
+    seconds = MeasureSeconds([&]()
+        {
+            for (double value : floatingList)
+            {
+                DoNotOptimize(String::FloatingToString(value));
+            }
+        });
+    PrintPerItem("FloatingToString", count, seconds);
+
+    seconds = MeasureSeconds([&]()
+        {
+            char buffer[String::MAX_FLOATING_CHARS];
+            for (double value : floatingList)
+            {
+                DoNotOptimize(String::FormatFloating(value, buffer));
+            }
+        });
+    PrintPerItem("FormatFloating into buffer", count, seconds);
+
+    return 0;
+}
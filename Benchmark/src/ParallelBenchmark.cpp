@@ -0,0 +1,114 @@
+#include "BenchmarkPkg.h"
+#include "ParallelPkg.h"
+#include "StringPkg.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace UtilityLib;
+using namespace UtilityLib::Benchmark;
+
+namespace
+{
+    std::vector<std::string> MakeLineList(size_t count)
+    {
+        // Lines are 40 to 120 bytes, 128 bytes per line is always enough text
+        const std::string text = MakeLogText(count * 128);
+        std::vector<std::string> lineList = String::Divide(text, '\n');
+        if (lineList.size() > count)
+        {
+            lineList.resize(count);
+        }
+
+        return lineList;
+    }
+
+    // 1, 2, 4, ... up to maxThreadCount, and maxThreadCount itself
+    std::vector<size_t> MakeThreadCountList(size_t maxThreadCount)
+    {
+        std::vector<size_t> threadCountList;
+        for (size_t threadCount = 1; threadCount < maxThreadCount; threadCount *= 2)
+        {
+            threadCountList.push_back(threadCount);
+        }
+        threadCountList.push_back(maxThreadCount);
+
+        return threadCountList;
+    }
+
+    // Prints time per line of every thread count, and the speedup over the sequential version
+    template<typename FuncT>
+    void Run(std::string_view title, const std::vector<size_t>& threadCountList, size_t lineCount, double sequentialSeconds, FuncT func)
+    {
+        PrintHeader(title);
+        PrintPerItem("sequential", lineCount, sequentialSeconds);
+
+        for (size_t threadCount : threadCountList)
+        {
+            const String::ParallelOptionStc option = { threadCount, 0 };
+            double seconds = MeasureSeconds([&]() { func(option); });
+
+            std::string name = std::to_string(threadCount) + (threadCount == 1 ? " thread" : " threads");
+            std::printf("  %-40s %12.3f ms %12.1f ns/item %8.2fx\n", name.c_str(), seconds * 1e3,
+                seconds * 1e9 / static_cast<double>(lineCount), sequentialSeconds / seconds);
+        }
+    }
+}
+
+// ParallelPkg from 1 thread up to the number of cores, against the sequential StringPkg functions
+// Optional arguments: line count (default 2M), highest thread count (default hardware_concurrency())
+int main(int argc, char* argv[])
+{
+    const size_t lineCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    size_t maxThreadCount = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::thread::hardware_concurrency();
+    if (maxThreadCount == 0)
+    {
+        maxThreadCount = 1;
+    }
+
+    const std::vector<std::string> lineList = MakeLineList(lineCount);
+    const std::vector<size_t> threadCountList = MakeThreadCountList(maxThreadCount);
+    const std::string keyword = "timeout";
+    std::printf("%zu lines, up to %zu threads\n", lineList.size(), maxThreadCount);
+
+    double seconds = MeasureSeconds([&]() { DoNotOptimize(String::Filter(lineList, keyword)); });
+    Run("Filter", threadCountList, lineList.size(), seconds,
+        [&](const String::ParallelOptionStc& option) { DoNotOptimize(String::Filter(lineList, keyword, option)); });
+
+    seconds = MeasureSeconds([&]()
+        {
+            size_t count = 0;
+            for (const std::string& line : lineList)
+            {
+                count += line.find(keyword) != std::string::npos ? 1 : 0;
+            }
+            DoNotOptimize(count);
+        });
+    Run("Count", threadCountList, lineList.size(), seconds,
+        [&](const String::ParallelOptionStc& option) { DoNotOptimize(String::Count(lineList, keyword, option)); });
+
+    const std::string delimiter = "\n";
+    seconds = MeasureSeconds([&]() { DoNotOptimize(String::Join(lineList, delimiter)); });
+    Run("Join", threadCountList, lineList.size(), seconds,
+        [&](const String::ParallelOptionStc& option) { DoNotOptimize(String::Join(lineList, delimiter, option)); });
+
+    auto trimLower = [](const std::string& line) { return String::ToLower(String::Trim(line)); };
+    seconds = MeasureSeconds([&]()
+        {
+            std::vector<std::string> resultList;
+            resultList.reserve(lineList.size());
+            for (const std::string& line : lineList)
+            {
+                resultList.push_back(trimLower(line));
+            }
+            DoNotOptimize(resultList);
+        });
+    Run("Transform, Trim + ToLower", threadCountList, lineList.size(), seconds,
+        [&](const String::ParallelOptionStc& option) { DoNotOptimize(String::Transform(lineList, trimLower, option)); });
+
+    return 0;
+}
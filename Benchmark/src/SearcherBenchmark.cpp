@@ -0,0 +1,91 @@
+#include "BenchmarkPkg.h"
+#include "SearcherCls.h"
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <string_view>
+
+using namespace UtilityLib;
+using namespace UtilityLib::Benchmark;
+
+namespace
+{
+    // Every search counts all non overlapping occurrences, so the whole haystack is scanned
+    size_t CountWithFind(const std::string& haystack, const std::string& needle)
+    {
+        size_t count = 0;
+        for (size_t pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + needle.size()))
+        {
+            count++;
+        }
+
+        return count;
+    }
+
+    size_t CountWithHorspool(const std::string& haystack, const std::string& needle)
+    {
+        std::boyer_moore_horspool_searcher searcher(needle.begin(), needle.end());
+        size_t count = 0;
+        auto it = haystack.begin();
+        while (true)
+        {
+            it = std::search(it, haystack.end(), searcher);
+            if (it == haystack.end())
+            {
+                break;
+            }
+            count++;
+            it += static_cast<std::ptrdiff_t>(needle.size());
+        }
+
+        return count;
+    }
+
+    size_t CountWithSearcher(const std::string& haystack, const String::SearcherCls& searcher)
+    {
+        size_t count = 0;
+        size_t needleSize = searcher.GetNeedle().size();
+        for (size_t pos = searcher.Find(haystack); pos != std::string_view::npos; pos = searcher.Find(haystack, pos + needleSize))
+        {
+            count++;
+        }
+
+        return count;
+    }
+
+    void Run(std::string_view title, const std::string& haystack, const std::string& needle)
+    {
+        const size_t repeatCount = 5;
+        String::SearcherCls searcher(needle);
+
+        PrintHeader(title);
+
+        double seconds = MeasureSeconds([&]() { DoNotOptimize(CountWithFind(haystack, needle)); }, repeatCount);
+        PrintThroughput("std::string::find", haystack.size(), seconds);
+
+        seconds = MeasureSeconds([&]() { DoNotOptimize(CountWithHorspool(haystack, needle)); }, repeatCount);
+        PrintThroughput("std::boyer_moore_horspool_searcher", haystack.size(), seconds);
+
+        seconds = MeasureSeconds([&]() { DoNotOptimize(CountWithSearcher(haystack, searcher)); }, repeatCount);
+        PrintThroughput("SearcherCls (compiled once)", haystack.size(), seconds);
+    }
+}
+
+// SearcherCls against std::string::find and std::boyer_moore_horspool_searcher
+int main()
+{
+    const size_t size = 64 * 1024 * 1024;
+    const std::string text = MakeLogText(size);
+
+    Run("64 MB of log lines, 1 byte needle", text, "/");
+    Run("64 MB of log lines, 7 byte needle", text, "timeout");
+    Run("64 MB of log lines, 24 byte needle", text, "session accepted client ");
+    Run("64 MB of log lines, 64 byte needle (no match)", text, std::string(63, 'x') + "y");
+
+    // Repetitive input, every position is a partial match
+    Run("64 MB of 'a', needle a...ab (16 bytes)", std::string(size, 'a'), std::string(15, 'a') + "b");
+    Run("64 MB of 'a', needle a...ab (256 bytes)", std::string(size, 'a'), std::string(255, 'a') + "b");
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include "BenchmarkPkg.h"
+#include "SplitViewCls.h"
+#include "StringPkg.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace UtilityLib;
+using namespace UtilityLib::Benchmark;
+
+namespace
+{
+    // Divide() as it was before SplitViewCls, one std::string allocated per token through substr()
+    std::vector<std::string> DivideBySubstr(const std::string& str, char ch)
+    {
+        std::vector<std::string> strList;
+        size_t startIdx = 0;
+        for (size_t i = 0; i < str.size(); i++)
+        {
+            if (str[i] == ch)
+            {
+                if (i != startIdx)
+                {
+                    strList.push_back(str.substr(startIdx, i - startIdx));
+                }
+                startIdx = i + 1;
+            }
+        }
+        if (startIdx < str.size())
+        {
+            strList.push_back(str.substr(startIdx));
+        }
+
+        return strList;
+    }
+
+    void RunSize(std::string_view title, size_t size)
+    {
+        const std::string text = MakeLogText(size);
+        const size_t repeatCount = size < 1024 * 1024 ? 2000 : (size < 64 * 1024 * 1024 ? 20 : 3);
+
+        PrintHeader(title);
+
+        double seconds = MeasureSeconds([&]() { DoNotOptimize(DivideBySubstr(text, '\n')); }, repeatCount);
+        PrintThroughput("old Divide (substr per token)", text.size(), seconds);
+
+        seconds = MeasureSeconds([&]() { DoNotOptimize(String::Divide(text, '\n')); }, repeatCount);
+        PrintThroughput("Divide(str, '\\n')", text.size(), seconds);
+
+        seconds = MeasureSeconds([&]() { DoNotOptimize(String::Divide(text, std::string("\n"))); }, repeatCount);
+        PrintThroughput("Divide(str, \"\\n\")", text.size(), seconds);
+
+        seconds = MeasureSeconds([&]()
+            {
+                size_t tokenSize = 0;
+                for (std::string_view token : String::SplitViewCls(text, '\n'))
+                {
+                    tokenSize += token.size();
+                }
+                DoNotOptimize(tokenSize);
+            }, repeatCount);
+        PrintThroughput("SplitViewCls(str, '\\n')", text.size(), seconds);
+    }
+}
+
+// Divide() and SplitViewCls against the substr per token Divide() they replaced
+int main()
+{
+    RunSize("1 KB of log lines", 1024);
+    RunSize("1 MB of log lines", 1024 * 1024);
+    RunSize("100 MB of log lines", 100 * 1024 * 1024);
+
+    return 0;
+}
@@ -0,0 +1,214 @@
+#include "BenchmarkPkg.h"
+#include "InlineStringCls.h"
+#include "IpAddressCls.h"
+#include "StringBuilderCls.h"
+#include "StringPkg.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace UtilityLib;
+using namespace UtilityLib::Benchmark;
+
+// Every heap allocation of the program is counted, the operators below replace the global ones
+static size_t AllocationCount = 0;
+
+void* operator new(size_t size)
+{
+    AllocationCount++;
+    if (void* ptr = std::malloc(size != 0 ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    AllocationCount++;
+    size_t align = static_cast<size_t>(alignment);
+#if defined(_MSC_VER)
+    void* ptr = _aligned_malloc(size != 0 ? size : 1, align);
+#else
+    void* ptr = std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+#if defined(_MSC_VER)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept
+{
+    operator delete(ptr, alignment);
+}
+
+namespace
+{
+    // Functions as they were before StringBuilderCls (ReplaceAll without its extra dstSubstr at the end)
+    std::string OldJoin(const std::vector<std::string>& stringList, const std::string& delimiter)
+    {
+        std::string result;
+        for (size_t i = 0; i < stringList.size(); i++)
+        {
+            result += stringList.at(i);
+            if (i != stringList.size() - 1)
+            {
+                result += delimiter;
+            }
+        }
+
+        return result;
+    }
+
+    std::string OldReplaceAll(const std::string& str, const std::string& srcSubstr, const std::string& dstSubstr)
+    {
+        std::string result = "";
+        size_t startIndex = 0;
+        size_t endIndex = str.find(srcSubstr);
+        while (endIndex != std::string::npos)
+        {
+            result += str.substr(startIndex, endIndex - startIndex);
+            result += dstSubstr;
+            startIndex = endIndex + srcSubstr.size();
+            endIndex = str.find(srcSubstr, startIndex);
+        }
+        result += str.substr(startIndex);
+
+        return result;
+    }
+
+    std::string OldRemoveSubstring(const std::string& str, const std::string& substr)
+    {
+        std::string result = "";
+        size_t startIndex = 0;
+        size_t substrStartIndex = str.find(substr);
+        if (substrStartIndex == std::string::npos)
+        {
+            return str;
+        }
+
+        while (substrStartIndex != std::string::npos)
+        {
+            result += str.substr(startIndex, substrStartIndex - startIndex);
+            startIndex = substrStartIndex + substr.size();
+            substrStartIndex = str.find(substr, startIndex);
+        }
+        result += str.substr(startIndex);
+
+        return result;
+    }
+
+    std::string OldIntegralToString(uint8_t val)
+    {
+        std::string result;
+        while (val > 0)
+        {
+            result.insert(result.begin(), static_cast<char>(val % 10 + '0'));
+            val /= 10;
+        }
+
+        return result;
+    }
+
+    // SockaddrInToString() before: four strings joined with '.'
+    std::string OldAddressToString(const uint8_t* bytes)
+    {
+        std::vector<std::string> ipBlocks;
+        for (size_t i = 0; i < 4; i++)
+        {
+            ipBlocks.push_back(OldIntegralToString(bytes[i]));
+        }
+
+        return OldJoin(ipBlocks, ".");
+    }
+
+    // SockaddrInToString() now: IpAddressCls formats into a stack buffer, the result is an inline string
+    String::InlineStringCls<15> AddressToString(const uint8_t* bytes)
+    {
+        char buffer[String::MAX_IP_ADDRESS_CHARS];
+        size_t size = String::IpAddressCls::FromV4Bytes(bytes).Format(buffer);
+        return String::InlineStringCls<15>(std::string_view(buffer, size));
+    }
+
+    // Prints allocations of a single call and the time per call
+    template<typename FuncT>
+    void Run(std::string_view name, size_t callCount, FuncT func)
+    {
+        size_t startCount = AllocationCount;
+        func();
+        size_t allocationCount = AllocationCount - startCount;
+
+        double seconds = MeasureSeconds([&]()
+            {
+                for (size_t i = 0; i < callCount; i++)
+                {
+                    func();
+                }
+            });
+        std::printf("  %-40.*s %8zu allocations %12.1f ns/call\n", static_cast<int>(name.size()), name.data(),
+            allocationCount, seconds * 1e9 / static_cast<double>(callCount));
+    }
+}
+
+// Allocation counts of the StringBuilderCls based functions against the += based ones they replaced
+int main()
+{
+    std::vector<std::string> stringList;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        stringList.push_back("line " + std::to_string(i * 7919) + " of the transfer log");
+    }
+
+    // Every match grows the result, so the += version reallocates again and again
+    std::string manyMatches;
+    for (size_t i = 0; i < 2000; i++)
+    {
+        manyMatches += "/srv/tftp/pxe/boot/file\t";
+    }
+    const std::string oneMatch = "/srv/tftp/pxe/boot/initrd.img";
+    const std::string removeText = MakeLogText(64 * 1024);
+    const uint8_t address[4] = { 192, 168, 100, 254 };
+
+    PrintHeader("Join, 1000 strings");
+    Run("old Join (+=, at())", 1000, [&]() { DoNotOptimize(OldJoin(stringList, ", ")); });
+    Run("Join", 1000, [&]() { DoNotOptimize(String::Join(stringList, std::string(", "))); });
+
+    PrintHeader("ReplaceAll, 2000 matches that grow the string");
+    Run("old ReplaceAll (substr, +=)", 1000, [&]() { DoNotOptimize(OldReplaceAll(manyMatches, "\t", "    ")); });
+    Run("ReplaceAll", 1000, [&]() { DoNotOptimize(String::ReplaceAll(manyMatches, "\t", "    ")); });
+
+    PrintHeader("ReplaceAll, 1 match");
+    Run("old ReplaceAll (substr, +=)", 100000, [&]() { DoNotOptimize(OldReplaceAll(oneMatch, "pxe", "ipxe")); });
+    Run("ReplaceAll", 100000, [&]() { DoNotOptimize(String::ReplaceAll(oneMatch, "pxe", "ipxe")); });
+
+    PrintHeader("RemoveSubstring, 64 KB of log lines");
+    Run("old RemoveSubstring (substr, +=)", 1000, [&]() { DoNotOptimize(OldRemoveSubstring(removeText, "session ")); });
+    Run("RemoveSubstring", 1000, [&]() { DoNotOptimize(String::RemoveSubstring(removeText, "session ")); });
+
+    PrintHeader("SockaddrInToString body, 192.168.100.254");
+    Run("old (4 IntegralToString + Join)", 100000, [&]() { DoNotOptimize(OldAddressToString(address)); });
+    Run("IpAddressCls::Format into inline string", 100000, [&]() { DoNotOptimize(AddressToString(address)); });
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+#include "BenchmarkPkg.h"
+#include "Utf8Pkg.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+using namespace UtilityLib;
+using namespace UtilityLib::Benchmark;
+
+namespace
+{
+    // Naive decoder: one code point at a time, every byte is looked at with branches
+    // Returns the number of bytes of the sequence at pos, 0 if it is invalid
+    size_t DecodeNaive(std::string_view str, size_t pos, char32_t& codePoint)
+    {
+        unsigned char lead = static_cast<unsigned char>(str[pos]);
+        size_t size = 0;
+        char32_t minimum = 0;
+
+        if (lead < 0x80)
+        {
+            codePoint = lead;
+            return 1;
+        }
+        else if ((lead & 0xE0) == 0xC0)
+        {
+            size = 2;
+            minimum = 0x80;
+            codePoint = lead & 0x1F;
+        }
+        else if ((lead & 0xF0) == 0xE0)
+        {
+            size = 3;
+            minimum = 0x800;
+            codePoint = lead & 0x0F;
+        }
+        else if ((lead & 0xF8) == 0xF0)
+        {
+            size = 4;
+            minimum = 0x10000;
+            codePoint = lead & 0x07;
+        }
+        else
+        {
+            return 0;
+        }
+
+        if (str.size() - pos < size)
+        {
+            return 0;
+        }
+        for (size_t i = 1; i < size; i++)
+        {
+            unsigned char next = static_cast<unsigned char>(str[pos + i]);
+            if ((next & 0xC0) != 0x80)
+            {
+                return 0;
+            }
+            codePoint = (codePoint << 6) | (next & 0x3F);
+        }
+        if (codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+        {
+            return 0;
+        }
+
+        return size;
+    }
+
+    bool ValidateNaive(std::string_view str)
+    {
+        char32_t codePoint = 0;
+        for (size_t pos = 0; pos < str.size();)
+        {
+            size_t size = DecodeNaive(str, pos, codePoint);
+            if (size == 0)
+            {
+                return false;
+            }
+            pos += size;
+        }
+
+        return true;
+    }
+
+    size_t CountNaive(std::string_view str)
+    {
+        char32_t codePoint = 0;
+        size_t count = 0;
+        for (size_t pos = 0; pos < str.size(); count++)
+        {
+            size_t size = DecodeNaive(str, pos, codePoint);
+            pos += size != 0 ? size : 1;
+        }
+
+        return count;
+    }
+
+    bool ToUtf16Naive(std::string_view str, std::u16string& out)
+    {
+        out.clear();
+        char32_t codePoint = 0;
+        for (size_t pos = 0; pos < str.size();)
+        {
+            size_t size = DecodeNaive(str, pos, codePoint);
+            if (size == 0)
+            {
+                out.clear();
+                return false;
+            }
+            if (codePoint < 0x10000)
+            {
+                out.push_back(static_cast<char16_t>(codePoint));
+            }
+            else
+            {
+                codePoint -= 0x10000;
+                out.push_back(static_cast<char16_t>(0xD800 + (codePoint >> 10)));
+                out.push_back(static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF)));
+            }
+            pos += size;
+        }
+
+        return true;
+    }
+
+    // Log text where every fifth word is Cyrillic (2 byte sequences), with an occasional emoji (4 bytes)
+    std::string MakeMixedText(size_t size)
+    {
+        const std::string ascii = MakeLogText(size);
+        std::string text;
+        text.reserve(size + 64);
+        size_t wordIndex = 0;
+        for (size_t i = 0; i < ascii.size() && text.size() < size; i++)
+        {
+            if (ascii[i] == ' ' && ++wordIndex % 5 == 0)
+            {
+                text.append(wordIndex % 100 == 0 ? " \xF0\x9F\x93\xA6 " : " \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 ");
+                continue;
+            }
+            text.push_back(ascii[i]);
+        }
+
+        // Cut at a character boundary so the text stays valid
+        while (text.empty() == false && (static_cast<unsigned char>(text.back()) & 0x80) != 0)
+        {
+            text.pop_back();
+        }
+
+        return text;
+    }
+
+    void Run(std::string_view title, const std::string& text)
+    {
+        PrintHeader(title);
+
+        double seconds = MeasureSeconds([&]() { DoNotOptimize(ValidateNaive(text)); });
+        PrintThroughput("naive validate", text.size(), seconds);
+        seconds = MeasureSeconds([&]() { DoNotOptimize(String::ValidateUtf8(text)); });
+        PrintThroughput("ValidateUtf8", text.size(), seconds);
+
+        seconds = MeasureSeconds([&]() { DoNotOptimize(CountNaive(text)); });
+        PrintThroughput("naive count", text.size(), seconds);
+        seconds = MeasureSeconds([&]() { DoNotOptimize(String::CountUtf8CodePoints(text)); });
+        PrintThroughput("CountUtf8CodePoints", text.size(), seconds);
+
+        std::u16string utf16;
+        utf16.reserve(text.size());
+        seconds = MeasureSeconds([&]() { DoNotOptimize(ToUtf16Naive(text, utf16)); });
+        PrintThroughput("naive UTF-8 to UTF-16", text.size(), seconds);
+        seconds = MeasureSeconds([&]() { DoNotOptimize(String::Utf8ToUtf16(text, utf16)); });
+        PrintThroughput("Utf8ToUtf16", text.size(), seconds);
+
+        std::string lower(text.size(), '\0');
+        seconds = MeasureSeconds([&]()
+            {
+                String::ToLowerUtf8(text, lower.data());
+                DoNotOptimize(lower);
+            });
+        PrintThroughput("ToLowerUtf8", text.size(), seconds);
+    }
+}
+
+// Utf8Pkg against a naive one code point at a time decoder
+int main()
+{
+    const size_t size = 64 * 1024 * 1024;
+
+    Run("64 MB of log text, every fifth word Cyrillic", MakeMixedText(size));
+    Run("64 MB of ASCII log text", MakeLogText(size));
+
+    return 0;
+}
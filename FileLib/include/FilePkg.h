@@ -4,12 +4,16 @@
 #include <fstream>
 #include <string>
 
+#include "HashPkg.h"
 #include "StringPkg.h"
 
 namespace UtilityLib
 {
     namespace FileIO
     {
+        // Bytes read at once by the checksum functions
+        inline constexpr size_t FILE_BLOCK_SIZE = 256 * 1024;
+
         enum class FileMode
         {
             WriteBinary = std::ios::out | std::ios::binary,
@@ -177,6 +181,49 @@ namespace UtilityLib
         // Create a std::ofstream object with flags using FileMode enum, and pass it to this function
         // After writing all the data, close the file using std::ofstream::close()
         bool WriteToFile(std::ofstream& fileStream, const std::string& content);
+
+        // GetFileHash64()
+        // 
+        // Summary:
+        // Computes UtilityLib::String::Hash64() of the file content
+        // 
+        // Arguments:
+        // const std::string& filePath  --- In
+        // uint64_t& hash               --- Out
+        // uint64_t seed                --- In (default 0)
+        // 
+        // Returns:
+        // bool
+        // 
+        // Important: File is read in blocks of FILE_BLOCK_SIZE bytes, it is never loaded entirely
+        // Result is the same as Hash64(ReadFromFile(filePath), seed)
+        bool GetFileHash64(const std::string& filePath, uint64_t& hash, uint64_t seed = 0);
+
+        // GetFileCrc32c()
+        // 
+        // Summary:
+        // Computes UtilityLib::String::Crc32c() of the file content, read in blocks as above
+        // 
+        // Arguments:
+        // const std::string& filePath  --- In
+        // uint32_t& crc                --- Out
+        // 
+        // Returns:
+        // bool
+        bool GetFileCrc32c(const std::string& filePath, uint32_t& crc);
+
+        // GetFileCrc32()
+        // 
+        // Summary:
+        // Computes UtilityLib::String::Crc32() of the file content, read in blocks as above
+        // 
+        // Arguments:
+        // const std::string& filePath  --- In
+        // uint32_t& crc                --- Out
+        // 
+        // Returns:
+        // bool
+        bool GetFileCrc32(const std::string& filePath, uint32_t& crc);
     };
 };
 
@@ -124,5 +124,60 @@ namespace UtilityLib
             }
             return false;
         }
+
+        // Passes the file content to "consume" block by block, returns false if the file cannot be opened or read
+        template <typename ConsumeFunc>
+        static bool ReadFileInBlocks(const std::string& filePath, ConsumeFunc consume)
+        {
+            std::ifstream file(filePath, static_cast<std::ios::openmode>(FileMode::ReadBinary));
+            if (!file)
+            {
+                return false;
+            }
+
+            std::string block(FILE_BLOCK_SIZE, '\0');
+            while (file.read(&block[0], static_cast<std::streamsize>(block.size())) || file.gcount() > 0)
+            {
+                consume(std::string_view(block.data(), static_cast<size_t>(file.gcount())));
+            }
+
+            return file.eof();
+        }
+
+        bool GetFileHash64(const std::string& filePath, uint64_t& hash, uint64_t seed)
+        {
+            UtilityLib::String::Hash64StreamCls stream(seed);
+            if (ReadFileInBlocks(filePath, [&](std::string_view block) { stream.Update(block); }) == false)
+            {
+                return false;
+            }
+
+            hash = stream.Finish();
+            return true;
+        }
+
+        bool GetFileCrc32c(const std::string& filePath, uint32_t& crc)
+        {
+            uint32_t result = 0;
+            if (ReadFileInBlocks(filePath, [&](std::string_view block) { result = UtilityLib::String::Crc32c(block, result); }) == false)
+            {
+                return false;
+            }
+
+            crc = result;
+            return true;
+        }
+
+        bool GetFileCrc32(const std::string& filePath, uint32_t& crc)
+        {
+            uint32_t result = 0;
+            if (ReadFileInBlocks(filePath, [&](std::string_view block) { result = UtilityLib::String::Crc32(block, result); }) == false)
+            {
+                return false;
+            }
+
+            crc = result;
+            return true;
+        }
     };
 };
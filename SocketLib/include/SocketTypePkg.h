@@ -8,14 +8,28 @@
 #include <WinSock2.h>
 #include <ws2tcpip.h>
 
+#include <cstring>
 #include <string>
 
+#include "EndpointCls.h"
+#include "InlineStringCls.h"
+#include "IpAddressCls.h"
+#include "NumberPkg.h"
 #include "StringPkg.h"
 
 namespace UtilityLib
 {
     namespace Socket
     {
+        // Storage for endpoint strings, "255.255.255.255" and "65535" at most
+        // They live inside the socket objects and never allocate
+        using IpAddressString = UtilityLib::String::InlineStringCls<15>;
+        using PortString = UtilityLib::String::InlineStringCls<5>;
+
+        // Binary address types, parsed and validated once, then written into sockaddr_in without any parsing
+        using IpAddressCls = UtilityLib::String::IpAddressCls;
+        using EndpointCls = UtilityLib::String::EndpointCls;
+
         enum class BlockingMode
         {
             Blocking = 0,
@@ -50,44 +64,39 @@ namespace UtilityLib
         }
 
         // Internal function, do not use this directly unless you really need to
-        // Inputs are assumed as valid port and ip address
-        // Do not pass invalid port or ip address, result will be unpredictable
-        inline sockaddr_in StringToSockaddrIn(const std::string& port, const std::string& ipAddress = "")
+        // Endpoint must hold an IPv4 address, sockets of this library are AF_INET
+        inline sockaddr_in EndpointToSockaddrIn(const EndpointCls& endpoint)
         {
             sockaddr_in addr{ 0 };
 
             addr.sin_family = AF_INET;
-            
-            UtilityLib::String::StringToIntegral<USHORT>(port, addr.sin_port);
-            addr.sin_port = htons(addr.sin_port);
+            addr.sin_port = htons(endpoint.GetPort());
+            memcpy(&addr.sin_addr, endpoint.GetAddress().GetBytes(), 4);
 
-            if (ipAddress == "")
-            {
-                addr.sin_addr.S_un.S_addr = INADDR_ANY;
-            }
-            else
-            {
-                auto ipBlocks = UtilityLib::String::Divide(ipAddress, '.');
-                UCHAR ipBlock[4]{};
-                UtilityLib::String::StringToIntegral<UCHAR>(ipBlocks.at(0), ipBlock[0]);
-                UtilityLib::String::StringToIntegral<UCHAR>(ipBlocks.at(1), ipBlock[1]);
-                UtilityLib::String::StringToIntegral<UCHAR>(ipBlocks.at(2), ipBlock[2]);
-                UtilityLib::String::StringToIntegral<UCHAR>(ipBlocks.at(3), ipBlock[3]);
-                addr.sin_addr.S_un.S_un_b = { ipBlock[0], ipBlock[1], ipBlock[2], ipBlock[3] };
-            }
             return addr;
         }
 
         // Internal function, do not use this directly unless you really need to
-        inline std::string SockaddrInToString(sockaddr_in* ptr)
+        inline EndpointCls SockaddrInToEndpoint(const sockaddr_in* ptr)
         {
-            std::vector<std::string> ipBlocks;
-            ipBlocks.push_back(UtilityLib::String::IntegralToString<UCHAR>(ptr->sin_addr.S_un.S_un_b.s_b1));
-            ipBlocks.push_back(UtilityLib::String::IntegralToString<UCHAR>(ptr->sin_addr.S_un.S_un_b.s_b2));
-            ipBlocks.push_back(UtilityLib::String::IntegralToString<UCHAR>(ptr->sin_addr.S_un.S_un_b.s_b3));
-            ipBlocks.push_back(UtilityLib::String::IntegralToString<UCHAR>(ptr->sin_addr.S_un.S_un_b.s_b4));
+            IpAddressCls address = IpAddressCls::FromV4Bytes(reinterpret_cast<const uint8_t*>(&ptr->sin_addr));
+            return EndpointCls(address, ntohs(ptr->sin_port));
+        }
 
-            return UtilityLib::String::Join(ipBlocks, '.');
+        // Internal function, do not use this directly unless you really need to
+        inline IpAddressString SockaddrInToString(const sockaddr_in* ptr)
+        {
+            char buffer[UtilityLib::String::MAX_IP_ADDRESS_CHARS];
+            size_t size = IpAddressCls::FromV4Bytes(reinterpret_cast<const uint8_t*>(&ptr->sin_addr)).Format(buffer);
+            return IpAddressString(std::string_view(buffer, size));
+        }
+
+        // Internal function, do not use this directly unless you really need to
+        inline PortString SockaddrInPortToString(const sockaddr_in* ptr)
+        {
+            char buffer[UtilityLib::String::MAX_INTEGRAL_CHARS<USHORT>];
+            size_t size = UtilityLib::String::FormatIntegral<USHORT>(ntohs(ptr->sin_port), buffer);
+            return PortString(std::string_view(buffer, size));
         }
     };
 }
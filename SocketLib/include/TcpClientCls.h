@@ -16,15 +16,15 @@ namespace UtilityLib
             SOCKET Sock;
             addrinfo Hints;
             addrinfo* AddressInfoResults;
-            std::string IpAddress;
-            std::string Port;
+            IpAddressString IpAddress;
+            PortString Port;
             int LastWinsockError;
             char Buffer[2048];
 
             TcpClientCls();
 
-            bool SetIpAddress(const std::string& ipAddress);
-            bool SetPort(const std::string& port);
+            bool SetIpAddress(std::string_view ipAddress);
+            bool SetPort(std::string_view port);
 
             WinsockError GetAddressInfo();
             WinsockError CreateSocket();
@@ -38,8 +38,8 @@ namespace UtilityLib
             // 
             // Arguments:
             // const addrinfo& hints         --- In
-            // const std::string& ipAddress  --- In
-            // const std::string& port       --- In
+            // std::string_view ipAddress    --- In
+            // std::string_view port         --- In
             // BlockingMode mode             --- In (default BlockingMode::Blocking)
             // 
             // Returns:
@@ -57,8 +57,8 @@ namespace UtilityLib
             // Create a new object by calling this method if you need to change them...
             static std::variant<WinsockError, TcpClientCls> Initialize(
                 const addrinfo& hints,
-                const std::string& ipAddress,
-                const std::string& port,
+                std::string_view ipAddress,
+                std::string_view port,
                 BlockingMode mode = BlockingMode::Blocking);
 
             // GetLastWinsockError()
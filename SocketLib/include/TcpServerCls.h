@@ -15,12 +15,12 @@ namespace UtilityLib
         {
         private:
             SOCKET Sock;
-            std::string Port;
+            uint16_t Port;
             int LastWinsockError;
 
             TcpServerCls();
 
-            bool SetPort(const std::string& port);
+            bool SetPort(std::string_view port);
 
             WinsockError GetAddressInfo();
             WinsockError CreateSocket();
@@ -35,7 +35,7 @@ namespace UtilityLib
             // Initialize as socket to use as a TCP Server
             // 
             // Arguments: 
-            // const std::string& port       --- In
+            // std::string_view port         --- In
             // BlockingMode mode             --- In (default BlockingMode::Blocking)
             // int backlog                   --- In (default SOMAXCONN)
             // 
@@ -52,7 +52,7 @@ namespace UtilityLib
             // Note: Once initialized, Port cannot be changed
             // Create a new object by calling this method if you need to change it...
             static std::variant<WinsockError, TcpServerCls> Initialize(
-                const std::string& port,
+                std::string_view port,
                 BlockingMode mode = BlockingMode::Blocking,
                 int backlog = SOMAXCONN);
 
@@ -12,14 +12,14 @@ namespace UtilityLib
         private:
             SOCKET Sock;
             int LastWinsockError;
-            std::string IpAddress;
-            std::string Port;
+            IpAddressString IpAddress;
+            PortString Port;
             char Buffer[2048];
 
         public:
             // Constructor to be used by TcpServerCls::Accept
             // Do not manually create an object through this
-            TcpSessionCls(SOCKET clientHandlerSock, const std::string& ipAddress, const std::string& port);
+            TcpSessionCls(SOCKET clientHandlerSock, const IpAddressString& ipAddress, const PortString& port);
 
             // GetLastWinsockError()
             // 
@@ -14,8 +14,7 @@ namespace UtilityLib
         {
         private:
             SOCKET Sock;
-            std::string IpAddress;
-            std::string Port;
+            EndpointCls ServerEndpoint;
             int LastWinsockError;
             char Buffer[2048];
 
@@ -23,6 +22,7 @@ namespace UtilityLib
 
             WinsockError CreateSocket();
             WinsockError CloseSocket();
+            WinsockError Receive(std::string& buffer, size_t bufferLen, size_t& recvByteCount, sockaddr_in& from);
 
         public:
             // Initialize
@@ -31,8 +31,8 @@ namespace UtilityLib
             // Initialize as socket to use as a UDP Client
             // 
             // Arguments:
-            // const std::string& ipAddress  --- In
-            // const std::string& port       --- In
+            // std::string_view ipAddress    --- In
+            // std::string_view port         --- In
             // BlockingMode mode             --- In (default BlockingMode::Blocking)
             // 
             // Returns:
@@ -49,8 +49,8 @@ namespace UtilityLib
             // Note: Once initialized, IP Address and Port can be changed via SetIpAddress() and SetPort()
             // Check return value to make sure change is successful
             static std::variant<WinsockError, UdpClientCls> Initialize(
-                const std::string& ipAddress,
-                const std::string& port,
+                std::string_view ipAddress,
+                std::string_view port,
                 BlockingMode mode = BlockingMode::Blocking);
 
             // GetLastWinsockError()
@@ -67,14 +67,14 @@ namespace UtilityLib
             // SetIpAddress()
             // 
             // Summary:
-            // Change UDP Server IP Address
+            // Change UDP Server IP Address, it is parsed once here and not again on every SendTo()
             // 
             // Arguments:
-            // const std::string& ipAddress  --- In
+            // std::string_view ipAddress  --- In
             // 
             // Returns:
             // bool
-            bool SetIpAddress(const std::string& ipAddress);
+            bool SetIpAddress(std::string_view ipAddress);
 
             // SetPort()
             // 
@@ -82,11 +82,12 @@ namespace UtilityLib
             // Change UDP Server Port
             // 
             // Arguments:
-            // const std::string& port  --- In
+            // std::string_view port  --- In
             // 
             // Returns:
             // bool
-            bool SetPort(const std::string& port);
+            bool SetPort(std::string_view port);
+            void SetPort(uint16_t port);
 
             // SetBlockingMode()
             // 
@@ -110,6 +111,8 @@ namespace UtilityLib
             // std::string& buffer    --- Out (Just pass a default constructed buffer, necessary allocation will be handled inside)
             // size_t bufferLen       --- In (Try not to exceed 2048 bytes, there will be performance penalties if you do)
             // size_t& recvByteCount  --- Out
+            // IpAddressString& fromIpAddr, PortString& fromPort  --- Out (optional, sender as text)
+            // EndpointCls& from                                  --- Out (optional, sender as binary address, nothing is formatted)
             // 
             // Returns:
             // WinsockError
@@ -127,7 +130,8 @@ namespace UtilityLib
             // On success:
             // * WinsockError::Success               is returned and recvByteCount is set to received byte count
             WinsockError RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount);
-            WinsockError RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, std::string& fromIpAddr, std::string& fromPort);
+            WinsockError RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, IpAddressString& fromIpAddr, PortString& fromPort);
+            WinsockError RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, EndpointCls& from);
 
             // SendTo()
             // 
@@ -14,18 +14,17 @@ namespace UtilityLib
         {
         private:
             SOCKET Sock;
-            std::string Port;
+            EndpointCls LocalEndpoint;
             int LastWinsockError;
             char Buffer[2048];
 
             UdpServerCls();
 
-            bool SetPort(const std::string& port);
-
             WinsockError CreateSocket();
             WinsockError CloseSocket();
             WinsockError SetBlockingMode(BlockingMode mode);
-            WinsockError Bind(const std::string& ipAddress = "");
+            WinsockError Bind();
+            WinsockError Receive(std::string& buffer, size_t bufferLen, size_t& recvByteCount, sockaddr_in& from);
 
         public:
             // Initialize()
@@ -34,9 +33,9 @@ namespace UtilityLib
             // Initialize a socket to use as a UDP Server
             // 
             // Arguments:
-            // const std::string& port       --- In
+            // std::string_view port         --- In
             // BlockingMode blockingMode     --- In (default BlockingMode::Blocking)
-            // const std::string& ipAddress  --- In (default "", do not pass an ipAddress if you prefer to recvfrom any address, pass and ipAddress if you prefer to recvfrom only that one)
+            // std::string_view ipAddress    --- In (default "", do not pass an ipAddress if you prefer to recvfrom any address, pass and ipAddress if you prefer to recvfrom only that one)
             // 
             // Returns:
             // std::variant<WinsockError, UdpServerCls>
@@ -50,9 +49,26 @@ namespace UtilityLib
             // Note: Port cannot be changed after initialization
             // Create a new object through this method if you need a new socket on a different port
             static std::variant<WinsockError, UdpServerCls> Initialize(
-                const std::string& port,
+                std::string_view port,
                 BlockingMode blockingMode = BlockingMode::Blocking,
-                const std::string& ipAddress = "");
+                std::string_view ipAddress = {});
+
+            // Initialize()
+            // 
+            // Summary:
+            // Same as above, with an endpoint that is already parsed (0.0.0.0 as address to recvfrom any address)
+            // 
+            // Arguments:
+            // const EndpointCls& localEndpoint  --- In (must be IPv4)
+            // BlockingMode blockingMode         --- In (default BlockingMode::Blocking)
+            // 
+            // Returns:
+            // std::variant<WinsockError, UdpServerCls>
+            // 
+            // WinsockError::InvalidIpAddress      is returned when localEndpoint is not IPv4
+            static std::variant<WinsockError, UdpServerCls> Initialize(
+                const EndpointCls& localEndpoint,
+                BlockingMode blockingMode = BlockingMode::Blocking);
 
             // RecvFrom()
             // 
@@ -64,8 +80,9 @@ namespace UtilityLib
             // std::string& buffer      --- Out (Do not allocate bufferLen size for buffer, it will be handled inside. Just pass a default constructed std::string)
             // size_t bufferLen         --- In  (Try not to pass 2048 bytes, there will be performance penalties if you do)
             // size_t& recvByteCount    --- Out
-            // std::string& fromIpAddr  --- Out (Set to IP Address of UDP Client)
-            // std::string& fromPort    --- Out (Set to Port of UDP Client)
+            // IpAddressString& fromIpAddr  --- Out (Set to IP Address of UDP Client)
+            // PortString& fromPort         --- Out (Set to Port of UDP Client)
+            // EndpointCls& from            --- Out (Set to address of UDP Client, nothing is formatted, can be passed to SendTo() as it is)
             // 
             // Returns:
             // WinsockError
@@ -83,7 +100,8 @@ namespace UtilityLib
             // 
             // On success:
             // WinsockError::Success                 is returned and recvByteCount is set to received byte count
-            WinsockError RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, std::string& fromIpAddr, std::string& fromPort);
+            WinsockError RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, IpAddressString& fromIpAddr, PortString& fromPort);
+            WinsockError RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, EndpointCls& from);
 
             // SendTo()
             // 
@@ -95,13 +113,17 @@ namespace UtilityLib
             // const std::string& buffer    --- In
             // size_t bufferLen             --- In
             // size_t& sentByteCount        --- Out
-            // const std::string& toIpAddr  --- In (Ip Address of UDP Client that data will be send)
-            // const std::string& toPort    --- In (Port of UDP Client that data will be send)
+            // std::string_view toIpAddr  --- In (Ip Address of UDP Client that data will be send)
+            // std::string_view toPort    --- In (Port of UDP Client that data will be send)
+            // const EndpointCls& to      --- In (Address of UDP Client, prefer this overload when sending to the same client repeatedly,
+            //                                    text overload parses the address on every call)
             // 
             // Returns:
             // WinsockError
             // 
             // On failure:
+            // * WinsockError::InvalidIpAddress      is returned when toIpAddr is not a valid IPv4 address
+            // * WinsockError::InvalidPort           is returned when toPort is not a valid port
             // * WinsockError::BufferTooLong         is returned when bufferLen > INT_MAX
             // * WinsockError::BufferLengthIsZero    is returned when bufferLen == 0
             // * WinsockError::NotInitialized        is returned when internal socket is not created 
@@ -113,7 +135,8 @@ namespace UtilityLib
             // 
             // On success:
             // WinsockError::Success                 is returned and sentByteCount is set to sent byte count
-            WinsockError SendTo(const std::string& buffer, size_t bufferLen, size_t& sentByteCount, const std::string& toIpAddr, const std::string& toPort);
+            WinsockError SendTo(const std::string& buffer, size_t bufferLen, size_t& sentByteCount, std::string_view toIpAddr, std::string_view toPort);
+            WinsockError SendTo(const std::string& buffer, size_t bufferLen, size_t& sentByteCount, const EndpointCls& to);
 
             // GetLastWinsockError()
             // 
@@ -52,21 +52,19 @@ namespace UtilityLib
             CloseSocket();
         }
 
-        bool TcpClientCls::SetIpAddress(const std::string& ipAddress)
+        bool TcpClientCls::SetIpAddress(std::string_view ipAddress)
         {
             if (UtilityLib::String::ValidateIpAddress(ipAddress))
             {
-                IpAddress = ipAddress;
-                return true;
+                return IpAddress.assign(ipAddress);
             }
             return false;
         }
-        bool TcpClientCls::SetPort(const std::string& port)
+        bool TcpClientCls::SetPort(std::string_view port)
         {
             if (UtilityLib::String::ValidatePort(port))
             {
-                Port = port;
-                return true;
+                return Port.assign(port);
             }
             return false;
         }
@@ -156,7 +154,7 @@ namespace UtilityLib
             return WinsockError::Success;
         }
 
-        std::variant<WinsockError, TcpClientCls> TcpClientCls::Initialize(const addrinfo& hints, const std::string& ipAddress, const std::string& port, BlockingMode mode)
+        std::variant<WinsockError, TcpClientCls> TcpClientCls::Initialize(const addrinfo& hints, std::string_view ipAddress, std::string_view port, BlockingMode mode)
         {
             TcpClientCls tcp;
 
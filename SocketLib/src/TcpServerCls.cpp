@@ -6,13 +6,14 @@ namespace UtilityLib
     {
         TcpServerCls::TcpServerCls() :
             Sock(INVALID_SOCKET),
+            Port(0),
             LastWinsockError(0)
         {
         }
         TcpServerCls::TcpServerCls(TcpServerCls&& other) noexcept :
             Sock(other.Sock),
             LastWinsockError(other.LastWinsockError),
-            Port(std::move(other.Port))
+            Port(other.Port)
         {
             other.Sock = INVALID_SOCKET;
         }
@@ -22,7 +23,7 @@ namespace UtilityLib
             {
                 Sock = other.Sock;
                 LastWinsockError = other.LastWinsockError;
-                Port = std::move(other.Port);
+                Port = other.Port;
 
                 other.Sock = INVALID_SOCKET;
             }
@@ -33,14 +34,9 @@ namespace UtilityLib
             CloseSocket();
         }
 
-        bool TcpServerCls::SetPort(const std::string& port)
+        bool TcpServerCls::SetPort(std::string_view port)
         {
-            if (UtilityLib::String::ValidatePort(port))
-            {
-                Port = port;
-                return true;
-            }
-            return false;
+            return UtilityLib::String::ParsePort(port, Port) == UtilityLib::String::StringError::Success;
         }
         int TcpServerCls::GetLastWinsockError()
         {
@@ -92,7 +88,8 @@ namespace UtilityLib
         {
             if (Sock == INVALID_SOCKET) return WinsockError::NotInitialized;
 
-            sockaddr_in addr = StringToSockaddrIn(Port);
+            // Default address is 0.0.0.0, accepts connections on every interface
+            sockaddr_in addr = EndpointToSockaddrIn(EndpointCls(IpAddressCls(), Port));
             int iResult = bind(Sock, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr));
 
             if (iResult == SOCKET_ERROR)
@@ -129,14 +126,14 @@ namespace UtilityLib
             }
 
             sockaddr_in* addrIn = reinterpret_cast<sockaddr_in*>(&addr);
-            std::string clientIpAddr = SockaddrInToString(addrIn);
-            std::string clientPort = UtilityLib::String::IntegralToString<USHORT>(ntohs(addrIn->sin_port));
+            IpAddressString clientIpAddr = SockaddrInToString(addrIn);
+            PortString clientPort = SockaddrInPortToString(addrIn);
 
             TcpSessionCls tcpSession(sock, clientIpAddr, clientPort);
             return tcpSession;
         }
 
-        std::variant<WinsockError, TcpServerCls> TcpServerCls::Initialize(const std::string& port, BlockingMode mode, int backlog)
+        std::variant<WinsockError, TcpServerCls> TcpServerCls::Initialize(std::string_view port, BlockingMode mode, int backlog)
         {
             TcpServerCls tcp;
 
@@ -4,7 +4,7 @@ namespace UtilityLib
 {
     namespace Socket
     {
-        TcpSessionCls::TcpSessionCls(SOCKET clientHandlerSock, const std::string& ipAddress, const std::string& port) :
+        TcpSessionCls::TcpSessionCls(SOCKET clientHandlerSock, const IpAddressString& ipAddress, const PortString& port) :
             Sock(clientHandlerSock),
             IpAddress(ipAddress),
             Port(port),
@@ -13,8 +13,7 @@ namespace UtilityLib
         UdpClientCls::UdpClientCls(UdpClientCls&& other) noexcept :
             Sock(other.Sock),
             LastWinsockError(other.LastWinsockError),
-            IpAddress(std::move(other.IpAddress)),
-            Port(std::move(other.Port))
+            ServerEndpoint(other.ServerEndpoint)
         {
             other.Sock = INVALID_SOCKET;
             memcpy(Buffer, other.Buffer, sizeof(Buffer));
@@ -25,8 +24,7 @@ namespace UtilityLib
             {
                 Sock = other.Sock;
                 LastWinsockError = other.LastWinsockError;
-                IpAddress = std::move(other.IpAddress);
-                Port = std::move(other.Port);
+                ServerEndpoint = other.ServerEndpoint;
                 memcpy(Buffer, other.Buffer, sizeof(Buffer));
 
                 other.Sock = INVALID_SOCKET;
@@ -38,24 +36,30 @@ namespace UtilityLib
             CloseSocket();
         }
 
-        bool UdpClientCls::SetIpAddress(const std::string& ipAddress)
+        bool UdpClientCls::SetIpAddress(std::string_view ipAddress)
         {
-            if (UtilityLib::String::ValidateIpAddress(ipAddress))
+            IpAddressCls address;
+            if (IpAddressCls::ParseV4(ipAddress, address) == UtilityLib::String::StringError::Success)
             {
-                IpAddress = ipAddress;
+                ServerEndpoint.SetAddress(address);
                 return true;
             }
             return false;
         }
-        bool UdpClientCls::SetPort(const std::string& port)
+        bool UdpClientCls::SetPort(std::string_view port)
         {
-            if (UtilityLib::String::ValidatePort(port))
+            uint16_t portNum = 0;
+            if (UtilityLib::String::ParsePort(port, portNum) == UtilityLib::String::StringError::Success)
             {
-                Port = port;
+                ServerEndpoint.SetPort(portNum);
                 return true;
             }
             return false;
         }
+        void UdpClientCls::SetPort(uint16_t port)
+        {
+            ServerEndpoint.SetPort(port);
+        }
         int UdpClientCls::GetLastWinsockError()
         {
             return LastWinsockError;
@@ -103,7 +107,7 @@ namespace UtilityLib
             return WinsockError::Success;
         }
 
-        std::variant<WinsockError, UdpClientCls> UdpClientCls::Initialize(const std::string& ipAddress, const std::string& port, BlockingMode mode)
+        std::variant<WinsockError, UdpClientCls> UdpClientCls::Initialize(std::string_view ipAddress, std::string_view port, BlockingMode mode)
         {
             UdpClientCls udp;
 
@@ -131,7 +135,7 @@ namespace UtilityLib
             return udp;
         }
 
-        WinsockError UdpClientCls::RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount)
+        WinsockError UdpClientCls::Receive(std::string& buffer, size_t bufferLen, size_t& recvByteCount, sockaddr_in& from)
         {
             if (bufferLen > INT_MAX) return WinsockError::BufferTooLong;
             if (bufferLen == 0) return WinsockError::BufferLengthIsZero;
@@ -159,41 +163,35 @@ namespace UtilityLib
             recvByteCount = static_cast<size_t>(iResult);
             buffer.assign(bufPtr, recvByteCount);
             if (bufferLen > 2048) delete[] bufPtr;
+
+            memcpy(&from, &addr, sizeof(from));
             return WinsockError::Success;
         }
-        WinsockError UdpClientCls::RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, std::string& fromIpAddr, std::string& fromPort)
+        WinsockError UdpClientCls::RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount)
         {
-            if (bufferLen > INT_MAX) return WinsockError::BufferTooLong;
-            if (bufferLen == 0) return WinsockError::BufferLengthIsZero;
-            if (Sock == INVALID_SOCKET) return WinsockError::NotInitialized;
-
-            char* bufPtr = Buffer;
-            if (bufferLen > 2048)
+            sockaddr_in from;
+            return Receive(buffer, bufferLen, recvByteCount, from);
+        }
+        WinsockError UdpClientCls::RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, IpAddressString& fromIpAddr, PortString& fromPort)
+        {
+            sockaddr_in from;
+            WinsockError result = Receive(buffer, bufferLen, recvByteCount, from);
+            if (result == WinsockError::Success)
             {
-                bufPtr = new (std::nothrow) char[bufferLen];
-                if (bufPtr == nullptr) return WinsockError::OutOfMemory;
+                fromIpAddr = SockaddrInToString(&from);
+                fromPort = SockaddrInPortToString(&from);
             }
-
-            int bufLen = static_cast<int>(bufferLen);
-            sockaddr addr{ 0 };
-            int addrLen = sizeof(addr);
-
-            int iResult = recvfrom(Sock, bufPtr, bufLen, 0, &addr, &addrLen);
-            if (iResult == SOCKET_ERROR)
+            return result;
+        }
+        WinsockError UdpClientCls::RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, EndpointCls& from)
+        {
+            sockaddr_in addr;
+            WinsockError result = Receive(buffer, bufferLen, recvByteCount, addr);
+            if (result == WinsockError::Success)
             {
-                if (bufferLen > 2048) delete[] bufPtr;
-                LastWinsockError = WSAGetLastError();
-                return WinsockError::CheckLastWinsockError;
+                from = SockaddrInToEndpoint(&addr);
             }
-
-            recvByteCount = static_cast<size_t>(iResult);
-            buffer.assign(bufPtr, recvByteCount);
-            if (bufferLen > 2048) delete[] bufPtr;
-
-            fromIpAddr = SockaddrInToString(reinterpret_cast<sockaddr_in*>(&addr));
-            fromPort = UtilityLib::String::IntegralToString(ntohs(reinterpret_cast<sockaddr_in*>(&addr)->sin_port));
-
-            return WinsockError::Success;
+            return result;
         }
         WinsockError UdpClientCls::SendTo(const std::string& buffer, size_t bufferLen, size_t& sentByteCount)
         {
@@ -203,7 +201,7 @@ namespace UtilityLib
 
             const char* bufPtr = buffer.c_str();
             int bufLen = static_cast<int>(bufferLen);
-            sockaddr_in addr = StringToSockaddrIn(Port, IpAddress);
+            sockaddr_in addr = EndpointToSockaddrIn(ServerEndpoint);
             sockaddr* addrPtr = reinterpret_cast<sockaddr*>(&addr);
             int addrLen = sizeof(*addrPtr);
 
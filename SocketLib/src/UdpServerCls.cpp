@@ -13,7 +13,7 @@ namespace UtilityLib
         UdpServerCls::UdpServerCls(UdpServerCls&& other) noexcept :
             Sock(other.Sock),
             LastWinsockError(other.LastWinsockError),
-            Port(std::move(other.Port))
+            LocalEndpoint(other.LocalEndpoint)
         {
             memcpy(Buffer, other.Buffer, sizeof(Buffer));
 
@@ -25,7 +25,7 @@ namespace UtilityLib
             {
                 Sock = other.Sock;
                 LastWinsockError = other.LastWinsockError;
-                Port = std::move(other.Port);
+                LocalEndpoint = other.LocalEndpoint;
                 memcpy(Buffer, other.Buffer, sizeof(Buffer));
 
                 other.Sock = INVALID_SOCKET;
@@ -41,19 +41,32 @@ namespace UtilityLib
             return LastWinsockError;
         }
 
-        std::variant<WinsockError, UdpServerCls> UdpServerCls::Initialize(const std::string& port, BlockingMode blockingMode, const std::string& ipAddress)
+        std::variant<WinsockError, UdpServerCls> UdpServerCls::Initialize(std::string_view port, BlockingMode blockingMode, std::string_view ipAddress)
         {
-            if (ipAddress != "" && UtilityLib::String::ValidateIpAddress(ipAddress) == false)
+            IpAddressCls address;
+            if (ipAddress.empty() == false && IpAddressCls::ParseV4(ipAddress, address) != UtilityLib::String::StringError::Success)
             {
                 return WinsockError::InvalidIpAddress;
             }
 
-            UdpServerCls udp;
-            if (udp.SetPort(port) == false)
+            uint16_t portNum = 0;
+            if (UtilityLib::String::ParsePort(port, portNum) != UtilityLib::String::StringError::Success)
             {
                 return WinsockError::InvalidPort;
             }
 
+            return Initialize(EndpointCls(address, portNum), blockingMode);
+        }
+        std::variant<WinsockError, UdpServerCls> UdpServerCls::Initialize(const EndpointCls& localEndpoint, BlockingMode blockingMode)
+        {
+            if (localEndpoint.GetAddress().IsV4() == false)
+            {
+                return WinsockError::InvalidIpAddress;
+            }
+
+            UdpServerCls udp;
+            udp.LocalEndpoint = localEndpoint;
+
             WinsockError result = udp.CreateSocket();
             if (result != WinsockError::Success)
             {
@@ -66,7 +79,7 @@ namespace UtilityLib
                 return result;
             }
 
-            result = udp.Bind(ipAddress);
+            result = udp.Bind();
             if (result != WinsockError::Success)
             {
                 return result;
@@ -75,16 +88,6 @@ namespace UtilityLib
             return udp;
         }
 
-        bool UdpServerCls::SetPort(const std::string& port)
-        {
-            if (UtilityLib::String::ValidatePort(port))
-            {
-                Port = port;
-                return true;
-            }
-            return false;
-        }
-
         WinsockError UdpServerCls::CreateSocket()
         {
             Sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
@@ -126,11 +129,11 @@ namespace UtilityLib
             }
             return WinsockError::Success;
         }
-        WinsockError UdpServerCls::Bind(const std::string& ipAddress)
+        WinsockError UdpServerCls::Bind()
         {
             if (Sock == INVALID_SOCKET) return WinsockError::NotInitialized;
 
-            struct sockaddr_in addr = StringToSockaddrIn(Port, ipAddress);
+            struct sockaddr_in addr = EndpointToSockaddrIn(LocalEndpoint);
 
             int iResult = bind(Sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
             if (iResult != SOCKET_ERROR)
@@ -142,7 +145,7 @@ namespace UtilityLib
             return WinsockError::CheckLastWinsockError;
         }
 
-        WinsockError UdpServerCls::RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, std::string& fromIpAddr, std::string& fromPort)
+        WinsockError UdpServerCls::Receive(std::string& buffer, size_t bufferLen, size_t& recvByteCount, sockaddr_in& from)
         {
             if (bufferLen > INT_MAX) return WinsockError::BufferTooLong;
             if (bufferLen == 0) return WinsockError::BufferLengthIsZero;
@@ -172,23 +175,60 @@ namespace UtilityLib
             buffer.assign(bufPtr, recvByteCount);
             if (bufferLen > 2048) delete[] bufPtr;
 
-            sockaddr_in* ptr = reinterpret_cast<sockaddr_in*>(&addr);
-            fromIpAddr = SockaddrInToString(ptr);
-            fromPort = String::IntegralToString<USHORT>(ntohs(ptr->sin_port));
-
+            memcpy(&from, &addr, sizeof(from));
             return WinsockError::Success;
         }
-        WinsockError UdpServerCls::SendTo(const std::string& buffer, size_t bufferLen, size_t& sentByteCount, const std::string& toIpAddr, const std::string& toPort)
+        WinsockError UdpServerCls::RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, IpAddressString& fromIpAddr, PortString& fromPort)
+        {
+            sockaddr_in from;
+            WinsockError result = Receive(buffer, bufferLen, recvByteCount, from);
+            if (result == WinsockError::Success)
+            {
+                fromIpAddr = SockaddrInToString(&from);
+                fromPort = SockaddrInPortToString(&from);
+            }
+            return result;
+        }
+        WinsockError UdpServerCls::RecvFrom(std::string& buffer, size_t bufferLen, size_t& recvByteCount, EndpointCls& from)
+        {
+            sockaddr_in addr;
+            WinsockError result = Receive(buffer, bufferLen, recvByteCount, addr);
+            if (result == WinsockError::Success)
+            {
+                from = SockaddrInToEndpoint(&addr);
+            }
+            return result;
+        }
+        WinsockError UdpServerCls::SendTo(const std::string& buffer, size_t bufferLen, size_t& sentByteCount, std::string_view toIpAddr, std::string_view toPort)
+        {
+            sentByteCount = 0;
+
+            IpAddressCls address;
+            if (IpAddressCls::ParseV4(toIpAddr, address) != UtilityLib::String::StringError::Success)
+            {
+                return WinsockError::InvalidIpAddress;
+            }
+
+            uint16_t portNum = 0;
+            if (UtilityLib::String::ParsePort(toPort, portNum) != UtilityLib::String::StringError::Success)
+            {
+                return WinsockError::InvalidPort;
+            }
+
+            return SendTo(buffer, bufferLen, sentByteCount, EndpointCls(address, portNum));
+        }
+        WinsockError UdpServerCls::SendTo(const std::string& buffer, size_t bufferLen, size_t& sentByteCount, const EndpointCls& to)
         {
             sentByteCount = 0;
 
             if (bufferLen > INT_MAX) return WinsockError::BufferTooLong;
             if (bufferLen == 0) return WinsockError::BufferLengthIsZero;
             if (Sock == INVALID_SOCKET) return WinsockError::NotInitialized;
+            if (to.GetAddress().IsV4() == false) return WinsockError::InvalidIpAddress;
 
             const char* bufPtr = buffer.c_str();
             int bufLen = static_cast<int>(bufferLen);
-            sockaddr_in addr = StringToSockaddrIn(toPort, toIpAddr);
+            sockaddr_in addr = EndpointToSockaddrIn(to);
             sockaddr* addrPtr = reinterpret_cast<sockaddr*>(&addr);
             int addrLen = sizeof(*addrPtr);
 
@@ -0,0 +1,202 @@
+#ifndef BASE64PKG_H
+#define BASE64PKG_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "StringPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        enum class Base64Alphabet
+        {
+            Standard = 0, // RFC 4648 section 4, "+/" and "=" padding
+            UrlSafe       // RFC 4648 section 5, "-_" and no padding
+        };
+
+        // Base64 encoding and decoding
+        //
+        // AVX2 or SSSE3 kernels are picked once through cpuid, scalar code is used on other machines
+        // Decoding always validates the input, padding is optional but if it is present it must be correct
+
+        // GetEncodedBase64Size()
+        //
+        // Summary:
+        // Returns exact number of characters EncodeBase64() writes for "size" bytes
+        //
+        // Arguments:
+        // size_t size              --- In
+        // Base64Alphabet alphabet  --- In (default Base64Alphabet::Standard)
+        //
+        // Returns:
+        // size_t
+        size_t GetEncodedBase64Size(size_t size, Base64Alphabet alphabet = Base64Alphabet::Standard);
+
+        // GetDecodedBase64Size()
+        //
+        // Summary:
+        // Returns exact number of bytes DecodeBase64() writes for the input, if the input is valid
+        //
+        // Arguments:
+        // std::string_view in  --- In
+        //
+        // Returns:
+        // size_t
+        size_t GetDecodedBase64Size(std::string_view in);
+
+        // EncodeBase64()
+        //
+        // Summary:
+        // Encodes "in" into a caller provided buffer
+        //
+        // Arguments:
+        // std::string_view in      --- In
+        // char* out                --- Out (must have room for GetEncodedBase64Size(in.size(), alphabet) characters)
+        // Base64Alphabet alphabet  --- In
+        //
+        // Returns:
+        // size_t (number of characters written)
+        size_t EncodeBase64(std::string_view in, char* out, Base64Alphabet alphabet);
+
+        // EncodeBase64()
+        //
+        // Summary:
+        // Encodes "in" with the specified alphabet
+        //
+        // Arguments:
+        // std::string_view in      --- In
+        // Base64Alphabet alphabet  --- In
+        //
+        // Returns:
+        // std::string
+        std::string EncodeBase64(std::string_view in, Base64Alphabet alphabet);
+
+        // DecodeBase64()
+        //
+        // Summary:
+        // Decodes "in" into a caller provided buffer
+        //
+        // Arguments:
+        // std::string_view in      --- In
+        // char* out                --- Out (must have room for GetDecodedBase64Size(in) bytes)
+        // size_t& outSize          --- Out (number of bytes written)
+        // Base64Alphabet alphabet  --- In (default Base64Alphabet::Standard)
+        //
+        // Returns:
+        // StringError
+        //
+        // On failure:
+        // StringError::InvalidArgument is returned when "in" contains a character that is not in the alphabet,
+        //                              misplaced padding, or has an impossible length
+        //                              Content of "out" is unspecified in that case
+        StringError DecodeBase64(std::string_view in, char* out, size_t& outSize, Base64Alphabet alphabet = Base64Alphabet::Standard);
+
+        // DecodeBase64()
+        //
+        // Summary:
+        // Decodes "in", result replaces the content of "out"
+        //
+        // Arguments:
+        // std::string_view in      --- In
+        // std::string& out         --- Out
+        // Base64Alphabet alphabet  --- In (default Base64Alphabet::Standard)
+        //
+        // Returns:
+        // StringError (see above)
+        StringError DecodeBase64(std::string_view in, std::string& out, Base64Alphabet alphabet = Base64Alphabet::Standard);
+
+        // Streaming Base64 encoder
+        // Input can be split at any byte, output is identical to encoding the whole input at once
+        //
+        // Base64EncoderCls encoder;
+        // while (ReadChunk(chunk)) { out.clear(); encoder.Update(chunk, out); Write(out); }
+        // out.clear(); encoder.Finish(out); Write(out);
+        class Base64EncoderCls
+        {
+        private:
+            Base64Alphabet Alphabet;
+            char Pending[3];
+            size_t PendingSize;
+
+        public:
+            explicit Base64EncoderCls(Base64Alphabet alphabet = Base64Alphabet::Standard);
+
+            // Update()
+            //
+            // Summary:
+            // Encodes every complete 3 byte group, keeps the rest for the next call
+            //
+            // Arguments:
+            // std::string_view chunk  --- In
+            // std::string& out        --- Out (encoded characters are appended)
+            //
+            // Returns:
+            void Update(std::string_view chunk, std::string& out);
+
+            // Finish()
+            //
+            // Summary:
+            // Encodes remaining bytes (and padding), encoder can be used for a new stream afterwards
+            //
+            // Arguments:
+            // std::string& out  --- Out (encoded characters are appended)
+            //
+            // Returns:
+            void Finish(std::string& out);
+        };
+
+        // Streaming Base64 decoder
+        // Input can be split at any character, output is identical to decoding the whole input at once
+        class Base64DecoderCls
+        {
+        private:
+            Base64Alphabet Alphabet;
+            char Pending[4];
+            size_t PendingSize;
+            bool IsPaddingSeen;
+
+        public:
+            explicit Base64DecoderCls(Base64Alphabet alphabet = Base64Alphabet::Standard);
+
+            // Update()
+            //
+            // Summary:
+            // Decodes every complete 4 character group, keeps the rest for the next call
+            //
+            // Arguments:
+            // std::string_view chunk  --- In
+            // std::string& out        --- Out (decoded bytes are appended)
+            //
+            // Returns:
+            // StringError (StringError::InvalidArgument on invalid input, decoder must be Reset() afterwards)
+            StringError Update(std::string_view chunk, std::string& out);
+
+            // Finish()
+            //
+            // Summary:
+            // Decodes remaining characters of an unpadded input, decoder can be used for a new stream afterwards
+            //
+            // Arguments:
+            // std::string& out  --- Out (decoded bytes are appended)
+            //
+            // Returns:
+            // StringError (StringError::InvalidArgument if the stream ends with an impossible length)
+            StringError Finish(std::string& out);
+
+            // Reset()
+            //
+            // Summary:
+            // Drops any buffered input, decoder starts a new stream
+            //
+            // Arguments:
+            //
+            // Returns:
+            void Reset();
+        };
+    }
+}
+
+#endif
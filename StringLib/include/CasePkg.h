@@ -0,0 +1,108 @@
+#ifndef CASEPKG_H
+#define CASEPKG_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // ASCII case conversion and case insensitive comparison
+        //
+        // Only 'A'-'Z' and 'a'-'z' are affected, every other byte (including UTF-8 sequences) is left untouched
+        // Nothing here depends on the current locale, and nothing allocates
+        // SSE2 or AVX2 kernels (also used on AVX-512 CPUs) are picked once, through cpuid
+
+        // ToLowerAscii()
+        //
+        // Summary:
+        // Converts [first, last) to lowercase in place
+        //
+        // Arguments:
+        // char* first  --- In/Out
+        // char* last   --- In
+        //
+        // Returns:
+        void ToLowerAscii(char* first, char* last);
+
+        // ToLowerAscii()
+        //
+        // Summary:
+        // Writes lowercase version of src into dst
+        //
+        // Arguments:
+        // std::string_view src  --- In
+        // char* dst             --- Out (must have room for src.size() characters, can be equal to src.data())
+        //
+        // Returns:
+        void ToLowerAscii(std::string_view src, char* dst);
+
+        // ToUpperAscii()
+        //
+        // Summary:
+        // Converts [first, last) to uppercase in place
+        //
+        // Arguments:
+        // char* first  --- In/Out
+        // char* last   --- In
+        //
+        // Returns:
+        void ToUpperAscii(char* first, char* last);
+
+        // ToUpperAscii()
+        //
+        // Summary:
+        // Writes uppercase version of src into dst
+        //
+        // Arguments:
+        // std::string_view src  --- In
+        // char* dst             --- Out (must have room for src.size() characters, can be equal to src.data())
+        //
+        // Returns:
+        void ToUpperAscii(std::string_view src, char* dst);
+
+        // EqualsIgnoreCase()
+        //
+        // Summary:
+        // Checks if two strings are equal, ignoring ASCII case
+        //
+        // Arguments:
+        // std::string_view lhs  --- In
+        // std::string_view rhs  --- In
+        //
+        // Returns:
+        // bool
+        bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs);
+
+        // IsStartWithIgnoreCase()
+        //
+        // Summary:
+        // Checks if a string starts with specified prefix, ignoring ASCII case
+        //
+        // Arguments:
+        // std::string_view str     --- In
+        // std::string_view prefix  --- In
+        //
+        // Returns:
+        // bool
+        bool IsStartWithIgnoreCase(std::string_view str, std::string_view prefix);
+
+        // FindIgnoreCase()
+        //
+        // Summary:
+        // Finds the first occurrence of needle in haystack starting from pos, ignoring ASCII case
+        //
+        // Arguments:
+        // std::string_view haystack  --- In
+        // std::string_view needle    --- In
+        // size_t pos                 --- In (default 0)
+        //
+        // Returns:
+        // size_t (index of the match, or std::string::npos if not found)
+        size_t FindIgnoreCase(std::string_view haystack, std::string_view needle, size_t pos = 0);
+    }
+}
+
+#endif
@@ -0,0 +1,402 @@
+#ifndef CONSTEXPRPKG_H
+#define CONSTEXPRPKG_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include "Base64Pkg.h"
+#include "FixedStringCls.h"
+#include "NumberPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Compile time versions of the string functions
+        //
+        // Functions whose result length depends on the content take the input as a FixedStringCls template argument
+        // and return a FixedStringCls of the exact length, so the result can be a constexpr variable or another template argument
+        // Functions whose result length is known from the type take their input as a normal argument
+        // Everything here can also be called at run time, nothing allocates
+        //
+        // constexpr auto mode = Trim<"  octet ">();                // FixedStringCls<5>
+        // constexpr auto fields = Divide<"netascii,octet,mail", ','>(); // std::array<std::string_view, 3>
+        // static_assert(EncodeBase64<"user:pass">() == FixedStringCls("dXNlcjpwYXNz"));
+
+        // LeftTrimView()
+        //
+        // Summary:
+        // Returns str without leading ' ' characters (same characters as LeftTrim())
+        //
+        // Arguments:
+        // std::string_view str  --- In
+        //
+        // Returns:
+        // std::string_view
+        constexpr std::string_view LeftTrimView(std::string_view str)
+        {
+            size_t first = str.find_first_not_of(' ');
+            return first == std::string_view::npos ? std::string_view() : str.substr(first);
+        }
+        // RightTrimView()
+        //
+        // Summary:
+        // Returns str without trailing ' ' characters
+        //
+        // Arguments:
+        // std::string_view str  --- In
+        //
+        // Returns:
+        // std::string_view
+        constexpr std::string_view RightTrimView(std::string_view str)
+        {
+            size_t last = str.find_last_not_of(' ');
+            return last == std::string_view::npos ? std::string_view() : str.substr(0, last + 1);
+        }
+        // TrimView()
+        //
+        // Summary:
+        // Returns str without leading and trailing ' ' characters
+        //
+        // Arguments:
+        // std::string_view str  --- In
+        //
+        // Returns:
+        // std::string_view
+        constexpr std::string_view TrimView(std::string_view str)
+        {
+            return RightTrimView(LeftTrimView(str));
+        }
+
+        // LeftTrim()
+        //
+        // Summary:
+        // Compile time LeftTrim()
+        //
+        // Arguments:
+        // FixedStringCls Str  --- In (template argument)
+        //
+        // Returns:
+        // FixedStringCls<trimmed length>
+        template<FixedStringCls Str>
+        constexpr auto LeftTrim()
+        {
+            constexpr std::string_view trimmed = LeftTrimView(Str);
+            return FixedStringCls<trimmed.size()>(trimmed);
+        }
+        // RightTrim()
+        //
+        // Summary:
+        // Compile time RightTrim()
+        //
+        // Arguments:
+        // FixedStringCls Str  --- In (template argument)
+        //
+        // Returns:
+        // FixedStringCls<trimmed length>
+        template<FixedStringCls Str>
+        constexpr auto RightTrim()
+        {
+            constexpr std::string_view trimmed = RightTrimView(Str);
+            return FixedStringCls<trimmed.size()>(trimmed);
+        }
+        // Trim()
+        //
+        // Summary:
+        // Compile time Trim()
+        //
+        // Arguments:
+        // FixedStringCls Str  --- In (template argument)
+        //
+        // Returns:
+        // FixedStringCls<trimmed length>
+        template<FixedStringCls Str>
+        constexpr auto Trim()
+        {
+            constexpr std::string_view trimmed = TrimView(Str);
+            return FixedStringCls<trimmed.size()>(trimmed);
+        }
+
+        // ToLower()
+        //
+        // Summary:
+        // Returns ASCII lowercase version of a fixed string
+        //
+        // Arguments:
+        // const FixedStringCls<N>& str  --- In
+        //
+        // Returns:
+        // FixedStringCls<N>
+        template<size_t N>
+        constexpr FixedStringCls<N> ToLower(const FixedStringCls<N>& str)
+        {
+            FixedStringCls<N> result(str);
+            for (char& ch : result.Data)
+            {
+                if (ch >= 'A' && ch <= 'Z')
+                {
+                    ch = static_cast<char>(ch + ('a' - 'A'));
+                }
+            }
+            return result;
+        }
+        // ToUpper()
+        //
+        // Summary:
+        // Returns ASCII uppercase version of a fixed string
+        //
+        // Arguments:
+        // const FixedStringCls<N>& str  --- In
+        //
+        // Returns:
+        // FixedStringCls<N>
+        template<size_t N>
+        constexpr FixedStringCls<N> ToUpper(const FixedStringCls<N>& str)
+        {
+            FixedStringCls<N> result(str);
+            for (char& ch : result.Data)
+            {
+                if (ch >= 'a' && ch <= 'z')
+                {
+                    ch = static_cast<char>(ch - ('a' - 'A'));
+                }
+            }
+            return result;
+        }
+
+        // CountPieces()
+        //
+        // Summary:
+        // Returns number of pieces Divide() produces, empty pieces are not counted
+        //
+        // Arguments:
+        // std::string_view str        --- In
+        // std::string_view delimiter  --- In (must not be empty)
+        //
+        // Returns:
+        // size_t
+        constexpr size_t CountPieces(std::string_view str, std::string_view delimiter)
+        {
+            size_t count = 0;
+            size_t start = 0;
+            while (start <= str.size())
+            {
+                size_t end = str.find(delimiter, start);
+                if (end == std::string_view::npos)
+                {
+                    end = str.size();
+                }
+                count += end != start ? 1 : 0;
+                start = end + delimiter.size();
+            }
+            return count;
+        }
+
+        // Divide()
+        //
+        // Summary:
+        // Compile time Divide(), pieces are views into the template argument object, which lives for the whole program
+        //
+        // Arguments:
+        // FixedStringCls Str        --- In (template argument)
+        // FixedStringCls Delimiter  --- In (template argument, must not be empty)
+        //
+        // Returns:
+        // std::array<std::string_view, piece count>
+        template<FixedStringCls Str, FixedStringCls Delimiter>
+            requires (Delimiter.size() != 0)
+        constexpr auto Divide()
+        {
+            constexpr std::string_view str = Str;
+            constexpr std::string_view delimiter = Delimiter;
+
+            std::array<std::string_view, CountPieces(str, delimiter)> pieceList;
+            size_t count = 0;
+            size_t start = 0;
+            while (start <= str.size())
+            {
+                size_t end = str.find(delimiter, start);
+                if (end == std::string_view::npos)
+                {
+                    end = str.size();
+                }
+                if (end != start)
+                {
+                    pieceList[count++] = str.substr(start, end - start);
+                }
+                start = end + delimiter.size();
+            }
+            return pieceList;
+        }
+        // Divide()
+        //
+        // Summary:
+        // Compile time Divide() with a single character delimiter
+        //
+        // Arguments:
+        // FixedStringCls Str  --- In (template argument)
+        // char Ch             --- In (template argument)
+        //
+        // Returns:
+        // std::array<std::string_view, piece count>
+        template<FixedStringCls Str, char Ch>
+        constexpr auto Divide()
+        {
+            constexpr FixedStringCls<1> delimiter = []()
+            {
+                FixedStringCls<1> result;
+                result[0] = Ch;
+                return result;
+            }();
+            return Divide<Str, delimiter>();
+        }
+
+        // IntegralToString()
+        //
+        // Summary:
+        // Compile time IntegralToString()
+        //
+        // Arguments:
+        // auto Value  --- In (template argument, integral type)
+        //
+        // Returns:
+        // FixedStringCls<digit count>
+        template<auto Value>
+            requires FormattableIntegral<decltype(Value)>
+        constexpr auto IntegralToString()
+        {
+            constexpr auto formatted = []()
+            {
+                std::array<char, MAX_INTEGRAL_CHARS<decltype(Value)>> buffer{};
+                size_t size = FormatIntegral(Value, buffer.data());
+                return std::pair(buffer, size);
+            }();
+            return FixedStringCls<formatted.second>(std::string_view(formatted.first.data(), formatted.second));
+        }
+
+        // Sizes and alphabets of the compile time Base64 functions, same rules as Base64Pkg.h
+        constexpr size_t GetConstexprEncodedBase64Size(size_t size, Base64Alphabet alphabet)
+        {
+            if (alphabet == Base64Alphabet::Standard)
+            {
+                return (size + 2) / 3 * 4;
+            }
+            return size / 3 * 4 + (size % 3 == 0 ? 0 : size % 3 + 1);
+        }
+        constexpr std::string_view GetBase64Chars(Base64Alphabet alphabet)
+        {
+            return alphabet == Base64Alphabet::Standard ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+                                                        : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+        }
+        // Returns decoded size of in, or std::string_view::npos if in is not valid Base64 of the alphabet
+        constexpr size_t GetConstexprDecodedBase64Size(std::string_view in, Base64Alphabet alphabet)
+        {
+            size_t padding = 0;
+            while (padding < 2 && padding < in.size() && in[in.size() - 1 - padding] == '=')
+            {
+                padding++;
+            }
+            if (padding != 0 && in.size() % 4 != 0)
+            {
+                return std::string_view::npos;
+            }
+
+            size_t size = in.size() - padding;
+            if (size % 4 == 1)
+            {
+                return std::string_view::npos;
+            }
+            for (size_t i = 0; i < size; i++)
+            {
+                if (GetBase64Chars(alphabet).find(in[i]) == std::string_view::npos)
+                {
+                    return std::string_view::npos;
+                }
+            }
+            return size / 4 * 3 + (size % 4 > 1 ? size % 4 - 1 : 0);
+        }
+
+        // EncodeBase64()
+        //
+        // Summary:
+        // Compile time EncodeBase64()
+        //
+        // Arguments:
+        // FixedStringCls Str        --- In (template argument)
+        // Base64Alphabet Alphabet   --- In (template argument, default Base64Alphabet::Standard)
+        //
+        // Returns:
+        // FixedStringCls<encoded length>
+        template<FixedStringCls Str, Base64Alphabet Alphabet = Base64Alphabet::Standard>
+        constexpr auto EncodeBase64()
+        {
+            constexpr std::string_view chars = GetBase64Chars(Alphabet);
+            FixedStringCls<GetConstexprEncodedBase64Size(Str.size(), Alphabet)> result;
+
+            size_t out = 0;
+            for (size_t i = 0; i < Str.size(); i += 3)
+            {
+                size_t rest = Str.size() - i < 3 ? Str.size() - i : 3;
+                uint32_t value = static_cast<uint32_t>(static_cast<unsigned char>(Str[i])) << 16;
+                if (rest > 1)
+                {
+                    value |= static_cast<uint32_t>(static_cast<unsigned char>(Str[i + 1])) << 8;
+                }
+                if (rest > 2)
+                {
+                    value |= static_cast<uint32_t>(static_cast<unsigned char>(Str[i + 2]));
+                }
+
+                for (size_t j = 0; j <= rest; j++)
+                {
+                    result[out++] = chars[(value >> (18 - 6 * j)) & 0x3F];
+                }
+                for (size_t j = rest; j < 3 && Alphabet == Base64Alphabet::Standard; j++)
+                {
+                    result[out++] = '=';
+                }
+            }
+            return result;
+        }
+        // DecodeBase64()
+        //
+        // Summary:
+        // Compile time DecodeBase64(), invalid input is a compile error
+        //
+        // Arguments:
+        // FixedStringCls Str        --- In (template argument)
+        // Base64Alphabet Alphabet   --- In (template argument, default Base64Alphabet::Standard)
+        //
+        // Returns:
+        // FixedStringCls<decoded length>
+        template<FixedStringCls Str, Base64Alphabet Alphabet = Base64Alphabet::Standard>
+        constexpr auto DecodeBase64()
+        {
+            constexpr size_t size = GetConstexprDecodedBase64Size(Str, Alphabet);
+            static_assert(size != std::string_view::npos, "Str is not valid Base64");
+
+            constexpr std::string_view chars = GetBase64Chars(Alphabet);
+            FixedStringCls<size> result;
+
+            uint32_t value = 0;
+            size_t bits = 0;
+            size_t out = 0;
+            for (size_t i = 0; out < size; i++)
+            {
+                value = (value << 6) | static_cast<uint32_t>(chars.find(Str[i]));
+                bits += 6;
+                if (bits >= 8)
+                {
+                    bits -= 8;
+                    result[out++] = static_cast<char>((value >> bits) & 0xFF);
+                }
+            }
+            return result;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef CPUFEATUREPKG_H
+#define CPUFEATUREPKG_H
+
+#include <cstdint>
+
+// UTILITYLIB_X86 is defined when compiling for 32 or 64 bit x86
+// SIMD kernels are only compiled when it is defined, other targets use scalar code
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define UTILITYLIB_X86 1
+#endif
+
+// UTILITYLIB_TARGET(features)
+// Allows a single function to use instructions above the baseline of the translation unit
+// MSVC does not need it, intrinsics can be used without any compiler flag
+#if defined(_MSC_VER) && !defined(__clang__)
+#define UTILITYLIB_TARGET(features)
+#else
+#define UTILITYLIB_TARGET(features) __attribute__((target(features)))
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Widest vector instruction set that is usable for byte scanning kernels
+        enum class SimdLevel
+        {
+            Scalar = 0,
+            Sse2,
+            Avx2,
+            Avx512Bw
+        };
+
+        // Instruction set extensions that are supported by both the CPU and the operating system
+        struct CpuFeatureStc
+        {
+            bool Sse2;
+            bool Ssse3;
+            bool Sse41;
+            bool Sse42;
+            bool Pclmul;
+            bool Popcnt;
+            bool Avx2;
+            bool Bmi2;
+            bool Avx512F;
+            bool Avx512Bw;
+            bool Avx512Vl;
+        };
+
+        // GetCpuFeatures()
+        //
+        // Summary:
+        // Returns the instruction set extensions available on this machine
+        // cpuid is executed only once, on the first call
+        //
+        // Arguments:
+        //
+        // Returns:
+        // const CpuFeatureStc&
+        const CpuFeatureStc& GetCpuFeatures();
+
+        // GetSimdLevel()
+        //
+        // Summary:
+        // Returns the widest SIMD level that kernels of this library will use on this machine
+        //
+        // Arguments:
+        //
+        // Returns:
+        // SimdLevel
+        SimdLevel GetSimdLevel();
+    }
+}
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef ENDPOINTCLS_H
+#define ENDPOINTCLS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "InlineStringCls.h"
+#include "IpAddressCls.h"
+#include "StringPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Longest text forms, "65535" and "[ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255]:65535"
+        constexpr size_t MAX_PORT_CHARS = 5;
+        constexpr size_t MAX_ENDPOINT_CHARS = MAX_IP_ADDRESS_CHARS + MAX_PORT_CHARS + 3;
+
+        // ParsePort()
+        //
+        // Summary:
+        // Parses a decimal port number, the whole string must be digits
+        //
+        // Arguments:
+        // std::string_view str  --- In
+        // uint16_t& port        --- Out (not changed on failure)
+        //
+        // Returns:
+        // StringError (InvalidArgument if str is not a number, OutOfRange if it is above 65535)
+        StringError ParsePort(std::string_view str, uint16_t& port);
+
+        // IP address and port pair, port is kept in host order
+        //
+        // Text form is "a.b.c.d:port" for IPv4 and "[address]:port" for IPv6
+        //
+        // EndpointCls endpoint;
+        // if (EndpointCls::Parse("10.0.0.1", "69", endpoint) == StringError::Success) { ... }
+        class EndpointCls
+        {
+        private:
+            IpAddressCls Address;
+            uint16_t Port;
+
+        public:
+            // Default constructed endpoint is 0.0.0.0:0
+            EndpointCls();
+
+            // Constructor
+            //
+            // Arguments:
+            // const IpAddressCls& address  --- In
+            // uint16_t port                --- In
+            EndpointCls(const IpAddressCls& address, uint16_t port);
+
+            // Parse()
+            //
+            // Summary:
+            // Parses "a.b.c.d:port" or "[address]:port"
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            // EndpointCls& out      --- Out (not changed on failure)
+            //
+            // Returns:
+            // StringError
+            static StringError Parse(std::string_view str, EndpointCls& out);
+
+            // Parse()
+            //
+            // Summary:
+            // Parses an address and a port given separately
+            //
+            // Arguments:
+            // std::string_view ipAddress  --- In (empty means 0.0.0.0)
+            // std::string_view port       --- In
+            // EndpointCls& out            --- Out (not changed on failure)
+            //
+            // Returns:
+            // StringError
+            static StringError Parse(std::string_view ipAddress, std::string_view port, EndpointCls& out);
+
+            const IpAddressCls& GetAddress() const;
+            uint16_t GetPort() const;
+            void SetAddress(const IpAddressCls& address);
+            void SetPort(uint16_t port);
+
+            // Format()
+            //
+            // Summary:
+            // Writes text form of the endpoint into buffer, no null terminator is written
+            //
+            // Arguments:
+            // char* buffer  --- Out (must have room for MAX_ENDPOINT_CHARS characters)
+            //
+            // Returns:
+            // size_t (number of characters written)
+            size_t Format(char* buffer) const;
+
+            // ToString()
+            //
+            // Summary:
+            // Returns text form of the endpoint
+            //
+            // Arguments:
+            //
+            // Returns:
+            // InlineStringCls<MAX_ENDPOINT_CHARS>
+            InlineStringCls<MAX_ENDPOINT_CHARS> ToString() const;
+
+            bool operator==(const EndpointCls& other) const;
+        };
+    }
+}
+
+#endif
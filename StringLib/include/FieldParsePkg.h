@@ -0,0 +1,110 @@
+#ifndef FIELDPARSEPKG_H
+#define FIELDPARSEPKG_H
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "StringPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        struct FieldParseResultStc
+        {
+            StringError Error; // Success, InvalidArgument (empty field or not a number), OutOfRange (value or output does not fit)
+            size_t FieldIndex; // Number of parsed fields on success, index of the first bad field on failure
+            size_t Offset;     // Offset of the first character of the bad field, size of the input on success
+        };
+
+        // Bulk parsing of delimited numbers
+        //
+        // Fields are separated by the delimiter or by line breaks ("\n" or "\r\n"), so a whole file can be parsed at once
+        // A line break at the very end of the input is allowed, every other empty field is an error
+        // Fields must be numbers and nothing else: no spaces, no '+' sign, '-' only for signed types
+        //
+        // Separators are located 64 bytes at a time with SSE2, AVX2 or AVX-512BW (picked once through cpuid),
+        // integers are converted 8 digits at a time with SWAR arithmetic, floating point numbers with std::from_chars
+        //
+        // Parsing stops at the first bad field, values of the fields before it are already stored
+        //
+        // Instantiated for the standard integer types (signed char to unsigned long long), float and double,
+        // other types (char, wchar_t, char8_t, long double, ...) are rejected at compile time
+
+        template<typename T>
+        concept FieldParseIntegral =
+            std::same_as<T, signed char> || std::same_as<T, unsigned char> ||
+            std::same_as<T, short> || std::same_as<T, unsigned short> ||
+            std::same_as<T, int> || std::same_as<T, unsigned int> ||
+            std::same_as<T, long> || std::same_as<T, unsigned long> ||
+            std::same_as<T, long long> || std::same_as<T, unsigned long long>;
+
+        template<typename T>
+        concept FieldParseFloating = std::same_as<T, float> || std::same_as<T, double>;
+
+        // ParseIntegralFields()
+        //
+        // Summary:
+        // Parses every field of str, appending the values to values
+        //
+        // Arguments:
+        // std::string_view str    --- In
+        // char delimiter          --- In
+        // std::vector<T>& values  --- Out (T must be a standard integer type, values are appended)
+        //
+        // Returns:
+        // FieldParseResultStc
+        template<FieldParseIntegral T>
+        FieldParseResultStc ParseIntegralFields(std::string_view str, char delimiter, std::vector<T>& values);
+
+        // ParseIntegralFields()
+        //
+        // Summary:
+        // Parses every field of str into a caller provided span
+        //
+        // Arguments:
+        // std::string_view str   --- In
+        // char delimiter         --- In
+        // std::span<T> values    --- Out (T must be a standard integer type)
+        //
+        // Returns:
+        // FieldParseResultStc (StringError::OutOfRange at the first field that does not fit into values)
+        template<FieldParseIntegral T>
+        FieldParseResultStc ParseIntegralFields(std::string_view str, char delimiter, std::span<T> values);
+
+        // ParseFloatingFields()
+        //
+        // Summary:
+        // Parses every field of str as a floating point number (fixed or scientific notation), appending the values to values
+        //
+        // Arguments:
+        // std::string_view str    --- In
+        // char delimiter          --- In
+        // std::vector<T>& values  --- Out (T must be float or double, values are appended)
+        //
+        // Returns:
+        // FieldParseResultStc
+        template<FieldParseFloating T>
+        FieldParseResultStc ParseFloatingFields(std::string_view str, char delimiter, std::vector<T>& values);
+
+        // ParseFloatingFields()
+        //
+        // Summary:
+        // Parses every field of str as a floating point number into a caller provided span
+        //
+        // Arguments:
+        // std::string_view str   --- In
+        // char delimiter         --- In
+        // std::span<T> values    --- Out (T must be float or double)
+        //
+        // Returns:
+        // FieldParseResultStc (StringError::OutOfRange at the first field that does not fit into values)
+        template<FieldParseFloating T>
+        FieldParseResultStc ParseFloatingFields(std::string_view str, char delimiter, std::span<T> values);
+    }
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef FIXEDSTRINGCLS_H
+#define FIXEDSTRINGCLS_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // String of exactly N characters (plus a null terminator) that can be used as a template argument
+        //
+        // Every member is public and the class has no pointers, so it is a structural type:
+        // functions can take it as a non-type template parameter and compute their results at compile time
+        // (Trim<"  octet ">(), Divide<"a,b,c", ','>() ... in ConstexprPkg.h)
+        // Embedded null characters are kept, the length comes from the array, not from the first '\0'
+        //
+        // template<FixedStringCls Name> struct FieldCls { ... };
+        // FieldCls<"filename"> field;
+        // constexpr FixedStringCls packet = FixedStringCls("\0\x01") + FixedStringCls("octet");
+        template<size_t N>
+        class FixedStringCls
+        {
+        public:
+            char Data[N + 1]{};
+
+            constexpr FixedStringCls() = default;
+
+            // Constructor
+            //
+            // Arguments:
+            // const char (&str)[N + 1]  --- In (string literal)
+            constexpr FixedStringCls(const char (&str)[N + 1])
+            {
+                for (size_t i = 0; i < N; i++)
+                {
+                    Data[i] = str[i];
+                }
+            }
+
+            // Constructor
+            //
+            // Arguments:
+            // std::string_view str  --- In (first N characters are kept, shorter input is padded with '\0')
+            constexpr explicit FixedStringCls(std::string_view str)
+            {
+                for (size_t i = 0; i < N && i < str.size(); i++)
+                {
+                    Data[i] = str[i];
+                }
+            }
+
+            static constexpr size_t size() { return N; }
+            static constexpr bool empty() { return N == 0; }
+
+            constexpr const char* data() const { return Data; }
+            constexpr char* data() { return Data; }
+            constexpr const char* c_str() const { return Data; }
+
+            constexpr const char* begin() const { return Data; }
+            constexpr const char* end() const { return Data + N; }
+
+            constexpr char operator[](size_t index) const { return Data[index]; }
+            constexpr char& operator[](size_t index) { return Data[index]; }
+
+            constexpr operator std::string_view() const
+            {
+                return std::string_view(Data, N);
+            }
+
+            template<size_t M>
+            constexpr bool operator==(const FixedStringCls<M>& other) const
+            {
+                return std::string_view(*this) == std::string_view(other);
+            }
+
+            // operator+()
+            //
+            // Summary:
+            // Concatenates two fixed strings, the length of the result is known at compile time
+            //
+            // Arguments:
+            // const FixedStringCls<M>& other  --- In
+            //
+            // Returns:
+            // FixedStringCls<N + M>
+            template<size_t M>
+            constexpr FixedStringCls<N + M> operator+(const FixedStringCls<M>& other) const
+            {
+                FixedStringCls<N + M> result;
+                for (size_t i = 0; i < N; i++)
+                {
+                    result.Data[i] = Data[i];
+                }
+                for (size_t i = 0; i < M; i++)
+                {
+                    result.Data[N + i] = other.Data[i];
+                }
+                return result;
+            }
+        };
+
+        template<size_t N>
+        FixedStringCls(const char (&)[N]) -> FixedStringCls<N - 1>;
+    }
+}
+
+#endif
@@ -0,0 +1,569 @@
+#ifndef FORMATPKG_H
+#define FORMATPKG_H
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "FixedStringCls.h"
+#include "HexPkg.h"
+#include "InlineStringCls.h"
+#include "NumberPkg.h"
+#include "StringPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Formatting into caller provided buffers, the format string is parsed and checked at compile time
+        //
+        // char line[128];
+        // size_t size = 0;
+        // Format<"{}:{} sent {} bytes ({:.1f} ms), checksum {:#010x}">(line, size, address, port, count, elapsed, crc);
+        //
+        // InlineStringCls<64> name;
+        // Format<"{:>8}|{:<6}|">(name, "octet", 512);
+        //
+        // Replacement fields are "{}" or "{:spec}", "{{" and "}}" are literal braces, fields take the arguments in order
+        // spec is [[fill]align][#][0][width][.precision][type]:
+        // align      '<' left, '>' right, '^' center (numbers are right aligned and text is left aligned by default)
+        // #          "0x" / "0b" prefix for hex and binary integers
+        // 0          pads numbers with zeros after the sign and the prefix
+        // precision  digits of floating point numbers (6 for the f e g types when not given), maximum number of characters of text
+        // type       integers: d x X b, char: c d x X b, floating point: f e g, text: s x X (hex of the bytes), bool: s
+        //
+        // Floating point numbers without type and precision use the shortest round trip representation (FormatFloating())
+        // inf and NaN are never zero padded, '0' pads them with spaces like std::format()
+        // Negative integers are written as two's complement in hex and binary, like printf()
+        //
+        // A malformed format string, a wrong number of arguments or a spec that does not fit the argument type is a compile error
+        // Formatting does not allocate, it writes straight into the buffer and only builds numbers in a small stack buffer
+        // Output that does not fit is cut at the end of the buffer and reported with StringError::OutOfRange
+
+        // Precision of a field that has none
+        inline constexpr size_t FORMAT_NO_PRECISION = SIZE_MAX;
+
+        // Largest precision a field can have
+        inline constexpr size_t MAX_FORMAT_PRECISION = 64;
+
+        // Precision of the 'f', 'e' and 'g' types when the field has none, same as printf() and std::format()
+        inline constexpr size_t DEFAULT_FORMAT_PRECISION = 6;
+
+        // Longest fixed notation of a double without the fraction digits: sign, 309 digits of DBL_MAX and the point
+        inline constexpr size_t MAX_FIXED_FLOATING_CHARS = 311;
+
+        enum class FormatParseError
+        {
+            None = 0,
+            UnmatchedBrace, // '{' without '}', or a single '}'
+            InvalidSpec     // Unknown character in a spec, or an argument index (not supported)
+        };
+
+        // Replacement field of a format string
+        struct FormatSpecStc
+        {
+            size_t LiteralOffset; // Literal text before the field, in ParsedFormatStc::Text
+            size_t LiteralSize;
+            char Fill;
+            char Align;           // '\0' for the default of the argument type
+            bool IsAlternate;
+            bool IsZeroPad;
+            size_t Width;
+            size_t Precision;     // FORMAT_NO_PRECISION if not given
+            char Type;            // '\0' for the default of the argument type
+        };
+
+        // Format string split into literal text and fields
+        template<size_t N>
+        struct ParsedFormatStc
+        {
+            char Text[N + 1];                     // Literal text of the format string, escaped braces are single ones
+            size_t TextSize;
+            FormatSpecStc FieldList[N / 2 + 1];   // Every field takes at least 2 characters
+            size_t FieldCount;
+            FormatParseError Error;
+        };
+
+        // ParseFormat()
+        //
+        // Summary:
+        // Splits a format string into literal text and fields, used by Format() at compile time
+        //
+        // Arguments:
+        // const FixedStringCls<N>& format  --- In
+        //
+        // Returns:
+        // ParsedFormatStc<N> (Error is set for a malformed format string)
+        template<size_t N>
+        constexpr ParsedFormatStc<N> ParseFormat(const FixedStringCls<N>& format)
+        {
+            ParsedFormatStc<N> parsed{};
+            size_t literalStart = 0;
+            size_t i = 0;
+
+            while (i < N)
+            {
+                char ch = format[i];
+                if (ch == '}')
+                {
+                    if (i + 1 == N || format[i + 1] != '}')
+                    {
+                        parsed.Error = FormatParseError::UnmatchedBrace;
+                        return parsed;
+                    }
+                    parsed.Text[parsed.TextSize++] = '}';
+                    i += 2;
+                    continue;
+                }
+                if (ch != '{')
+                {
+                    parsed.Text[parsed.TextSize++] = ch;
+                    i++;
+                    continue;
+                }
+                if (i + 1 < N && format[i + 1] == '{')
+                {
+                    parsed.Text[parsed.TextSize++] = '{';
+                    i += 2;
+                    continue;
+                }
+
+                FormatSpecStc spec{ literalStart, parsed.TextSize - literalStart, ' ', '\0', false, false, 0, FORMAT_NO_PRECISION, '\0' };
+                i++;
+                if (i < N && format[i] == ':')
+                {
+                    i++;
+                    auto isAlign = [](char value) { return value == '<' || value == '>' || value == '^'; };
+                    if (i + 1 < N && isAlign(format[i + 1]) && format[i] != '{' && format[i] != '}')
+                    {
+                        spec.Fill = format[i];
+                        spec.Align = format[i + 1];
+                        i += 2;
+                    }
+                    else if (i < N && isAlign(format[i]))
+                    {
+                        spec.Align = format[i];
+                        i++;
+                    }
+                    if (i < N && format[i] == '#')
+                    {
+                        spec.IsAlternate = true;
+                        i++;
+                    }
+                    if (i < N && format[i] == '0')
+                    {
+                        spec.IsZeroPad = true;
+                        i++;
+                    }
+                    for (; i < N && format[i] >= '0' && format[i] <= '9'; i++)
+                    {
+                        spec.Width = spec.Width * 10 + static_cast<size_t>(format[i] - '0');
+                    }
+                    if (i < N && format[i] == '.')
+                    {
+                        i++;
+                        if (i == N || format[i] < '0' || format[i] > '9')
+                        {
+                            parsed.Error = FormatParseError::InvalidSpec;
+                            return parsed;
+                        }
+                        spec.Precision = 0;
+                        for (; i < N && format[i] >= '0' && format[i] <= '9'; i++)
+                        {
+                            spec.Precision = spec.Precision * 10 + static_cast<size_t>(format[i] - '0');
+                        }
+                    }
+                    if (i < N && std::string_view("dxXbcfegs").find(format[i]) != std::string_view::npos)
+                    {
+                        spec.Type = format[i];
+                        i++;
+                    }
+                }
+
+                if (i == N)
+                {
+                    parsed.Error = FormatParseError::UnmatchedBrace;
+                    return parsed;
+                }
+                if (format[i] != '}')
+                {
+                    parsed.Error = FormatParseError::InvalidSpec;
+                    return parsed;
+                }
+                i++;
+
+                parsed.FieldList[parsed.FieldCount++] = spec;
+                literalStart = parsed.TextSize;
+            }
+
+            return parsed;
+        }
+
+        // Parsed form of every format string is a constant of its own
+        template<FixedStringCls Fmt>
+        inline constexpr ParsedFormatStc<Fmt.size()> PARSED_FORMAT = ParseFormat(Fmt);
+
+        // Output of Format(), keeps writing into a buffer of fixed capacity and remembers whether anything was cut
+        class FormatOutputCls
+        {
+        private:
+            char* Data;
+            size_t Capacity;
+            size_t Size;
+            bool IsCut;
+            bool IsFailed;
+
+        public:
+            constexpr FormatOutputCls(char* data, size_t capacity) :
+                Data(data),
+                Capacity(capacity),
+                Size(0),
+                IsCut(false),
+                IsFailed(false)
+            {
+            }
+
+            constexpr void Write(const char* str, size_t size)
+            {
+                if (size > Capacity - Size)
+                {
+                    size = Capacity - Size;
+                    IsCut = true;
+                }
+                std::char_traits<char>::copy(Data + Size, str, size);
+                Size += size;
+            }
+            constexpr void Write(std::string_view str)
+            {
+                Write(str.data(), str.size());
+            }
+            constexpr void WriteRepeated(char ch, size_t count)
+            {
+                if (count > Capacity - Size)
+                {
+                    count = Capacity - Size;
+                    IsCut = true;
+                }
+                std::char_traits<char>::assign(Data + Size, count, ch);
+                Size += count;
+            }
+
+            // Room for count more characters, nullptr if there is less (nothing is written then)
+            constexpr char* Reserve(size_t count)
+            {
+                return count <= Capacity - Size ? Data + Size : nullptr;
+            }
+            constexpr void Commit(size_t count)
+            {
+                Size += count;
+            }
+
+            constexpr size_t GetSize() const
+            {
+                return Size;
+            }
+            constexpr bool IsTruncated() const
+            {
+                return IsCut;
+            }
+
+            // A field that could not be converted, Format() reports it with StringError::InvalidArgument
+            constexpr void SetFailed()
+            {
+                IsFailed = true;
+            }
+            constexpr bool HasFailed() const
+            {
+                return IsFailed;
+            }
+        };
+
+        // FormatFloatingSpec()
+        //
+        // Summary:
+        // Writes a floating point field of Format(), type is '\0', 'f', 'e' or 'g'
+        //
+        // Arguments:
+        // float/double value  --- In
+        // char type           --- In
+        // size_t precision    --- In (FORMAT_NO_PRECISION for the shortest round trip representation in the notation of type)
+        // std::span<char> out --- Out
+        //
+        // Returns:
+        // size_t (number of characters written, 0 if out is too small)
+        size_t FormatFloatingSpec(float value, char type, size_t precision, std::span<char> out);
+        size_t FormatFloatingSpec(double value, char type, size_t precision, std::span<char> out);
+
+        // WriteFormatPadded()
+        //
+        // Summary:
+        // Writes the text of a field with the fill, alignment and width of its spec
+        // Zero padding goes after the first prefixSize characters (sign and "0x"), so "-0x00ff" keeps its sign in front
+        //
+        // Arguments:
+        // FormatOutputCls& out    --- In/Out
+        // const char* text        --- In
+        // size_t size             --- In
+        // size_t prefixSize       --- In
+        // bool isNumber           --- In (numbers are right aligned by default)
+        // bool isZeroPadAllowed   --- In (default true, false for inf and NaN, which get the fill character instead)
+        //
+        // Returns:
+        template<FormatSpecStc Spec>
+        constexpr void WriteFormatPadded(FormatOutputCls& out, const char* text, size_t size, size_t prefixSize, bool isNumber, bool isZeroPadAllowed = true)
+        {
+            if (size >= Spec.Width)
+            {
+                out.Write(text, size);
+                return;
+            }
+
+            size_t padSize = Spec.Width - size;
+            if (Spec.IsZeroPad && isNumber && isZeroPadAllowed && Spec.Align == '\0')
+            {
+                out.Write(text, prefixSize);
+                out.WriteRepeated('0', padSize);
+                out.Write(text + prefixSize, size - prefixSize);
+                return;
+            }
+
+            char align = Spec.Align != '\0' ? Spec.Align : (isNumber ? '>' : '<');
+            size_t leftSize = align == '>' ? padSize : (align == '^' ? padSize / 2 : 0);
+            out.WriteRepeated(Spec.Fill, leftSize);
+            out.Write(text, size);
+            out.WriteRepeated(Spec.Fill, padSize - leftSize);
+        }
+
+        // Writes the digits of value in base 2 or 16 backwards from "last", returns the first character
+        template<std::unsigned_integral T>
+        constexpr char* FormatIntegralBase(T value, char* last, unsigned int shift, const char* digits)
+        {
+            const T mask = static_cast<T>((1u << shift) - 1);
+            do
+            {
+                *--last = digits[static_cast<size_t>(value & mask)];
+                value = static_cast<T>(value >> shift);
+            } while (value != 0);
+            return last;
+        }
+
+        // FormatField()
+        //
+        // Summary:
+        // Writes a single argument of Format() according to its spec, the spec is checked against the argument type here
+        //
+        // Arguments:
+        // FormatOutputCls& out  --- In/Out
+        // const T& value        --- In
+        //
+        // Returns:
+        template<FormatSpecStc Spec, typename T>
+        constexpr void FormatField(FormatOutputCls& out, const T& value)
+        {
+            using ValueType = std::remove_cvref_t<T>;
+            constexpr char type = Spec.Type;
+
+            if constexpr (std::same_as<ValueType, bool>)
+            {
+                static_assert(type == '\0' || type == 's', "bool field only takes the 's' type");
+                static_assert(Spec.IsAlternate == false && Spec.IsZeroPad == false && Spec.Precision == FORMAT_NO_PRECISION, "bool field takes no '#', '0' or precision");
+                std::string_view text = value ? "true" : "false";
+                WriteFormatPadded<Spec>(out, text.data(), text.size(), 0, false);
+            }
+            else if constexpr (std::same_as<ValueType, char> && (type == '\0' || type == 'c'))
+            {
+                static_assert(Spec.IsAlternate == false && Spec.IsZeroPad == false && Spec.Precision == FORMAT_NO_PRECISION, "char field takes no '#', '0' or precision");
+                WriteFormatPadded<Spec>(out, &value, 1, 0, false);
+            }
+            else if constexpr (FormattableIntegral<ValueType>)
+            {
+                static_assert(type == '\0' || type == 'd' || type == 'x' || type == 'X' || type == 'b', "Integer field only takes the 'd', 'x', 'X' and 'b' types");
+                static_assert(Spec.Precision == FORMAT_NO_PRECISION, "Integer field takes no precision");
+                static_assert(Spec.IsAlternate == false || type == 'x' || type == 'X' || type == 'b', "'#' is only for hex and binary integers");
+
+                // Binary of the widest type, its prefix and a sign
+                char buffer[sizeof(ValueType) * 8 + 3];
+                char* last = buffer + sizeof(buffer);
+                char* first = last;
+                size_t prefixSize = 0;
+
+                if constexpr (type == '\0' || type == 'd')
+                {
+                    // char is printed as a number, with the sign of plain char on this platform
+                    using NumberType = std::conditional_t<std::same_as<ValueType, char>, int, ValueType>;
+                    first = buffer;
+                    last = buffer + FormatIntegral(static_cast<NumberType>(value), buffer);
+                    prefixSize = *first == '-' ? 1 : 0;
+                }
+                else
+                {
+                    using UnsignedType = std::make_unsigned_t<ValueType>;
+                    constexpr unsigned int shift = type == 'b' ? 1 : 4;
+                    constexpr const char* digits = type == 'X' ? "0123456789ABCDEF" : "0123456789abcdef";
+                    first = FormatIntegralBase(static_cast<UnsignedType>(value), last, shift, digits);
+                    if constexpr (Spec.IsAlternate)
+                    {
+                        *--first = type == 'b' ? 'b' : (type == 'X' ? 'X' : 'x');
+                        *--first = '0';
+                        prefixSize = 2;
+                    }
+                }
+                WriteFormatPadded<Spec>(out, first, static_cast<size_t>(last - first), prefixSize, true);
+            }
+            else if constexpr (std::floating_point<ValueType>)
+            {
+                static_assert(type == '\0' || type == 'f' || type == 'e' || type == 'g', "Floating point field only takes the 'f', 'e' and 'g' types");
+                static_assert(Spec.IsAlternate == false, "Floating point field takes no '#'");
+                static_assert(Spec.Precision == FORMAT_NO_PRECISION || Spec.Precision <= MAX_FORMAT_PRECISION, "Precision is larger than MAX_FORMAT_PRECISION");
+                using FloatType = std::conditional_t<std::same_as<ValueType, float>, float, double>;
+
+                // Only a field without type and precision is written as the shortest round trip, so fixed notation always has
+                // a precision and the buffer holds the worst case, the 309 digits of DBL_MAX (5e-324 is "0.000000" with 'f')
+                constexpr size_t precision = Spec.Precision != FORMAT_NO_PRECISION ? Spec.Precision : (type == '\0' ? FORMAT_NO_PRECISION : DEFAULT_FORMAT_PRECISION);
+                constexpr size_t bufferSize = (type == 'f' ? MAX_FIXED_FLOATING_CHARS : MAX_FLOATING_CHARS) + (precision == FORMAT_NO_PRECISION ? 0 : precision);
+                char buffer[bufferSize];
+                size_t size = FormatFloatingSpec(static_cast<FloatType>(value), type, precision, std::span<char>(buffer, bufferSize));
+                if (size == 0)
+                {
+                    out.SetFailed();
+                    return;
+                }
+                WriteFormatPadded<Spec>(out, buffer, size, buffer[0] == '-' ? 1 : 0, true, std::isfinite(value));
+            }
+            else if constexpr (std::convertible_to<const T&, std::string_view>)
+            {
+                static_assert(type == '\0' || type == 's' || type == 'x' || type == 'X', "Text field only takes the 's', 'x' and 'X' types");
+                static_assert(Spec.IsAlternate == false && Spec.IsZeroPad == false, "Text field takes no '#' or '0'");
+                std::string_view text = value;
+                if constexpr (Spec.Precision != FORMAT_NO_PRECISION)
+                {
+                    text = text.substr(0, Spec.Precision);
+                }
+
+                if constexpr (type == 'x' || type == 'X')
+                {
+                    size_t hexSize = 2 * text.size();
+                    size_t padSize = hexSize < Spec.Width ? Spec.Width - hexSize : 0;
+                    size_t leftSize = Spec.Align == '>' ? padSize : (Spec.Align == '^' ? padSize / 2 : 0);
+                    out.WriteRepeated(Spec.Fill, leftSize);
+
+                    char* hex = out.Reserve(hexSize);
+                    if (std::is_constant_evaluated() == false && hex != nullptr)
+                    {
+                        out.Commit(EncodeHex(text, hex, type == 'X' ? HexCase::Upper : HexCase::Lower));
+                    }
+                    else
+                    {
+                        constexpr const char* digits = type == 'X' ? "0123456789ABCDEF" : "0123456789abcdef";
+                        for (char ch : text)
+                        {
+                            char pair[2] = { digits[static_cast<unsigned char>(ch) >> 4], digits[static_cast<unsigned char>(ch) & 0x0F] };
+                            out.Write(pair, 2);
+                        }
+                    }
+                    out.WriteRepeated(Spec.Fill, padSize - leftSize);
+                }
+                else
+                {
+                    WriteFormatPadded<Spec>(out, text.data(), text.size(), 0, false);
+                }
+            }
+            else
+            {
+                static_assert(sizeof(T) == 0, "Argument type is not supported by Format(), use integers, floating point numbers, bool or text");
+            }
+        }
+
+        // Writes the literal text and the field of every argument, then the literal text after the last field
+        template<FixedStringCls Fmt, size_t... Index, typename... Args>
+        constexpr void FormatAll(FormatOutputCls& out, std::index_sequence<Index...>, const Args&... args)
+        {
+            constexpr const auto& parsed = PARSED_FORMAT<Fmt>;
+            (
+                (out.Write(parsed.Text + parsed.FieldList[Index].LiteralOffset, parsed.FieldList[Index].LiteralSize),
+                 FormatField<parsed.FieldList[Index]>(out, args)),
+                ...);
+
+            constexpr size_t tailOffset = parsed.FieldCount == 0 ? 0 : parsed.FieldList[parsed.FieldCount - 1].LiteralOffset + parsed.FieldList[parsed.FieldCount - 1].LiteralSize;
+            out.Write(parsed.Text + tailOffset, parsed.TextSize - tailOffset);
+        }
+
+        // Compile time checks of the format string against the arguments
+        template<FixedStringCls Fmt, typename... Args>
+        constexpr void CheckFormat()
+        {
+            constexpr const auto& parsed = PARSED_FORMAT<Fmt>;
+            static_assert(parsed.Error != FormatParseError::UnmatchedBrace, "Format string has a '{' without '}' or a single '}' (use \"{{\" and \"}}\" for braces)");
+            static_assert(parsed.Error != FormatParseError::InvalidSpec, "Format string has an invalid field spec");
+            static_assert(parsed.Error != FormatParseError::None || parsed.FieldCount == sizeof...(Args), "Number of arguments does not match the number of fields");
+        }
+
+        // Format()
+        //
+        // Summary:
+        // Writes the formatted text into a char buffer, followed by a null terminator
+        //
+        // Arguments:
+        // std::span<char> out  --- Out (char array or span, holds out.size() - 1 characters and the terminator)
+        // size_t& size         --- Out (number of characters written, without the terminator)
+        // const Args&... args  --- In
+        //
+        // Returns:
+        // StringError
+        //
+        // On failure:
+        // StringError::OutOfRange is returned when the text does not fit, out holds as much of it as fits (still null terminated)
+        // StringError::InvalidArgument is returned when out is empty, or when a floating point field could not be converted
+        // (the field is left out then)
+        template<FixedStringCls Fmt, typename... Args>
+        constexpr StringError Format(std::span<char> out, size_t& size, const Args&... args)
+        {
+            CheckFormat<Fmt, Args...>();
+            size = 0;
+            if (out.empty())
+            {
+                return StringError::InvalidArgument;
+            }
+
+            FormatOutputCls output(out.data(), out.size() - 1);
+            FormatAll<Fmt>(output, std::index_sequence_for<Args...>(), args...);
+            size = output.GetSize();
+            out[size] = '\0';
+            if (output.HasFailed())
+            {
+                return StringError::InvalidArgument;
+            }
+            return output.IsTruncated() ? StringError::OutOfRange : StringError::Success;
+        }
+
+        // Format()
+        //
+        // Summary:
+        // Replaces the content of an inline string with the formatted text
+        //
+        // Arguments:
+        // InlineStringCls<N>& out  --- Out
+        // const Args&... args      --- In
+        //
+        // Returns:
+        // StringError (StringError::OutOfRange if the text is longer than N, out holds its first N characters)
+        template<FixedStringCls Fmt, size_t N, typename... Args>
+        constexpr StringError Format(InlineStringCls<N>& out, const Args&... args)
+        {
+            CheckFormat<Fmt, Args...>();
+            char buffer[N + 1];
+            size_t size = 0;
+            StringError result = UtilityLib::String::Format<Fmt>(std::span<char>(buffer, N + 1), size, args...);
+            out.assign(std::string_view(buffer, size));
+            return result;
+        }
+    }
+}
+
+#endif
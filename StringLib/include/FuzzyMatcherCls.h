@@ -0,0 +1,126 @@
+#ifndef FUZZYMATCHERCLS_H
+#define FUZZYMATCHERCLS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Levenshtein distance matcher (Myers / Hyyro bit-parallel algorithm)
+        //
+        // Pattern is compiled once into per byte match masks, after that a column of the edit distance matrix
+        // is computed for 64 pattern characters at a time with a handful of word operations
+        // Patterns longer than 64 characters are split into 64 character blocks, with a distance limit
+        // only the blocks inside the diagonal band that can still reach the limit are computed
+        //
+        // Distance is counted in bytes (insertions, deletions and substitutions cost 1, comparison is case sensitive)
+        //
+        // A compiled matcher is immutable, it can be shared between threads
+        //
+        // FuzzyMatcherCls matcher("config.json");
+        // if (matcher.IsMatch("confg.json", 2)) { ... }
+        class FuzzyMatcherCls
+        {
+        private:
+            size_t PatternSize;
+            size_t BlockCount;
+            // MatchMask[ch * BlockCount + block] has bit i set if pattern[block * 64 + i] == ch
+            std::vector<uint64_t> MatchMask;
+
+        public:
+            // Default constructed matcher has an empty pattern, distance to a string is its length
+            FuzzyMatcherCls();
+
+            // Constructor
+            //
+            // Arguments:
+            // std::string_view pattern  --- In
+            explicit FuzzyMatcherCls(std::string_view pattern);
+
+            // Distance()
+            //
+            // Summary:
+            // Returns Levenshtein distance between the pattern and the string
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // size_t
+            size_t Distance(std::string_view str) const;
+
+            // Distance()
+            //
+            // Summary:
+            // Returns Levenshtein distance between the pattern and the string if it is not above maxDistance
+            // Stops as soon as the distance can no longer come down to maxDistance
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            // size_t maxDistance    --- In
+            //
+            // Returns:
+            // size_t (maxDistance + 1 if the distance is above maxDistance)
+            size_t Distance(std::string_view str, size_t maxDistance) const;
+
+            // IsMatch()
+            //
+            // Summary:
+            // Checks if the string is at most maxDistance edits away from the pattern
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            // size_t maxDistance    --- In
+            //
+            // Returns:
+            // bool
+            bool IsMatch(std::string_view str, size_t maxDistance) const;
+
+            // GetPatternSize()
+            //
+            // Summary:
+            // Returns length of the pattern the matcher is compiled for
+            //
+            // Arguments:
+            //
+            // Returns:
+            // size_t
+            size_t GetPatternSize() const;
+        };
+
+        // EditDistance()
+        //
+        // Summary:
+        // Returns Levenshtein distance between two strings
+        // Common prefix and suffix are skipped, the shorter remainder is used as the bit-parallel pattern
+        //
+        // Arguments:
+        // std::string_view first   --- In
+        // std::string_view second  --- In
+        //
+        // Returns:
+        // size_t
+        //
+        // Use FuzzyMatcherCls if the same string is compared against many others
+        size_t EditDistance(std::string_view first, std::string_view second);
+        // EditDistance()
+        //
+        // Summary:
+        // Returns Levenshtein distance between two strings if it is not above maxDistance
+        //
+        // Arguments:
+        // std::string_view first   --- In
+        // std::string_view second  --- In
+        // size_t maxDistance       --- In
+        //
+        // Returns:
+        // size_t (maxDistance + 1 if the distance is above maxDistance)
+        size_t EditDistance(std::string_view first, std::string_view second, size_t maxDistance);
+    }
+}
+
+#endif
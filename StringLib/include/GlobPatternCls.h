@@ -0,0 +1,198 @@
+#ifndef GLOBPATTERNCLS_H
+#define GLOBPATTERNCLS_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ScanPkg.h"
+#include "SearcherCls.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        enum class GlobMode
+        {
+            Text = 0, // '*', '?' and classes match any byte, including '/'
+            Path      // '*', '?' and classes never match '/', every '/' of the pattern must match a '/' of the string
+        };
+
+        // Shell style wildcard pattern (glob)
+        //
+        // Syntax:
+        // *        --- Any number of bytes, including none
+        // ?        --- Exactly one byte
+        // [abc]    --- One byte of the class, ranges are written as a-z, "]" is a member if it comes first
+        // [!abc]   --- One byte that is not in the class ([^abc] is accepted as well)
+        // [:name:] --- Inside a class, one of alnum, alpha, blank, digit, lower, punct, space, upper, xdigit (ASCII only)
+        // \x       --- Byte x itself, even if it is a special character
+        // An unterminated "[" and a trailing "\" are literal bytes
+        //
+        // Pattern is compiled once into literal segments that are separated by '*'
+        // Literal bytes before the first wildcard are compared first, most strings are rejected there
+        // The segment before the first '*' and the one after the last '*' are compared in place (memcmp when they have no
+        // wildcards), segments in between are searched from left to right with a precompiled SearcherCls,
+        // so "*.bin" is a single suffix compare and nothing ever backtracks
+        // In Path mode the pattern is compiled per '/' separated component and the string is split at '/' the same way
+        //
+        // A compiled pattern is immutable, it can be shared between threads
+        //
+        // GlobPatternCls pattern("pxe/*/initrd?", GlobMode::Path);
+        // if (pattern.Match("pxe/debian/initrd0")) { ... }
+        class GlobPatternCls
+        {
+        private:
+            // Element of a segment that is not a literal byte
+            static constexpr uint16_t ANY_BYTE = 256;
+            static constexpr uint16_t FIRST_CLASS = 257;
+
+            struct SegmentStc
+            {
+                std::string Literal;               // Bytes of the segment, '?' and classes are stored as 0
+                std::vector<uint16_t> ElementList; // Empty if the segment is only literal bytes, otherwise one element per byte
+                SearcherCls Searcher;              // Only used for literal segments in between two '*'
+            };
+
+            struct ComponentStc
+            {
+                size_t FirstSegment;
+                size_t SegmentCount; // Segments are separated by '*', first and last one can be empty
+                size_t MinSize;      // Sum of segment sizes
+            };
+
+            std::string Pattern;
+            GlobMode Mode;
+            std::string Prefix;
+            std::vector<SegmentStc> SegmentList;
+            std::vector<ComponentStc> ComponentList;
+            std::vector<ByteSetCls> ClassList;
+
+            void Compile();
+            bool MatchSegment(const SegmentStc& segment, const char* str) const;
+            size_t FindSegment(const SegmentStc& segment, std::string_view str, size_t pos) const;
+            bool MatchComponent(const ComponentStc& component, std::string_view str) const;
+
+        public:
+            // Default constructed pattern is empty, it only matches an empty string
+            GlobPatternCls();
+
+            // Constructor
+            //
+            // Arguments:
+            // std::string_view pattern  --- In
+            // GlobMode mode             --- In (default GlobMode::Text)
+            explicit GlobPatternCls(std::string_view pattern, GlobMode mode = GlobMode::Text);
+
+            // Match()
+            //
+            // Summary:
+            // Checks if the whole string matches the pattern
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // bool
+            bool Match(std::string_view str) const;
+
+            // GetPattern()
+            //
+            // Summary:
+            // Returns the pattern text the matcher is compiled from
+            //
+            // Arguments:
+            //
+            // Returns:
+            // std::string_view
+            std::string_view GetPattern() const;
+        };
+
+        // FilterMatching()
+        //
+        // Summary:
+        // Returns the strings that match the pattern, in their original order
+        //
+        // Arguments:
+        // std::vector<std::string> strList  --- In
+        // GlobPatternCls pattern            --- In
+        //
+        // Returns:
+        // std::vector<std::string>
+        std::vector<std::string> FilterMatching(const std::vector<std::string>& strList, const GlobPatternCls& pattern);
+        // FilterNotMatching()
+        //
+        // Summary:
+        // Returns the strings that do not match the pattern, in their original order
+        //
+        // Arguments:
+        // std::vector<std::string> strList  --- In
+        // GlobPatternCls pattern            --- In
+        //
+        // Returns:
+        // std::vector<std::string>
+        std::vector<std::string> FilterNotMatching(const std::vector<std::string>& strList, const GlobPatternCls& pattern);
+
+        // FilterMatching()
+        //
+        // Summary:
+        // Returns the views of a std::string_view range (SplitViewCls, WordViewCls, std::vector<std::string_view>, ...)
+        // that match the pattern, nothing is copied
+        //
+        // Arguments:
+        // RangeT range            --- In
+        // GlobPatternCls pattern  --- In
+        //
+        // Returns:
+        // std::vector<std::string_view>
+        //
+        // Important: Returned views point into the strings of the range, those must outlive the result
+        template <std::ranges::input_range RangeT>
+            requires std::same_as<std::ranges::range_value_t<RangeT>, std::string_view>
+        std::vector<std::string_view> FilterMatching(RangeT&& range, const GlobPatternCls& pattern)
+        {
+            std::vector<std::string_view> filteredList;
+            for (std::string_view str : range)
+            {
+                if (pattern.Match(str))
+                {
+                    filteredList.push_back(str);
+                }
+            }
+            return filteredList;
+        }
+        // FilterNotMatching()
+        //
+        // Summary:
+        // Returns the views of a std::string_view range that do not match the pattern, nothing is copied
+        //
+        // Arguments:
+        // RangeT range            --- In
+        // GlobPatternCls pattern  --- In
+        //
+        // Returns:
+        // std::vector<std::string_view>
+        //
+        // Important: Returned views point into the strings of the range, those must outlive the result
+        template <std::ranges::input_range RangeT>
+            requires std::same_as<std::ranges::range_value_t<RangeT>, std::string_view>
+        std::vector<std::string_view> FilterNotMatching(RangeT&& range, const GlobPatternCls& pattern)
+        {
+            std::vector<std::string_view> filteredList;
+            for (std::string_view str : range)
+            {
+                if (pattern.Match(str) == false)
+                {
+                    filteredList.push_back(str);
+                }
+            }
+            return filteredList;
+        }
+    }
+}
+
+#endif
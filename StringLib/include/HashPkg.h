@@ -0,0 +1,133 @@
+#ifndef HASHPKG_H
+#define HASHPKG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Non-cryptographic hashing and checksums
+        //
+        // Hash64() is wyhash (final version 4, default secret), a 64 bit hash for hash tables, dedup and cache keys
+        // Results match the reference implementation, so hashes can be stored and compared with other programs
+        // It is not a cryptographic hash, it must not be used where an attacker chooses the input and gains from collisions
+        //
+        // Crc32c() is CRC-32C (Castagnoli, iSCSI / ext4 / SCTP), Crc32() is CRC-32 (IEEE 802.3, zlib / PNG / Ethernet)
+        // Both are picked once through cpuid:
+        // Crc32c() uses the SSE 4.2 crc32 instruction on 3 interleaved streams, Crc32() folds 64 bytes at a time with PCLMULQDQ
+        // Other machines use slice-by-8 tables
+        //
+        // Checksums continue from a previous result, so data that arrives in pieces needs no buffering:
+        // uint32_t crc = 0;
+        // while (ReadBlock(block)) { crc = Crc32c(block, crc); }    // Same as Crc32c(wholeFile)
+        //
+        // Multi byte words are read as little endian, results are the same on every supported machine
+
+        // Hash64()
+        //
+        // Summary:
+        // Returns 64 bit hash of the data
+        //
+        // Arguments:
+        // std::string_view data  --- In
+        // uint64_t seed          --- In (default 0)
+        //
+        // Returns:
+        // uint64_t
+        uint64_t Hash64(std::string_view data, uint64_t seed = 0);
+
+        // Crc32c()
+        //
+        // Summary:
+        // Returns CRC-32C of the data, Crc32c("123456789") is 0xE3069283
+        //
+        // Arguments:
+        // std::string_view data  --- In
+        // uint32_t crc           --- In (result for the data before this piece, default 0 for the start)
+        //
+        // Returns:
+        // uint32_t
+        uint32_t Crc32c(std::string_view data, uint32_t crc = 0);
+
+        // Crc32()
+        //
+        // Summary:
+        // Returns CRC-32 of the data, Crc32("123456789") is 0xCBF43926
+        //
+        // Arguments:
+        // std::string_view data  --- In
+        // uint32_t crc           --- In (result for the data before this piece, default 0 for the start)
+        //
+        // Returns:
+        // uint32_t
+        uint32_t Crc32(std::string_view data, uint32_t crc = 0);
+
+        // Computes Hash64() of data that arrives in pieces
+        // Pieces can be split at any byte, Finish() returns the same value Hash64() returns for the whole data
+        //
+        // Hash64StreamCls stream;
+        // while (ReadBlock(block)) { stream.Update(block); }
+        // uint64_t hash = stream.Finish();
+        class Hash64StreamCls
+        {
+        private:
+            // Hash64() reads the last 16 bytes of the data at the end, which can overlap with bytes that are already mixed,
+            // so the buffer keeps the 16 bytes before the pending ones
+            static constexpr size_t HISTORY_SIZE = 16;
+            static constexpr size_t BLOCK_SIZE = 48;
+
+            uint64_t Seed;
+            uint64_t See0;
+            uint64_t See1;
+            uint64_t See2;
+            uint64_t TotalSize;
+            size_t PendingSize;
+            unsigned char Buffer[HISTORY_SIZE + BLOCK_SIZE];
+
+        public:
+            // Constructor
+            //
+            // Arguments:
+            // uint64_t seed  --- In (default 0)
+            explicit Hash64StreamCls(uint64_t seed = 0);
+
+            // Reset()
+            //
+            // Summary:
+            // Drops the data seen so far, stream can be used for a new input afterwards
+            //
+            // Arguments:
+            // uint64_t seed  --- In (default 0)
+            //
+            // Returns:
+            void Reset(uint64_t seed = 0);
+
+            // Update()
+            //
+            // Summary:
+            // Adds the next piece of the data
+            //
+            // Arguments:
+            // std::string_view data  --- In
+            //
+            // Returns:
+            void Update(std::string_view data);
+
+            // Finish()
+            //
+            // Summary:
+            // Returns hash of the data seen so far, more pieces can still be added afterwards
+            //
+            // Arguments:
+            //
+            // Returns:
+            // uint64_t
+            uint64_t Finish() const;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef HEXPKG_H
+#define HEXPKG_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "StringPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        enum class HexCase
+        {
+            Lower = 0, // "0123456789abcdef"
+            Upper      // "0123456789ABCDEF"
+        };
+
+        // Hex encoding, decoding and hexdump formatting
+        //
+        // AVX2 or SSSE3 kernels are picked once through cpuid, scalar code is used on other machines
+        // Decoding accepts both cases and always validates the input
+        //
+        // Hexdump lines have the layout of "hexdump -C", 16 bytes per line:
+        // 00000000  01 02 00 74 65 73 74 2e  62 69 6e 00 6f 63 74 65  |...test.bin.octe|
+        // Offset is printed with 8 hex digits (low 32 bits), the last line is shorter if the input is not a multiple of 16 bytes
+        // Bytes outside 0x20 - 0x7E are printed as '.' in the gutter
+
+        inline constexpr size_t HEX_DUMP_LINE_BYTES = 16;
+
+        // EncodeHex()
+        //
+        // Summary:
+        // Encodes "in" into a caller provided buffer, two characters per byte
+        //
+        // Arguments:
+        // std::string_view in  --- In
+        // char* out            --- Out (must have room for 2 * in.size() characters)
+        // HexCase hexCase      --- In (default HexCase::Lower)
+        //
+        // Returns:
+        // size_t (number of characters written)
+        size_t EncodeHex(std::string_view in, char* out, HexCase hexCase = HexCase::Lower);
+
+        // EncodeHex()
+        //
+        // Summary:
+        // Encodes "in" with the specified case
+        //
+        // Arguments:
+        // std::string_view in  --- In
+        // HexCase hexCase      --- In (default HexCase::Lower)
+        //
+        // Returns:
+        // std::string
+        std::string EncodeHex(std::string_view in, HexCase hexCase = HexCase::Lower);
+
+        // DecodeHex()
+        //
+        // Summary:
+        // Decodes "in" into a caller provided buffer
+        //
+        // Arguments:
+        // std::string_view in  --- In
+        // char* out            --- Out (must have room for in.size() / 2 bytes)
+        // size_t& outSize      --- Out (number of bytes written)
+        //
+        // Returns:
+        // StringError
+        //
+        // On failure:
+        // StringError::InvalidArgument is returned when "in" has an odd length or contains a character that is not a hex digit
+        //                              Content of "out" is unspecified in that case
+        StringError DecodeHex(std::string_view in, char* out, size_t& outSize);
+
+        // DecodeHex()
+        //
+        // Summary:
+        // Decodes "in", result replaces the content of "out"
+        //
+        // Arguments:
+        // std::string_view in  --- In
+        // std::string& out     --- Out
+        //
+        // Returns:
+        // StringError (see above)
+        StringError DecodeHex(std::string_view in, std::string& out);
+
+        // GetHexDumpSize()
+        //
+        // Summary:
+        // Returns exact number of characters FormatHexDump() writes for "size" bytes
+        //
+        // Arguments:
+        // size_t size  --- In
+        //
+        // Returns:
+        // size_t
+        size_t GetHexDumpSize(size_t size);
+
+        // FormatHexDump()
+        //
+        // Summary:
+        // Writes the hexdump of "in" into a caller provided buffer, every line ends with '\n'
+        //
+        // Arguments:
+        // std::string_view in  --- In
+        // char* out            --- Out (must have room for GetHexDumpSize(in.size()) characters)
+        // size_t offset        --- In (offset printed on the first line, default 0)
+        //
+        // Returns:
+        // size_t (number of characters written)
+        size_t FormatHexDump(std::string_view in, char* out, size_t offset = 0);
+
+        // AppendHexDump()
+        //
+        // Summary:
+        // Appends the hexdump of "in" to "out"
+        // Clearing and reusing the same string for every packet keeps its capacity, so nothing is allocated once it is large enough
+        //
+        // Arguments:
+        // std::string_view in  --- In
+        // std::string& out     --- Out (hexdump is appended)
+        // size_t offset        --- In (offset printed on the first line, default 0)
+        //
+        // Returns:
+        //
+        // dumpBuffer.clear();
+        // AppendHexDump(packet, dumpBuffer);
+        void AppendHexDump(std::string_view in, std::string& out, size_t offset = 0);
+    }
+}
+
+#endif
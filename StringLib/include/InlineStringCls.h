@@ -0,0 +1,257 @@
+#ifndef INLINESTRINGCLS_H
+#define INLINESTRINGCLS_H
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Fixed capacity string stored inside the object (N characters plus a null terminator)
+        //
+        // It never allocates and it is trivially copyable, so it can be copied with memcpy,
+        // passed by value to threads and kept in packet structures
+        // Member names follow std::string so it can replace std::string in existing code
+        //
+        // Constructors truncate input that does not fit, assign() and append() report it instead
+        template<size_t N>
+        class InlineStringCls
+        {
+        private:
+            using SizeType = std::conditional_t<(N <= UINT8_MAX), uint8_t, std::conditional_t<(N <= UINT16_MAX), uint16_t, size_t>>;
+
+            char Data[N + 1]{};
+            SizeType Size = 0;
+
+        public:
+            static constexpr size_t npos = std::string_view::npos;
+
+            constexpr InlineStringCls() = default;
+
+            // Constructor
+            //
+            // Arguments:
+            // std::string_view str  --- In (only the first N characters are kept)
+            constexpr InlineStringCls(std::string_view str)
+            {
+                assign(str.substr(0, N));
+            }
+            constexpr InlineStringCls(const char* str) :
+                InlineStringCls(std::string_view(str))
+            {
+            }
+            InlineStringCls(const std::string& str) :
+                InlineStringCls(std::string_view(str))
+            {
+            }
+
+            // assign()
+            //
+            // Summary:
+            // Replaces the content with str
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // bool (false if str is longer than N, content is not changed in that case)
+            constexpr bool assign(std::string_view str)
+            {
+                if (str.size() > N)
+                {
+                    return false;
+                }
+                for (size_t i = 0; i < str.size(); i++)
+                {
+                    Data[i] = str[i];
+                }
+                Size = static_cast<SizeType>(str.size());
+                Data[Size] = '\0';
+                return true;
+            }
+
+            // append()
+            //
+            // Summary:
+            // Adds str to the end
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // bool (false if the result would be longer than N, content is not changed in that case)
+            constexpr bool append(std::string_view str)
+            {
+                if (str.size() > N - Size)
+                {
+                    return false;
+                }
+                for (size_t i = 0; i < str.size(); i++)
+                {
+                    Data[Size + i] = str[i];
+                }
+                Size = static_cast<SizeType>(Size + str.size());
+                Data[Size] = '\0';
+                return true;
+            }
+
+            // push_back()
+            //
+            // Summary:
+            // Adds a character to the end
+            //
+            // Arguments:
+            // char ch  --- In
+            //
+            // Returns:
+            // bool (false if the string is full)
+            constexpr bool push_back(char ch)
+            {
+                if (Size == N)
+                {
+                    return false;
+                }
+                Data[Size++] = ch;
+                Data[Size] = '\0';
+                return true;
+            }
+
+            // resize()
+            //
+            // Summary:
+            // Changes the length, new characters are set to ch
+            // Useful before writing into data() directly
+            //
+            // Arguments:
+            // size_t size  --- In (values above N are clamped to N)
+            // char ch      --- In (default '\0')
+            //
+            // Returns:
+            constexpr void resize(size_t size, char ch = '\0')
+            {
+                if (size > N)
+                {
+                    size = N;
+                }
+                for (size_t i = Size; i < size; i++)
+                {
+                    Data[i] = ch;
+                }
+                Size = static_cast<SizeType>(size);
+                Data[Size] = '\0';
+            }
+
+            constexpr void clear()
+            {
+                Size = 0;
+                Data[0] = '\0';
+            }
+
+            constexpr size_t size() const
+            {
+                return Size;
+            }
+            constexpr size_t length() const
+            {
+                return Size;
+            }
+            static constexpr size_t capacity()
+            {
+                return N;
+            }
+            constexpr bool empty() const
+            {
+                return Size == 0;
+            }
+
+            constexpr char* data()
+            {
+                return Data;
+            }
+            constexpr const char* data() const
+            {
+                return Data;
+            }
+            constexpr const char* c_str() const
+            {
+                return Data;
+            }
+
+            constexpr char& operator[](size_t index)
+            {
+                return Data[index];
+            }
+            constexpr const char& operator[](size_t index) const
+            {
+                return Data[index];
+            }
+
+            constexpr char* begin()
+            {
+                return Data;
+            }
+            constexpr char* end()
+            {
+                return Data + Size;
+            }
+            constexpr const char* begin() const
+            {
+                return Data;
+            }
+            constexpr const char* end() const
+            {
+                return Data + Size;
+            }
+
+            constexpr size_t find(char ch, size_t pos = 0) const
+            {
+                return view().find(ch, pos);
+            }
+            constexpr size_t find(std::string_view str, size_t pos = 0) const
+            {
+                return view().find(str, pos);
+            }
+
+            constexpr std::string_view view() const
+            {
+                return std::string_view(Data, Size);
+            }
+            constexpr operator std::string_view() const
+            {
+                return view();
+            }
+            std::string str() const
+            {
+                return std::string(Data, Size);
+            }
+
+            constexpr InlineStringCls& operator+=(std::string_view str)
+            {
+                append(str.substr(0, N - Size));
+                return *this;
+            }
+            constexpr InlineStringCls& operator+=(char ch)
+            {
+                push_back(ch);
+                return *this;
+            }
+
+            // Other strings (including other InlineStringCls) are compared through std::string_view
+            friend constexpr bool operator==(const InlineStringCls& lhs, std::string_view rhs)
+            {
+                return lhs.view() == rhs;
+            }
+            friend constexpr std::strong_ordering operator<=>(const InlineStringCls& lhs, std::string_view rhs)
+            {
+                return lhs.view() <=> rhs;
+            }
+        };
+    }
+}
+
+#endif
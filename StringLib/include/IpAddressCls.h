@@ -0,0 +1,147 @@
+#ifndef IPADDRESSCLS_H
+#define IPADDRESSCLS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "InlineStringCls.h"
+#include "StringPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        enum class IpAddressFamily
+        {
+            V4 = 0,
+            V6
+        };
+
+        // Longest text forms, "255.255.255.255" and "ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255"
+        constexpr size_t MAX_IPV4_ADDRESS_CHARS = 15;
+        constexpr size_t MAX_IP_ADDRESS_CHARS = 45;
+
+        // Binary IPv4 or IPv6 address, bytes are kept in network order
+        //
+        // Text is parsed once and validated in the same pass, the result can be cached and copied freely
+        // (trivially copyable, 20 bytes) and written into sockaddr structures without parsing again
+        // Nothing allocates, formatting writes into a caller buffer or an InlineStringCls
+        //
+        // IPv4 text is a dotted quad of decimal octets, leading zeros are rejected ("010" could be read as octal)
+        // IPv6 text follows RFC 4291 (groups of 1 - 4 hex digits, one "::", optional dotted quad at the end),
+        // it is formatted as RFC 5952 recommends (lowercase, longest zero run as "::", dotted quad for ::ffff:0:0/96)
+        //
+        // IpAddressCls address;
+        // if (IpAddressCls::Parse("192.168.1.10", address) == StringError::Success) { ... }
+        class IpAddressCls
+        {
+        private:
+            uint8_t Bytes[16];
+            IpAddressFamily Family;
+
+        public:
+            // Default constructed address is 0.0.0.0 (any address)
+            IpAddressCls();
+
+            // FromV4Bytes()
+            //
+            // Summary:
+            // Creates an IPv4 address from 4 bytes in network order
+            //
+            // Arguments:
+            // const uint8_t* bytes  --- In (4 bytes)
+            //
+            // Returns:
+            // IpAddressCls
+            static IpAddressCls FromV4Bytes(const uint8_t* bytes);
+
+            // FromV6Bytes()
+            //
+            // Summary:
+            // Creates an IPv6 address from 16 bytes in network order
+            //
+            // Arguments:
+            // const uint8_t* bytes  --- In (16 bytes)
+            //
+            // Returns:
+            // IpAddressCls
+            static IpAddressCls FromV6Bytes(const uint8_t* bytes);
+
+            // Parse()
+            //
+            // Summary:
+            // Parses IPv4 or IPv6 text, family is picked from the text
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            // IpAddressCls& out     --- Out (not changed on failure)
+            //
+            // Returns:
+            // StringError (InvalidArgument if str is not a valid address)
+            static StringError Parse(std::string_view str, IpAddressCls& out);
+
+            // ParseV4()
+            //
+            // Summary:
+            // Parses a dotted quad, 8 characters are classified at a time inside 64 bit words
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            // IpAddressCls& out     --- Out (not changed on failure)
+            //
+            // Returns:
+            // StringError (InvalidArgument if str is not a valid IPv4 address)
+            static StringError ParseV4(std::string_view str, IpAddressCls& out);
+
+            // ParseV6()
+            //
+            // Summary:
+            // Parses IPv6 text
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            // IpAddressCls& out     --- Out (not changed on failure)
+            //
+            // Returns:
+            // StringError (InvalidArgument if str is not a valid IPv6 address)
+            static StringError ParseV6(std::string_view str, IpAddressCls& out);
+
+            // Returns address family
+            IpAddressFamily GetFamily() const;
+            // Returns true for IPv4 addresses
+            bool IsV4() const;
+            // Returns address bytes in network order, 4 bytes for IPv4 and 16 bytes for IPv6
+            const uint8_t* GetBytes() const;
+            // Returns 4 or 16
+            size_t GetByteCount() const;
+
+            // Format()
+            //
+            // Summary:
+            // Writes text form of the address into buffer, no null terminator is written
+            //
+            // Arguments:
+            // char* buffer  --- Out (must have room for MAX_IP_ADDRESS_CHARS characters)
+            //
+            // Returns:
+            // size_t (number of characters written)
+            size_t Format(char* buffer) const;
+
+            // ToString()
+            //
+            // Summary:
+            // Returns text form of the address
+            //
+            // Arguments:
+            //
+            // Returns:
+            // InlineStringCls<MAX_IP_ADDRESS_CHARS>
+            InlineStringCls<MAX_IP_ADDRESS_CHARS> ToString() const;
+
+            bool operator==(const IpAddressCls& other) const;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef KEYWORDMATCHERCLS_H
+#define KEYWORDMATCHERCLS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        struct KeywordMatchStc
+        {
+            size_t Offset;       // Index of the first character of the match
+            size_t Length;       // Length of the matched keyword
+            size_t KeywordIndex; // Index of the keyword in the list given to the constructor
+        };
+
+        // Multi keyword matcher (Aho-Corasick automaton)
+        //
+        // Keyword list is compiled once into a dense transition table,
+        // after that every string is scanned in a single pass regardless of the keyword count
+        //
+        // Bytes are mapped to a compressed alphabet (only bytes that appear in keywords get their own column)
+        // so the table stays small even for thousands of keywords
+        //
+        // A compiled matcher is immutable, it can be shared between threads
+        class KeywordMatcherCls
+        {
+        private:
+            uint16_t ByteClass[256];
+            size_t AlphabetSize;
+            // Transitions[row + ByteClass[ch]] is the row of the next state
+            // Row of a state is its index multiplied by AlphabetSize, OUTPUT_FLAG is set if the next state reports a match
+            std::vector<uint32_t> Transitions;
+            // Per state: first keyword ending at the state and the closest suffix state that also ends a keyword
+            std::vector<uint32_t> StateKeyword;
+            std::vector<uint32_t> DictionaryLink;
+            // Per state: length of the keyword prefix it stands for, no match can start before the last StateDepth bytes
+            std::vector<uint32_t> StateDepth;
+            size_t MaxKeywordLength;
+            // Per keyword: next keyword with the same content, and its length
+            std::vector<uint32_t> NextSameKeyword;
+            std::vector<uint32_t> KeywordLength;
+            std::vector<uint32_t> EmptyKeywordList;
+
+            void Compile(const std::vector<std::string>& keywordList);
+            void AddMatches(uint32_t state, size_t endOffset, std::vector<KeywordMatchStc>& matchList) const;
+
+        public:
+            static constexpr uint32_t OUTPUT_FLAG = 0x80000000u;
+            static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+            // Default constructed matcher has no keywords, it does not match anything
+            KeywordMatcherCls();
+
+            // Constructor
+            //
+            // Arguments:
+            // const std::vector<std::string>& keywordList  --- In
+            //
+            // Assumptions:
+            // Empty keywords match every string (same as std::string::find(""))
+            // Duplicate keywords are allowed, each of them is reported by FindAll()
+            // Throws std::length_error if the transition table would need 2^31 or more entries
+            // (states * distinct keyword bytes, e.g. 8 million states when the keywords use every byte value)
+            explicit KeywordMatcherCls(const std::vector<std::string>& keywordList);
+
+            // IsMatch()
+            //
+            // Summary:
+            // Checks if the string contains any of the keywords
+            // Stops at the first match
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // bool
+            bool IsMatch(std::string_view str) const;
+
+            // FindAll()
+            //
+            // Summary:
+            // Finds every occurrence of every keyword, including overlapping ones
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // std::vector<KeywordMatchStc> (ordered by the end of the match, then by keyword length, longest first)
+            std::vector<KeywordMatchStc> FindAll(std::string_view str) const;
+
+            // FindNonOverlapping()
+            //
+            // Summary:
+            // Finds matches that do not overlap each other, scanning from left to right
+            // When more than one keyword starts at the same offset, the longest one is taken
+            // (the first one in the keyword list if they are equally long)
+            // Matches are chosen during the single pass, a match is taken as soon as no longer or earlier one can follow
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // std::vector<KeywordMatchStc> (ordered by offset)
+            //
+            // Assumptions:
+            // Empty keywords are never reported by this function
+            std::vector<KeywordMatchStc> FindNonOverlapping(std::string_view str) const;
+
+            // GetKeywordCount()
+            //
+            // Summary:
+            // Returns number of keywords the matcher is compiled for
+            //
+            // Arguments:
+            //
+            // Returns:
+            // size_t
+            size_t GetKeywordCount() const;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef LINEINDEXCLS_H
+#define LINEINDEXCLS_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "ParallelPkg.h"
+#include "StringPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Bytes per chunk when LineIndexCls::Build() is given ParallelOptionStc::ChunkSize == 0
+        inline constexpr size_t LINE_INDEX_CHUNK_SIZE = 1024 * 1024;
+
+        // Index of the lines of a buffer, for buffers that are too large to be divided into strings
+        //
+        // Only the offset of the end of every line is stored ('\n' of the line, or the buffer size for a last line without one),
+        // so the index takes sizeof(OffsetT) bytes per line and lines are returned as views into the buffer
+        // uint32_t offsets are enough for buffers below 4 GB, larger buffers need uint64_t
+        //
+        // Every line is indexed, including empty ones, so line numbers match the file (line i is the (i + 1)th line)
+        // A '\n' at the very end does not start another line, "\r" of "\r\n" line endings is part of the line
+        //
+        // Newlines are found 64 bytes at a time with BuildByteBitmap() of ScanPkg.h
+        // Build() cuts the buffer into chunks that are indexed in parallel (see ParallelPkg.h), every chunk stores absolute offsets,
+        // so a line that crosses a chunk boundary simply ends at the first newline of a later chunk, chunk results are only copied
+        // after each other
+        //
+        // LineIndex64Cls index;
+        // index.Build(content, DEFAULT_PARALLEL_OPTION);
+        // for (size_t i = 0; i < index.GetLineCount(); i++) { Parse(index.GetLine(i)); }
+        //
+        // Important: Buffer is not copied, it must outlive the index and every line taken from it
+        template <typename OffsetT>
+            requires std::same_as<OffsetT, uint32_t> || std::same_as<OffsetT, uint64_t>
+        class LineIndexCls
+        {
+        private:
+            std::string_view Source;
+            std::vector<OffsetT> EndList;
+
+        public:
+            // Default constructed index has no lines
+            LineIndexCls();
+
+            // Build()
+            //
+            // Summary:
+            // Indexes the lines of the buffer on the calling thread, previous content of the index is dropped
+            //
+            // Arguments:
+            // std::string_view buffer  --- In
+            //
+            // Returns:
+            // StringError
+            //
+            // On failure:
+            // StringError::OutOfRange is returned when buffer.size() does not fit into OffsetT, index is left empty
+            StringError Build(std::string_view buffer);
+
+            // Build()
+            //
+            // Summary:
+            // Indexes the lines of the buffer with up to option.ThreadCount threads
+            //
+            // Arguments:
+            // std::string_view buffer          --- In
+            // const ParallelOptionStc& option  --- In (ChunkSize is in bytes here, 0 uses LINE_INDEX_CHUNK_SIZE)
+            //
+            // Returns:
+            // StringError (see above)
+            StringError Build(std::string_view buffer, const ParallelOptionStc& option);
+
+            // GetLineCount()
+            //
+            // Summary:
+            // Returns number of lines
+            //
+            // Arguments:
+            //
+            // Returns:
+            // size_t
+            size_t GetLineCount() const;
+
+            // GetLine()
+            //
+            // Summary:
+            // Returns a line without its '\n'
+            //
+            // Arguments:
+            // size_t index  --- In (must be less than GetLineCount())
+            //
+            // Returns:
+            // std::string_view
+            std::string_view GetLine(size_t index) const;
+
+            // GetLineOffset()
+            //
+            // Summary:
+            // Returns offset of the first byte of a line in the buffer
+            //
+            // Arguments:
+            // size_t index  --- In (must be less than GetLineCount())
+            //
+            // Returns:
+            // size_t
+            size_t GetLineOffset(size_t index) const;
+
+            // FindLine()
+            //
+            // Summary:
+            // Returns index of the line that contains the byte at "offset", its '\n' belongs to the line as well
+            //
+            // Arguments:
+            // size_t offset  --- In
+            //
+            // Returns:
+            // size_t (GetLineCount() if offset is not less than the buffer size)
+            size_t FindLine(size_t offset) const;
+
+            // GetEndList()
+            //
+            // Summary:
+            // Returns the raw index, offset of the end of every line
+            //
+            // Arguments:
+            //
+            // Returns:
+            // const std::vector<OffsetT>&
+            const std::vector<OffsetT>& GetEndList() const;
+        };
+
+        using LineIndex32Cls = LineIndexCls<uint32_t>;
+        using LineIndex64Cls = LineIndexCls<uint64_t>;
+
+        // Both instantiations are compiled in LineIndexCls.cpp
+        extern template class LineIndexCls<uint32_t>;
+        extern template class LineIndexCls<uint64_t>;
+    }
+}
+
+#endif
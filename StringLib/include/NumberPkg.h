@@ -0,0 +1,217 @@
+#ifndef NUMBERPKG_H
+#define NUMBERPKG_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Number formatting into caller provided buffers
+        //
+        // Integers are written two digits at a time from a lookup table, floating point numbers use std::to_chars
+        // Nothing here allocates, except the functions that append to a std::string
+        // Output is never null terminated
+
+        template<typename T>
+        concept FormattableIntegral = std::integral<T> && (std::same_as<T, bool> == false);
+
+        // Longest output of FormatIntegral() for T (digits and sign)
+        template<FormattableIntegral T>
+        inline constexpr size_t MAX_INTEGRAL_CHARS = std::numeric_limits<T>::digits10 + 1 + (std::is_signed_v<T> ? 1 : 0);
+
+        // Longest output of FormatFloating() ("-2.2250738585072014e-308" is 24 characters)
+        inline constexpr size_t MAX_FLOATING_CHARS = 32;
+
+        // "00", "01", ... "99"
+        inline constexpr char DIGIT_PAIRS[201] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+        // CountDigits()
+        //
+        // Summary:
+        // Returns number of decimal digits of value (1 for 0)
+        //
+        // Arguments:
+        // T value  --- In
+        //
+        // Returns:
+        // size_t
+        template<std::unsigned_integral T>
+        constexpr size_t CountDigits(T value)
+        {
+            size_t count = 1;
+            while (value >= 100)
+            {
+                value /= 100;
+                count += 2;
+            }
+            return value >= 10 ? count + 1 : count;
+        }
+
+        // FormatIntegral()
+        //
+        // Summary:
+        // Writes decimal representation of value
+        //
+        // Arguments:
+        // T value    --- In
+        // char* out  --- Out (must have room for MAX_INTEGRAL_CHARS<T> characters)
+        //
+        // Returns:
+        // size_t (number of characters written)
+        template<FormattableIntegral T>
+        constexpr size_t FormatIntegral(T value, char* out)
+        {
+            // Small types are widened so the arithmetic below does not depend on integer promotion
+            using UnsignedT = std::conditional_t<(sizeof(T) <= sizeof(uint32_t)), uint32_t, uint64_t>;
+
+            UnsignedT magnitude = static_cast<UnsignedT>(value);
+            size_t signSize = 0;
+            if constexpr (std::is_signed_v<T>)
+            {
+                if (value < 0)
+                {
+                    // Negating in the unsigned type also works for the minimum value
+                    using MagnitudeT = std::make_unsigned_t<T>;
+                    magnitude = static_cast<MagnitudeT>(0u - static_cast<MagnitudeT>(value));
+                    out[0] = '-';
+                    signSize = 1;
+                }
+            }
+
+            size_t size = signSize + CountDigits(magnitude);
+            char* pos = out + size;
+
+            while (magnitude >= 100)
+            {
+                size_t index = static_cast<size_t>(magnitude % 100) * 2;
+                magnitude /= 100;
+                pos -= 2;
+                pos[0] = DIGIT_PAIRS[index];
+                pos[1] = DIGIT_PAIRS[index + 1];
+            }
+            if (magnitude >= 10)
+            {
+                size_t index = static_cast<size_t>(magnitude) * 2;
+                pos[-2] = DIGIT_PAIRS[index];
+                pos[-1] = DIGIT_PAIRS[index + 1];
+            }
+            else
+            {
+                pos[-1] = static_cast<char>('0' + magnitude);
+            }
+
+            return size;
+        }
+
+        // FormatIntegral()
+        //
+        // Summary:
+        // Writes decimal representation of value, checking the size of the buffer
+        //
+        // Arguments:
+        // T value              --- In
+        // std::span<char> out  --- Out
+        //
+        // Returns:
+        // size_t (number of characters written, 0 if out is too small, nothing is written in that case)
+        template<FormattableIntegral T>
+        constexpr size_t FormatIntegral(T value, std::span<char> out)
+        {
+            if (out.size() >= MAX_INTEGRAL_CHARS<T>)
+            {
+                return FormatIntegral(value, out.data());
+            }
+
+            char buffer[MAX_INTEGRAL_CHARS<T>]{};
+            size_t size = FormatIntegral(value, buffer);
+            if (size > out.size())
+            {
+                return 0;
+            }
+            for (size_t i = 0; i < size; i++)
+            {
+                out[i] = buffer[i];
+            }
+            return size;
+        }
+
+        // AppendIntegral()
+        //
+        // Summary:
+        // Appends decimal representation of value to out
+        // Reusing the same string avoids allocations once its capacity is large enough
+        //
+        // Arguments:
+        // T value           --- In
+        // std::string& out  --- In/Out
+        //
+        // Returns:
+        template<FormattableIntegral T>
+        void AppendIntegral(T value, std::string& out)
+        {
+            char buffer[MAX_INTEGRAL_CHARS<T>];
+            out.append(buffer, FormatIntegral(value, buffer));
+        }
+
+        // FormatFloating()
+        //
+        // Summary:
+        // Writes the shortest representation of value that parses back to exactly the same value
+        // Infinity and NaN are written as "inf", "-inf" and "nan"
+        //
+        // Arguments:
+        // float/double value  --- In
+        // char* out           --- Out (must have room for MAX_FLOATING_CHARS characters)
+        //
+        // Returns:
+        // size_t (number of characters written)
+        size_t FormatFloating(float value, char* out);
+        size_t FormatFloating(double value, char* out);
+
+        // FormatFloating()
+        //
+        // Summary:
+        // Same as above, checking the size of the buffer
+        //
+        // Arguments:
+        // float/double value   --- In
+        // std::span<char> out  --- Out
+        //
+        // Returns:
+        // size_t (number of characters written, 0 if out is too small)
+        size_t FormatFloating(float value, std::span<char> out);
+        size_t FormatFloating(double value, std::span<char> out);
+
+        // AppendFloating()
+        //
+        // Summary:
+        // Appends the shortest round trip representation of value to out
+        //
+        // Arguments:
+        // float/double value  --- In
+        // std::string& out    --- In/Out
+        //
+        // Returns:
+        void AppendFloating(float value, std::string& out);
+        void AppendFloating(double value, std::string& out);
+    }
+}
+
+#endif
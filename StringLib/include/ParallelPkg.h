@@ -0,0 +1,190 @@
+#ifndef PARALLELPKG_H
+#define PARALLELPKG_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "KeywordMatcherCls.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Parallel versions of the bulk string operations, for vectors with millions of strings
+        //
+        // The vector is cut into chunks of consecutive strings, threads take chunks from a shared counter until none is left
+        // (the calling thread works as well), so a thread that gets short strings simply takes more chunks
+        // Every chunk writes its own part of the output, outputs are merged in chunk order, so results keep the input order
+        // Lists that fit in a single chunk are processed on the calling thread without starting any thread
+        //
+        // Threads are started per call and joined before returning, nothing is shared between calls
+        // If a thread throws, the remaining chunks are skipped and the first exception is rethrown on the calling thread
+
+        struct ParallelOptionStc
+        {
+            size_t ThreadCount; // Threads to use including the calling thread, 0 uses std::thread::hardware_concurrency()
+            size_t ChunkSize;   // Strings per chunk, 0 uses DEFAULT_CHUNK_SIZE
+        };
+
+        // Large enough that the shared counter is touched rarely, small enough to balance uneven string lengths
+        inline constexpr size_t DEFAULT_CHUNK_SIZE = 4096;
+        inline constexpr ParallelOptionStc DEFAULT_PARALLEL_OPTION = { 0, 0 };
+
+        // GetChunkCount()
+        //
+        // Summary:
+        // Returns number of chunks ForEachChunk() cuts size elements into
+        //
+        // Arguments:
+        // size_t size                       --- In
+        // const ParallelOptionStc& option   --- In
+        //
+        // Returns:
+        // size_t
+        size_t GetChunkCount(size_t size, const ParallelOptionStc& option);
+
+        // ForEachChunk()
+        //
+        // Summary:
+        // Calls func(chunkIndex, first, last) once for every chunk of [0, size), on up to option.ThreadCount threads
+        // Chunk i is [i * chunkSize, min(size, (i + 1) * chunkSize))
+        //
+        // Arguments:
+        // size_t size                                           --- In
+        // const ParallelOptionStc& option                       --- In
+        // std::function<void(size_t, size_t, size_t)> func      --- In
+        //
+        // Returns:
+        void ForEachChunk(size_t size, const ParallelOptionStc& option, const std::function<void(size_t, size_t, size_t)>& func);
+
+        // Filter()
+        //
+        // Summary:
+        // Parallel Filter(), removes the strings that contain the keyword
+        //
+        // Arguments:
+        // std::vector<std::string> strList   --- In
+        // std::string keyword                --- In
+        // const ParallelOptionStc& option    --- In
+        //
+        // Returns:
+        // std::vector<std::string>
+        std::vector<std::string> Filter(const std::vector<std::string>& strList, const std::string& keyword, const ParallelOptionStc& option);
+        // Filter()
+        //
+        // Summary:
+        // Parallel Filter(), removes the strings that contain any of the keywords of a compiled matcher
+        //
+        // Arguments:
+        // std::vector<std::string> strList   --- In
+        // KeywordMatcherCls matcher          --- In
+        // const ParallelOptionStc& option    --- In
+        //
+        // Returns:
+        // std::vector<std::string>
+        std::vector<std::string> Filter(const std::vector<std::string>& strList, const KeywordMatcherCls& matcher, const ParallelOptionStc& option);
+
+        // Count()
+        //
+        // Summary:
+        // Returns number of strings that contain the keyword
+        //
+        // Arguments:
+        // std::vector<std::string> strList   --- In
+        // std::string keyword                --- In
+        // const ParallelOptionStc& option    --- In
+        //
+        // Returns:
+        // size_t
+        size_t Count(const std::vector<std::string>& strList, const std::string& keyword, const ParallelOptionStc& option);
+        // Count()
+        //
+        // Summary:
+        // Returns number of strings that contain any of the keywords of a compiled matcher
+        //
+        // Arguments:
+        // std::vector<std::string> strList   --- In
+        // KeywordMatcherCls matcher          --- In
+        // const ParallelOptionStc& option    --- In
+        //
+        // Returns:
+        // size_t
+        size_t Count(const std::vector<std::string>& strList, const KeywordMatcherCls& matcher, const ParallelOptionStc& option);
+
+        // Join()
+        //
+        // Summary:
+        // Parallel Join(), output offset of every chunk comes from a prefix sum of the chunk sizes,
+        // then every chunk copies its strings into the single preallocated result
+        //
+        // Arguments:
+        // std::vector<std::string> stringList  --- In
+        // std::string delimiter                --- In
+        // const ParallelOptionStc& option      --- In
+        //
+        // Returns:
+        // std::string
+        std::string Join(const std::vector<std::string>& stringList, const std::string& delimiter, const ParallelOptionStc& option);
+
+        // Transform()
+        //
+        // Summary:
+        // Returns func(str) for every string, in the same order
+        //
+        // Arguments:
+        // std::vector<std::string> strList   --- In
+        // FuncT func                         --- In (std::string func(const std::string&), called from several threads)
+        // const ParallelOptionStc& option    --- In
+        //
+        // Returns:
+        // std::vector<std::string>
+        //
+        // auto trimmed = Transform(lineList, [](const std::string& line) { return Trim(line); }, DEFAULT_PARALLEL_OPTION);
+        template <typename FuncT>
+        std::vector<std::string> Transform(const std::vector<std::string>& strList, FuncT func, const ParallelOptionStc& option)
+        {
+            std::vector<std::string> resultList(strList.size());
+            ForEachChunk(strList.size(), option, [&](size_t, size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; i++)
+                {
+                    resultList[i] = func(strList[i]);
+                }
+            });
+            return resultList;
+        }
+        // Transform()
+        //
+        // Summary:
+        // Replaces every string with func(std::move(str)), so rvalue overloads such as ToLower(std::string&&)
+        // and ReplaceAll(std::string&&, ...) can reuse the buffers
+        //
+        // Arguments:
+        // std::vector<std::string> strList   --- In
+        // FuncT func                         --- In (std::string func(std::string&&), called from several threads)
+        // const ParallelOptionStc& option    --- In
+        //
+        // Returns:
+        // std::vector<std::string>
+        //
+        // lineList = Transform(std::move(lineList), [](std::string&& line) { return ToLower(std::move(line)); }, DEFAULT_PARALLEL_OPTION);
+        template <typename FuncT>
+        std::vector<std::string> Transform(std::vector<std::string>&& strList, FuncT func, const ParallelOptionStc& option)
+        {
+            std::vector<std::string> resultList(std::move(strList));
+            ForEachChunk(resultList.size(), option, [&](size_t, size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; i++)
+                {
+                    resultList[i] = func(std::move(resultList[i]));
+                }
+            });
+            return resultList;
+        }
+    }
+}
+
+#endif
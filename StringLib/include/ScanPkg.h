@@ -0,0 +1,239 @@
+#ifndef SCANPKG_H
+#define SCANPKG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Set of bytes
+        // Stored both as a 256 bit map for scalar lookups and as a list of inclusive ranges for SIMD range compares
+        // Sets that consist of more than MAX_RANGE_COUNT separate ranges are still valid, but they are scanned with scalar code
+        class ByteSetCls
+        {
+        public:
+            static constexpr size_t MAX_RANGE_COUNT = 8;
+
+        private:
+            uint64_t Bitmap[4];
+            unsigned char RangeLow[MAX_RANGE_COUNT];
+            unsigned char RangeHigh[MAX_RANGE_COUNT];
+            size_t RangeCount;
+            bool IsRangeListComplete;
+
+            constexpr void RebuildRanges()
+            {
+                RangeCount = 0;
+                IsRangeListComplete = true;
+
+                size_t value = 0;
+                while (value < 256)
+                {
+                    if (Contains(static_cast<char>(value)) == false)
+                    {
+                        value++;
+                        continue;
+                    }
+
+                    size_t low = value;
+                    while (value < 256 && Contains(static_cast<char>(value)))
+                    {
+                        value++;
+                    }
+
+                    if (RangeCount == MAX_RANGE_COUNT)
+                    {
+                        IsRangeListComplete = false;
+                        return;
+                    }
+
+                    RangeLow[RangeCount] = static_cast<unsigned char>(low);
+                    RangeHigh[RangeCount] = static_cast<unsigned char>(value - 1);
+                    RangeCount++;
+                }
+            }
+
+        public:
+            // Creates an empty set
+            constexpr ByteSetCls() :
+                Bitmap{},
+                RangeLow{},
+                RangeHigh{},
+                RangeCount(0),
+                IsRangeListComplete(true)
+            {
+            }
+
+            // Creates a set that contains every byte of "bytes"
+            constexpr ByteSetCls(std::string_view bytes) :
+                ByteSetCls()
+            {
+                for (char ch : bytes)
+                {
+                    unsigned char value = static_cast<unsigned char>(ch);
+                    Bitmap[value >> 6] |= uint64_t{ 1 } << (value & 63);
+                }
+                RebuildRanges();
+            }
+
+            // AddRange()
+            //
+            // Summary:
+            // Adds every byte between low and high (both inclusive) to the set
+            //
+            // Arguments:
+            // char low   --- In
+            // char high  --- In
+            //
+            // Returns:
+            // ByteSetCls& (so calls can be chained)
+            constexpr ByteSetCls& AddRange(char low, char high)
+            {
+                for (size_t value = static_cast<unsigned char>(low); value <= static_cast<unsigned char>(high); value++)
+                {
+                    Bitmap[value >> 6] |= uint64_t{ 1 } << (value & 63);
+                }
+                RebuildRanges();
+                return *this;
+            }
+
+            // Contains()
+            //
+            // Summary:
+            // Checks if the byte is in the set
+            //
+            // Arguments:
+            // char ch  --- In
+            //
+            // Returns:
+            // bool
+            constexpr bool Contains(char ch) const
+            {
+                unsigned char value = static_cast<unsigned char>(ch);
+                return ((Bitmap[value >> 6] >> (value & 63)) & 1) != 0;
+            }
+
+            // Range list accessors used by SIMD kernels
+            constexpr bool HasCompleteRangeList() const { return IsRangeListComplete; }
+            constexpr size_t GetRangeCount() const { return RangeCount; }
+            constexpr unsigned char GetRangeLow(size_t index) const { return RangeLow[index]; }
+            constexpr unsigned char GetRangeHigh(size_t index) const { return RangeHigh[index]; }
+        };
+
+        // Predefined character classes (ASCII only)
+        inline constexpr ByteSetCls SPACE_CHARS = ByteSetCls(" \t\n\v\f\r");
+        inline constexpr ByteSetCls DIGIT_CHARS = ByteSetCls().AddRange('0', '9');
+        inline constexpr ByteSetCls ALPHA_CHARS = ByteSetCls().AddRange('a', 'z').AddRange('A', 'Z');
+        inline constexpr ByteSetCls ALNUM_CHARS = ByteSetCls().AddRange('a', 'z').AddRange('A', 'Z').AddRange('0', '9');
+        inline constexpr ByteSetCls WORD_CHARS = ByteSetCls().AddRange('a', 'z').AddRange('A', 'Z').AddRange('0', '9').AddRange('\'', '\'');
+
+        // Scanning primitives
+        //
+        // All of them work on [first, last) and pick SSE2, AVX2 or AVX-512BW kernels once, through cpuid
+        // Check GetSimdLevel() in CpuFeaturePkg.h to see which one is used
+
+        // FindByte()
+        //
+        // Summary:
+        // Finds the first occurrence of a byte
+        //
+        // Arguments:
+        // const char* first  --- In
+        // const char* last   --- In
+        // char ch            --- In
+        //
+        // Returns:
+        // const char* (last if the byte is not found)
+        const char* FindByte(const char* first, const char* last, char ch);
+
+        // CountByte()
+        //
+        // Summary:
+        // Counts occurrences of a byte
+        //
+        // Arguments:
+        // const char* first  --- In
+        // const char* last   --- In
+        // char ch            --- In
+        //
+        // Returns:
+        // size_t
+        size_t CountByte(const char* first, const char* last, char ch);
+
+        // FindFirstOf()
+        //
+        // Summary:
+        // Finds the first byte that is in the set
+        //
+        // Arguments:
+        // const char* first      --- In
+        // const char* last       --- In
+        // const ByteSetCls& set  --- In
+        //
+        // Returns:
+        // const char* (last if no such byte is found)
+        const char* FindFirstOf(const char* first, const char* last, const ByteSetCls& set);
+
+        // FindFirstNotOf()
+        //
+        // Summary:
+        // Finds the first byte that is not in the set
+        //
+        // Arguments:
+        // const char* first      --- In
+        // const char* last       --- In
+        // const ByteSetCls& set  --- In
+        //
+        // Returns:
+        // const char* (last if no such byte is found)
+        const char* FindFirstNotOf(const char* first, const char* last, const ByteSetCls& set);
+
+        // FindLastNotOf()
+        //
+        // Summary:
+        // Finds the last byte that is not in the set
+        //
+        // Arguments:
+        // const char* first      --- In
+        // const char* last       --- In
+        // const ByteSetCls& set  --- In
+        //
+        // Returns:
+        // const char* (last if no such byte is found)
+        const char* FindLastNotOf(const char* first, const char* last, const ByteSetCls& set);
+
+        // BuildSetBitmap()
+        //
+        // Summary:
+        // Writes one bit per byte, set if the byte is in the set
+        // Bit i of bitmap[k] belongs to first[64 * k + i], unused bits of the last word are cleared
+        //
+        // Arguments:
+        // const char* first      --- In
+        // const char* last       --- In
+        // const ByteSetCls& set  --- In
+        // uint64_t* bitmap       --- Out (must have room for (last - first + 63) / 64 words)
+        //
+        // Returns:
+        void BuildSetBitmap(const char* first, const char* last, const ByteSetCls& set, uint64_t* bitmap);
+
+        // BuildByteBitmap()
+        //
+        // Summary:
+        // Writes one bit per byte, set if the byte is equal to ch (same layout as BuildSetBitmap())
+        //
+        // Arguments:
+        // const char* first  --- In
+        // const char* last   --- In
+        // char ch            --- In
+        // uint64_t* bitmap   --- Out (must have room for (last - first + 63) / 64 words)
+        //
+        // Returns:
+        void BuildByteBitmap(const char* first, const char* last, char ch, uint64_t* bitmap);
+    }
+}
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef SEARCHERCLS_H
+#define SEARCHERCLS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Substring searcher that is precompiled for a single needle
+        //
+        // Needle length decides the algorithm:
+        // 1 byte                     --- FindByte() of ScanPkg.h
+        // up to SHORT_NEEDLE_LIMIT   --- SIMD filter on the first and the last byte of the needle, candidates are verified with memcmp
+        // longer                     --- Two-Way (Crochemore-Perrin), linear time even on repetitive inputs
+        //
+        // Needle is copied into the searcher, haystacks are never copied
+        // A constructed searcher is immutable, it can be shared between threads
+        class SearcherCls
+        {
+        private:
+            std::string Needle;
+
+            // Two-Way state, only filled for long needles
+            std::vector<size_t> Shift;
+            uint64_t ByteSet[4];
+            size_t CriticalPosition;
+            size_t Period;
+            size_t PeriodicMemory;
+
+            void PrepareTwoWay();
+            size_t FindTwoWay(std::string_view haystack, size_t pos) const;
+
+        public:
+            static constexpr size_t SHORT_NEEDLE_LIMIT = 32;
+
+            // Default constructed searcher has an empty needle
+            SearcherCls();
+
+            // Constructor
+            //
+            // Arguments:
+            // std::string_view needle  --- In
+            explicit SearcherCls(std::string_view needle);
+
+            // Find()
+            //
+            // Summary:
+            // Finds the first occurrence of the needle in haystack, starting from pos
+            //
+            // Arguments:
+            // std::string_view haystack  --- In
+            // size_t pos                 --- In (default 0)
+            //
+            // Returns:
+            // size_t (index of the match, or std::string::npos if not found)
+            //
+            // Assumptions:
+            // Same as std::string::find, an empty needle is found at pos when pos <= haystack.size()
+            size_t Find(std::string_view haystack, size_t pos = 0) const;
+
+            // GetNeedle()
+            //
+            // Summary:
+            // Returns the needle searcher is compiled for
+            //
+            // Arguments:
+            //
+            // Returns:
+            // std::string_view
+            std::string_view GetNeedle() const;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef SPLITVIEWCLS_H
+#define SPLITVIEWCLS_H
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+#include "SearcherCls.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Controls what happens when two delimiters follow each other,
+        // or when the string starts or ends with a delimiter
+        enum class EmptyFields
+        {
+            Skip = 0, // Empty tokens are not yielded (same behaviour as Divide())
+            Keep      // Empty tokens are yielded, N delimiters always yield N + 1 tokens
+        };
+
+        // Lazy, allocation free splitter
+        // Tokens are std::string_view objects pointing into the original string
+        //
+        // Can be used in range based for loops and composed with std::views:
+        // for (std::string_view line : SplitViewCls(content, '\n')) { ... }
+        // auto lengths = SplitViewCls(content, ',') | std::views::transform(&std::string_view::size);
+        //
+        // Important: String is not copied, it must outlive the view and every token taken from it
+        // Substring delimiters are compiled into a SearcherCls owned by the view
+        class SplitViewCls : public std::ranges::view_interface<SplitViewCls>
+        {
+        private:
+            std::string_view Source;
+            SearcherCls Delimiter;
+            char DelimiterChar;
+            bool IsCharDelimiter;
+            EmptyFields Mode;
+
+            size_t FindDelimiter(size_t pos) const;
+            size_t GetDelimiterSize() const;
+
+        public:
+            class Iterator
+            {
+            private:
+                const SplitViewCls* Parent;
+                size_t TokenStart;
+                size_t TokenEnd;
+                size_t NextStart;
+                bool IsEnd;
+
+                void Advance();
+
+                friend class SplitViewCls;
+
+            public:
+                using iterator_concept = std::forward_iterator_tag;
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = std::string_view;
+                using difference_type = std::ptrdiff_t;
+
+                Iterator() :
+                    Parent(nullptr),
+                    TokenStart(0),
+                    TokenEnd(0),
+                    NextStart(std::string_view::npos),
+                    IsEnd(true)
+                {
+                }
+
+                std::string_view operator*() const
+                {
+                    return Parent->Source.substr(TokenStart, TokenEnd - TokenStart);
+                }
+                Iterator& operator++()
+                {
+                    Advance();
+                    return *this;
+                }
+                Iterator operator++(int)
+                {
+                    Iterator previous = *this;
+                    Advance();
+                    return previous;
+                }
+                bool operator==(const Iterator& other) const
+                {
+                    if (IsEnd || other.IsEnd)
+                    {
+                        return IsEnd == other.IsEnd;
+                    }
+                    return TokenStart == other.TokenStart && NextStart == other.NextStart;
+                }
+                bool operator==(std::default_sentinel_t) const
+                {
+                    return IsEnd;
+                }
+            };
+
+            // Default constructed view yields no tokens
+            SplitViewCls();
+
+            // Constructor
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            // char ch               --- In (delimiter)
+            // EmptyFields mode      --- In (default EmptyFields::Skip)
+            SplitViewCls(std::string_view str, char ch, EmptyFields mode = EmptyFields::Skip);
+
+            // Constructor
+            //
+            // Arguments:
+            // std::string_view str        --- In
+            // std::string_view delimiter  --- In
+            // EmptyFields mode            --- In (default EmptyFields::Skip)
+            //
+            // Assumptions:
+            // If delimiter is empty, whole string is yielded as a single token
+            SplitViewCls(std::string_view str, std::string_view delimiter, EmptyFields mode = EmptyFields::Skip);
+
+            // Returns an iterator to the first token
+            Iterator begin() const;
+            // Returns std::default_sentinel, iterator compares equal to it after the last token
+            std::default_sentinel_t end() const;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef STREAMTOKENIZERCLS_H
+#define STREAMTOKENIZERCLS_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "SearcherCls.h"
+#include "SplitViewCls.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Default limit of StreamTokenizerCls, longer tokens are dropped
+        inline constexpr size_t DEFAULT_MAX_TOKEN_SIZE = 64 * 1024;
+
+        enum class TokenStatus
+        {
+            Found = 0,    // Token is returned
+            NeedMoreData, // Chunk is consumed, call Feed() with the next one
+            TooLong       // A token exceeded the limit, it is skipped up to its delimiter and nothing is returned for it
+        };
+
+        // Splits a stream that arrives in arbitrary chunks (socket reads, file blocks) into tokens,
+        // a delimiter can be split between two chunks as well
+        //
+        // std::string buffer;
+        // size_t recvByteCount = 0;
+        // StreamTokenizerCls tokenizer("\r\n");
+        // while (session.Recv(buffer, 2048, recvByteCount) == WinsockError::Success && recvByteCount != 0)
+        // {
+        //     tokenizer.Feed(std::string_view(buffer.data(), recvByteCount));
+        //     std::string_view line;
+        //     TokenStatus status;
+        //     while ((status = tokenizer.Next(line)) != TokenStatus::NeedMoreData) { if (status == TokenStatus::Found) Handle(line); }
+        // }
+        //
+        // Tokens that are complete within a chunk are views into the chunk, nothing is copied for them
+        // Only the unfinished token at the end of a chunk is copied into the internal buffer and completed from the next chunk,
+        // that buffer is allocated once (max token size + delimiter size) and is never grown
+        // A token longer than the limit is reported once with TokenStatus::TooLong, the stream continues after its delimiter
+        //
+        // Important: A token is valid until the next Next() or Feed() call, and only as long as the chunk it was taken from
+        class StreamTokenizerCls
+        {
+        private:
+            SearcherCls Delimiter;
+            char DelimiterChar;
+            bool IsCharDelimiter;
+            EmptyFields Mode;
+            size_t MaxTokenSize;
+
+            std::string_view Chunk;
+            size_t ChunkPos;
+            std::string Pending;     // Unfinished token (or only the last delimiter size - 1 bytes while skipping a long one)
+            std::string Bridge;      // End of Pending + start of the chunk, for a delimiter that is split between them
+            bool IsPendingReturned;  // Pending was returned as a token, it is cleared on the next call
+            bool IsSkipping;         // Rest of a too long token is dropped up to the next delimiter
+
+            size_t FindDelimiter(std::string_view str, size_t pos) const;
+            size_t GetDelimiterSize() const;
+            size_t GetTailSize() const;
+            void KeepDelimiterTail(std::string_view rest);
+            TokenStatus NextFromPending(std::string_view& token);
+
+        public:
+            // Constructor
+            //
+            // Arguments:
+            // char ch              --- In (delimiter)
+            // size_t maxTokenSize  --- In (default DEFAULT_MAX_TOKEN_SIZE)
+            // EmptyFields mode     --- In (default EmptyFields::Keep, line protocols use empty lines)
+            explicit StreamTokenizerCls(char ch, size_t maxTokenSize = DEFAULT_MAX_TOKEN_SIZE, EmptyFields mode = EmptyFields::Keep);
+
+            // Constructor
+            //
+            // Arguments:
+            // std::string_view delimiter  --- In (empty delimiter never splits anything)
+            // size_t maxTokenSize         --- In (default DEFAULT_MAX_TOKEN_SIZE)
+            // EmptyFields mode            --- In (default EmptyFields::Keep)
+            explicit StreamTokenizerCls(std::string_view delimiter, size_t maxTokenSize = DEFAULT_MAX_TOKEN_SIZE, EmptyFields mode = EmptyFields::Keep);
+
+            // Feed()
+            //
+            // Summary:
+            // Sets the next chunk of the stream
+            // Tokens of the previous chunk must be taken with Next() first, until it returns TokenStatus::NeedMoreData
+            //
+            // Arguments:
+            // std::string_view chunk  --- In (must stay alive until Next() returns TokenStatus::NeedMoreData)
+            //
+            // Returns:
+            void Feed(std::string_view chunk);
+
+            // Next()
+            //
+            // Summary:
+            // Takes the next complete token, without its delimiter
+            //
+            // Arguments:
+            // std::string_view& token  --- Out (only set if TokenStatus::Found is returned)
+            //
+            // Returns:
+            // TokenStatus
+            TokenStatus Next(std::string_view& token);
+
+            // Finish()
+            //
+            // Summary:
+            // Takes the unfinished token at the end of the stream, the one that has no delimiter after it
+            // Tokenizer can be used for a new stream afterwards
+            //
+            // Arguments:
+            // std::string_view& token  --- Out
+            //
+            // Returns:
+            // bool (false if there is no such token, it is empty and skipped, or it was too long)
+            bool Finish(std::string_view& token);
+
+            // Reset()
+            //
+            // Summary:
+            // Drops the unfinished token and the current chunk
+            //
+            // Arguments:
+            //
+            // Returns:
+            void Reset();
+
+            // GetPendingSize()
+            //
+            // Summary:
+            // Returns number of bytes that are kept for the unfinished token
+            //
+            // Arguments:
+            //
+            // Returns:
+            // size_t
+            size_t GetPendingSize() const;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef STRINGBUILDERCLS_H
+#define STRINGBUILDERCLS_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "NumberPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Collects pieces of a string and materializes them with a single allocation of the exact size
+        //
+        // Strings are stored as views, they are not copied, so they must outlive the builder
+        // Characters and numbers are formatted into a scratch buffer owned by the builder
+        //
+        // Piece list and scratch buffer live in a small arena inside the builder, so short builds do not allocate at all
+        // When that arena is full, memory comes from the resource given to the constructor (a caller's
+        // std::pmr::monotonic_buffer_resource for example), or from the default resource
+        //
+        // StringBuilderCls builder;
+        // builder.Append("Port ");
+        // builder.AppendIntegral(port);
+        // std::string result = builder.ToString();
+        class StringBuilderCls
+        {
+        private:
+            static constexpr size_t INLINE_ARENA_SIZE = 1024;
+
+            // Data is nullptr if the characters are stored in Scratch, starting at Offset
+            struct PieceStc
+            {
+                const char* Data;
+                size_t Offset;
+                size_t Size;
+            };
+
+            alignas(std::max_align_t) std::byte InlineArena[INLINE_ARENA_SIZE];
+            std::pmr::monotonic_buffer_resource ArenaResource;
+            std::pmr::vector<PieceStc> PieceList;
+            std::pmr::string Scratch;
+            size_t Size;
+
+            void AddScratchPiece(size_t offset, size_t size);
+
+        public:
+            StringBuilderCls();
+
+            // Constructor
+            //
+            // Arguments:
+            // std::pmr::memory_resource* upstream  --- In (used when the inline arena is full, must outlive the builder)
+            explicit StringBuilderCls(std::pmr::memory_resource* upstream);
+
+            // Pieces point into the builder itself
+            StringBuilderCls(const StringBuilderCls&) = delete;
+            StringBuilderCls& operator=(const StringBuilderCls&) = delete;
+
+            // Append()
+            //
+            // Summary:
+            // Adds a string to the end, the string is not copied
+            //
+            // Arguments:
+            // std::string_view str  --- In (must stay valid until the result is materialized)
+            //
+            // Returns:
+            void Append(std::string_view str)
+            {
+                // Inline, Join() and ReplaceAll() call it once or twice per piece
+                if (str.empty() == false)
+                {
+                    PieceList.push_back({ str.data(), 0, str.size() });
+                    Size += str.size();
+                }
+            }
+
+            // Append()
+            //
+            // Summary:
+            // Adds a character to the end
+            //
+            // Arguments:
+            // char ch  --- In
+            //
+            // Returns:
+            void Append(char ch);
+
+            // AppendIntegral()
+            //
+            // Summary:
+            // Adds decimal representation of value to the end
+            //
+            // Arguments:
+            // T value  --- In (T must be integral type)
+            //
+            // Returns:
+            template<FormattableIntegral T>
+            void AppendIntegral(T value)
+            {
+                size_t offset = Scratch.size();
+                Scratch.resize(offset + MAX_INTEGRAL_CHARS<T>);
+                size_t size = FormatIntegral(value, Scratch.data() + offset);
+                Scratch.resize(offset + size);
+                AddScratchPiece(offset, size);
+            }
+
+            // AppendFloating()
+            //
+            // Summary:
+            // Adds the shortest round trip representation of value to the end
+            //
+            // Arguments:
+            // double value  --- In
+            //
+            // Returns:
+            void AppendFloating(double value);
+
+            // Reserve()
+            //
+            // Summary:
+            // Reserves room for pieceCount pieces, call it when the number of pieces is known in advance
+            //
+            // Arguments:
+            // size_t pieceCount  --- In
+            //
+            // Returns:
+            void Reserve(size_t pieceCount);
+
+            // GetSize()
+            //
+            // Summary:
+            // Returns length of the result
+            //
+            // Arguments:
+            //
+            // Returns:
+            // size_t
+            size_t GetSize() const;
+
+            // CopyTo()
+            //
+            // Summary:
+            // Writes the result into a caller provided buffer
+            //
+            // Arguments:
+            // char* out  --- Out (must have room for GetSize() characters)
+            //
+            // Returns:
+            // size_t (number of characters written)
+            size_t CopyTo(char* out) const;
+
+            // AppendTo()
+            //
+            // Summary:
+            // Appends the result to out, growing out at most once
+            //
+            // Arguments:
+            // std::string& out  --- In/Out
+            //
+            // Returns:
+            void AppendTo(std::string& out) const;
+
+            // ToString()
+            //
+            // Summary:
+            // Materializes the result
+            //
+            // Arguments:
+            //
+            // Returns:
+            // std::string
+            std::string ToString() const;
+
+            // Clear()
+            //
+            // Summary:
+            // Removes every piece, memory taken from the arena is not given back until the builder is destroyed
+            //
+            // Arguments:
+            //
+            // Returns:
+            void Clear();
+        };
+    }
+}
+
+#endif
@@ -3,10 +3,18 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cctype>
 #include <charconv>
 #include <concepts>
+#include <utility>
+
+#include "CasePkg.h"
+#include "FuzzyMatcherCls.h"
+#include "KeywordMatcherCls.h"
+#include "NumberPkg.h"
+#include "SplitViewCls.h"
 
 namespace UtilityLib
 {
@@ -35,6 +43,9 @@ namespace UtilityLib
         // If searched character is found twice without any other character in between
         // Empty string will not be added to the list
         // For example; Divide("string1\n\nstring2", '\n') will return ["string1", "string2"] not ["string1", "", "string2"]
+        // 
+        // Every piece is copied into a new std::string
+        // Use SplitViewCls to iterate over pieces without any allocation
         std::vector<std::string> Divide(const std::string& str, const char ch);
         // Divide()
         // 
@@ -52,6 +63,9 @@ namespace UtilityLib
         // If searched substring is found twice without any other character in between
         // Empty string will not be added to the list
         // For example; Divide("string1\n\n\n\nstring2", "\n\n") will return ["string1", "string2"] not ["string1", "", "string2"]
+        // 
+        // Every piece is copied into a new std::string
+        // Use SplitViewCls to iterate over pieces without any allocation
         std::vector<std::string> Divide(const std::string& str, const std::string& substr);
         // Filter()
         // 
@@ -76,7 +90,52 @@ namespace UtilityLib
         // 
         // Returns:
         // std::vector<std::string>
+        // 
+        // Keywords are compiled into a KeywordMatcherCls on every call
+        // Use the overload that takes a KeywordMatcherCls if the same keyword list is used more than once
         std::vector<std::string> Filter(const std::vector<std::string>& strList, const std::vector<std::string>& keywordList);
+        // Filter()
+        // 
+        // Summary
+        // Filters strings that contains any of the keywords of a compiled matcher, returns the remaining strings as a vector
+        // Each string is scanned once, regardless of the keyword count
+        // 
+        // Arguments:
+        // std::vector<std::string> "strList"  --- In
+        // KeywordMatcherCls "matcher"         --- In
+        // 
+        // Returns:
+        // std::vector<std::string>
+        std::vector<std::string> Filter(const std::vector<std::string>& strList, const KeywordMatcherCls& matcher);
+        // FuzzyFilter()
+        // 
+        // Summary
+        // Returns the strings that are at most maxDistance edits (Levenshtein distance) away from the pattern
+        // Strings keep their order, lists of more than 1024 strings are matched on every core (ForEachChunk() of ParallelPkg.h)
+        // 
+        // Arguments:
+        // std::vector<std::string> "strList"  --- In
+        // std::string "pattern"               --- In
+        // size_t "maxDistance"                --- In
+        // 
+        // Returns:
+        // std::vector<std::string>
+        // 
+        // Unlike Filter(), matching strings are kept and the others are removed
+        std::vector<std::string> FuzzyFilter(const std::vector<std::string>& strList, const std::string& pattern, size_t maxDistance);
+        // FuzzyFilter()
+        // 
+        // Summary
+        // Returns the strings that are at most maxDistance edits away from the pattern of a compiled matcher
+        // 
+        // Arguments:
+        // std::vector<std::string> "strList"  --- In
+        // FuzzyMatcherCls "matcher"           --- In
+        // size_t "maxDistance"                --- In
+        // 
+        // Returns:
+        // std::vector<std::string>
+        std::vector<std::string> FuzzyFilter(const std::vector<std::string>& strList, const FuzzyMatcherCls& matcher, size_t maxDistance);
         // LeftTrim()
         // 
         // Summary
@@ -138,30 +197,37 @@ namespace UtilityLib
         // 
         // Summary
         // Checks if a string starts with specified prefix
+        // Can be evaluated at compile time
         // 
         // Arguments:
-        // std::string "str"     --- In
-        // std::string "prefix"  --- In
+        // std::string_view "str"     --- In
+        // std::string_view "prefix"  --- In
         // 
         // Returns:
         // bool
-        bool IsStartWith(const std::string& str, const std::string& prefix);
+        constexpr bool IsStartWith(std::string_view str, std::string_view prefix)
+        {
+            return str.size() >= prefix.size() && str.substr(0, prefix.size()) == prefix;
+        }
         // IsEndWith()
         // 
         // Summary
         // Checks if a string ends with specified suffix
+        // Can be evaluated at compile time
         // 
         // Arguments:
-        // std::string "str"     --- In
-        // std::string "suffix"  --- In
+        // std::string_view "str"     --- In
+        // std::string_view "suffix"  --- In
         // 
         // Returns:
         // bool
         // 
         // Assumptions:
-        // Do not provide a suffix that is longer than the string itself
-        // Result will be undefined
-        bool IsEndWith(const std::string& str, const std::string& suffix);
+        // A suffix that is longer than the string never matches
+        constexpr bool IsEndWith(std::string_view str, std::string_view suffix)
+        {
+            return str.size() >= suffix.size() && str.substr(str.size() - suffix.size()) == suffix;
+        }
         // Replace()
         // 
         // Summary
@@ -193,9 +259,56 @@ namespace UtilityLib
         // std::string
         // 
         // Assumptions:
-        // Do not provide "srcSubstr" that is longer than the "str"
-        // Result will be undefined
+        // If "srcSubstr" is empty, "str" is returned unchanged
         std::string ReplaceAll(const std::string& str, const std::string& srcSubstr, const std::string& dstSubstr);
+        // ReplaceAll()
+        // 
+        // Summary
+        // Replaces all occurences of a substring with another substring
+        // Works in place when "dstSubstr" is not longer than "srcSubstr", "str" is moved into the result
+        // 
+        // Arguments:
+        // std::string&& "str"      --- In
+        // std::string "srcSubstr"  --- In
+        // std::string "dstSubstr"  --- In
+        // 
+        // Returns:
+        // std::string
+        // 
+        // Assumptions:
+        // If "srcSubstr" is empty, "str" is returned unchanged
+        std::string ReplaceAll(std::string&& str, const std::string& srcSubstr, const std::string& dstSubstr);
+        // ReplaceMany()
+        // 
+        // Summary
+        // Replaces all occurences of many substrings at once, e.g. ReplaceMany(str, { { "${HOST}", host }, { "${PORT}", port } })
+        // All patterns are found in a single pass, result is allocated once with its exact size
+        // 
+        // Arguments:
+        // std::string "str"                                                   --- In
+        // std::vector<std::pair<std::string, std::string>> "replacementList"  --- In (pairs of { pattern, replacement })
+        // 
+        // Returns:
+        // std::string
+        // 
+        // Assumptions:
+        // Matches are taken from left to right and never overlap, when more than one pattern starts at the same index
+        // the longest one is replaced. Replaced text is not searched again
+        // Empty patterns are ignored
+        std::string ReplaceMany(const std::string& str, const std::vector<std::pair<std::string, std::string>>& replacementList);
+        // ReplaceMany()
+        // 
+        // Summary
+        // Same as ReplaceMany() above, but works in place when no replacement is longer than its pattern
+        // "str" is moved into the result
+        // 
+        // Arguments:
+        // std::string&& "str"                                                 --- In
+        // std::vector<std::pair<std::string, std::string>> "replacementList"  --- In (pairs of { pattern, replacement })
+        // 
+        // Returns:
+        // std::string
+        std::string ReplaceMany(std::string&& str, const std::vector<std::pair<std::string, std::string>>& replacementList);
         // ToLower()
         // 
         // Summary
@@ -206,7 +319,21 @@ namespace UtilityLib
         // 
         // Returns:
         // std::string
+        // 
+        // Assumptions:
+        // Only ASCII letters are converted, see CasePkg.h
         std::string ToLower(const std::string& str);
+        // ToLower()
+        // 
+        // Summary
+        // Converts all characters to the lowercase, in place. "str" is moved into the result
+        // 
+        // Arguments:
+        // std::string&& "str"  --- In
+        // 
+        // Returns:
+        // std::string
+        std::string ToLower(std::string&& str);
         // ToUpper()
         // 
         // Summary
@@ -217,7 +344,21 @@ namespace UtilityLib
         // 
         // Returns:
         // std::string
+        // 
+        // Assumptions:
+        // Only ASCII letters are converted, see CasePkg.h
         std::string ToUpper(const std::string& str);
+        // ToUpper()
+        // 
+        // Summary
+        // Converts all characters to the uppercase, in place. "str" is moved into the result
+        // 
+        // Arguments:
+        // std::string&& "str"  --- In
+        // 
+        // Returns:
+        // std::string
+        std::string ToUpper(std::string&& str);
         // RemoveSubstring()
         // 
         // Summary
@@ -231,9 +372,20 @@ namespace UtilityLib
         // std::string
         // 
         // Assumptions:
-        // Do not provide a "substr" that is longer than "str"
-        // Result will be undefined
+        // If "substr" is empty, "str" is returned unchanged
         std::string RemoveSubstring(const std::string& str, const std::string& substr);
+        // RemoveSubstring()
+        // 
+        // Summary
+        // Removes all occurences of substring from string, in place. "str" is moved into the result
+        // 
+        // Arguments:
+        // std::string&& "str"   --- In
+        // std::string "substr"  --- In
+        // 
+        // Returns:
+        // std::string
+        std::string RemoveSubstring(std::string&& str, const std::string& substr);
         // RemoveSubstrings()
         // 
         // Summary
@@ -247,9 +399,21 @@ namespace UtilityLib
         // std::string
         // 
         // Assumptions:
-        // Do not provide a "substr" that is longer than "str"
-        // Result will be undefined
+        // All substrings are removed in a single pass (see ReplaceMany())
+        // Text that is joined after a removal is not searched again
         std::string RemoveSubstrings(const std::string& str, const std::vector<std::string>& substrList);
+        // RemoveSubstrings()
+        // 
+        // Summary
+        // Removes all occurences of all of the substrings from string, in place. "str" is moved into the result
+        // 
+        // Arguments:
+        // std::string&& "str"                    --- In
+        // std::vector<std::string> "substrList"  --- In
+        // 
+        // Returns:
+        // std::string
+        std::string RemoveSubstrings(std::string&& str, const std::vector<std::string>& substrList);
         // RemoveDuplicateChars()
         // 
         // Summary
@@ -265,6 +429,8 @@ namespace UtilityLib
         // 
         // Summary
         // Divide strings into words vector
+        // Words are runs of letters, digits and "'", every other character separates words and is dropped
+        // Use WordViewCls to iterate words without copying them
         // 
         // Arguments:
         // std::string "str"  --- In
@@ -276,6 +442,7 @@ namespace UtilityLib
         // 
         // Summary
         // Removes duplicate words from string
+        // Distinct words are kept in order of first occurrence and joined with single spaces
         // 
         // Arguments:
         // std::string "str"  --- In
@@ -299,7 +466,8 @@ namespace UtilityLib
         // EncodeBase64()
         // 
         // Summary
-        // Encodes provided string to base 64
+        // Encodes provided string to base 64 (standard alphabet, padded)
+        // See Base64Pkg.h for decoding, the URL-safe alphabet and streaming
         // 
         // Arguments:
         // std::string "in"  --- In
@@ -364,53 +532,105 @@ namespace UtilityLib
         // Returns:
         // bool
         bool IsIntegral(const std::string& str);
-        // IntegralToString()
+        // StringToFloating()
         // 
         // Summary:
-        // Transforms integral type to std::string
+        // Transforms string literal to the floating point type
+        // Accepts both fixed and scientific notation, "inf" and "nan"
         // 
         // Arguments:
-        // T val  --- In (T must be integral type)
+        // const std::string& str  --- In
+        // T& value                --- Out (T must be floating point type)
+        // size_t offset           --- In (when no offset is provided, check will start at the start of string)
+        // size_t count            --- In (when no count is provided, check will continue until the end of string)
         // 
         // Returns:
-        // std::string
-        template<std::integral T>
-        std::string IntegralToString(T val)
+        // StringError
+        template<std::floating_point T>
+        StringError StringToFloating(const std::string& str, T& value, size_t offset = 0, size_t count = 0)
         {
-            std::string result;
+            if (offset + count > str.size())
+            {
+                return StringError::InvalidArgument;
+            }
+
+            if (count == 0)
+            {
+                count = str.size() - offset;
+            }
+
+            StringError result = StringError::Success;
+
+            const char* start = str.data() + offset;
+            const char* end = str.data() + offset + count;
+
+            std::from_chars_result conversionResult = std::from_chars(start, end, value);
 
-            while (val > 0)
+            if (conversionResult.ec == std::errc::invalid_argument)
+            {
+                result = StringError::InvalidArgument;
+            }
+            else if (conversionResult.ec == std::errc::result_out_of_range)
             {
-                T remainder = val % 10;
-                char digitAsChar = static_cast<char>(remainder + '0');
-                result.insert(result.begin(), digitAsChar);
-                val /= 10;
+                result = StringError::OutOfRange;
             }
 
             return result;
         }
+        // IntegralToString()
+        // 
+        // Summary:
+        // Transforms integral type to std::string
+        // Use FormatIntegral() or AppendIntegral() from NumberPkg.h to avoid the allocation
+        // 
+        // Arguments:
+        // T val  --- In (T must be integral type)
+        // 
+        // Returns:
+        // std::string
+        template<FormattableIntegral T>
+        std::string IntegralToString(T val)
+        {
+            char buffer[MAX_INTEGRAL_CHARS<T>];
+            return std::string(buffer, FormatIntegral(val, buffer));
+        }
+        // FloatingToString()
+        // 
+        // Summary:
+        // Transforms floating point type to std::string
+        // Result is the shortest string that StringToFloating() transforms back to exactly the same value
+        // 
+        // Arguments:
+        // float/double val  --- In
+        // 
+        // Returns:
+        // std::string
+        std::string FloatingToString(float val);
+        std::string FloatingToString(double val);
         // ValidateIpAddress()
         // 
         // Summary:
-        // Validates the provided string is a valid IP address
+        // Validates the provided string is a valid IPv4 address (dotted quad, no leading zeros)
+        // Use IpAddressCls::Parse() instead if the address is needed afterwards, it validates and parses in one pass
         // 
         // Arguments:
-        // const std::string& ipAddress  --- In
+        // std::string_view ipAddress  --- In
         // 
         // Returns:
         // bool
-        bool ValidateIpAddress(const std::string& ipAddress);
+        bool ValidateIpAddress(std::string_view ipAddress);
         // ValidatePort()
         // 
         // Summary:
-        // Checks if provided string is a valid port number
+        // Checks if provided string is a valid port number (0 - 65535, digits only)
+        // Use ParsePort() in EndpointCls.h instead if the value is needed afterwards
         // 
         // Arguments:
-        // const std::string& port  --- In
+        // std::string_view port  --- In
         // 
         // Returns:
         // bool
-        bool ValidatePort(const std::string& port);
+        bool ValidatePort(std::string_view port);
         // Reverse()
         // 
         // Summary:
@@ -0,0 +1,136 @@
+#ifndef STRINGPOOLCLS_H
+#define STRINGPOOLCLS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Handle of an interned string, two handles from the same pool are equal only if their strings are equal
+        using StringId = uint32_t;
+
+        constexpr StringId INVALID_STRING_ID = UINT32_MAX;
+
+        // Stores every distinct string once and hands out 32 bit ids for them
+        //
+        // Characters are copied into arenas owned by the pool and are never moved or freed until the pool is destroyed,
+        // so views returned by GetView() stay valid for the whole lifetime of the pool
+        // Stored strings are null terminated, GetView(id).data() can be passed to C APIs
+        //
+        // The pool is split into shards by hash, each shard has its own reader/writer lock,
+        // so lookups of already interned strings from different threads only take shared locks
+        // GetView() takes no lock at all
+        //
+        // StringPoolCls pool;
+        // StringId id = pool.Intern(filename);
+        // std::string_view name = pool.GetView(id);
+        class StringPoolCls
+        {
+        private:
+            static constexpr size_t SHARD_BITS = 4;
+            static constexpr size_t SHARD_COUNT = size_t{ 1 } << SHARD_BITS;
+            static constexpr size_t MAX_SHARD_ENTRIES = size_t{ 1 } << (32 - SHARD_BITS);
+
+            // Entries of a shard are kept in segments that double in size, so they never move once written
+            static constexpr size_t FIRST_SEGMENT_SIZE = 256;
+            static constexpr size_t SEGMENT_COUNT = 21;
+
+            struct EntryStc
+            {
+                const char* Data;
+                uint32_t Size;
+            };
+
+            // Index is entry index + 1, 0 marks an empty slot
+            struct SlotStc
+            {
+                uint32_t Hash;
+                uint32_t Index;
+            };
+
+            struct alignas(64) ShardStc
+            {
+                mutable std::shared_mutex Mutex;
+                std::pmr::monotonic_buffer_resource Arena;
+                std::vector<SlotStc> SlotList;
+                std::atomic<EntryStc*> SegmentList[SEGMENT_COUNT];
+                size_t Count;
+
+                ShardStc();
+            };
+
+            ShardStc ShardList[SHARD_COUNT];
+
+            static uint64_t Hash(std::string_view str);
+            static EntryStc& GetEntry(const ShardStc& shard, size_t index);
+            static uint32_t FindIndex(const ShardStc& shard, std::string_view str, uint64_t hash);
+            static void Grow(ShardStc& shard);
+
+        public:
+            StringPoolCls() = default;
+
+            // Views and ids point into the pool itself
+            StringPoolCls(const StringPoolCls&) = delete;
+            StringPoolCls& operator=(const StringPoolCls&) = delete;
+
+            // Intern()
+            //
+            // Summary:
+            // Returns id of str, copying str into the pool if it is not there yet
+            // Safe to call from multiple threads
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // StringId (INVALID_STRING_ID if str is longer than UINT32_MAX or the pool is full)
+            StringId Intern(std::string_view str);
+
+            // Find()
+            //
+            // Summary:
+            // Returns id of str without adding it to the pool
+            // Safe to call from multiple threads
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // StringId (INVALID_STRING_ID if str was never interned)
+            StringId Find(std::string_view str) const;
+
+            // GetView()
+            //
+            // Summary:
+            // Returns the string of an id, valid until the pool is destroyed
+            // Takes no lock, id must have been returned by this pool
+            //
+            // Arguments:
+            // StringId id  --- In
+            //
+            // Returns:
+            // std::string_view
+            std::string_view GetView(StringId id) const;
+
+            // GetCount()
+            //
+            // Summary:
+            // Returns number of distinct strings in the pool
+            //
+            // Arguments:
+            //
+            // Returns:
+            // size_t
+            size_t GetCount() const;
+        };
+    }
+}
+
+#endif
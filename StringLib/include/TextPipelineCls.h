@@ -0,0 +1,213 @@
+#ifndef TEXTPIPELINECLS_H
+#define TEXTPIPELINECLS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "KeywordMatcherCls.h"
+#include "SearcherCls.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        class TextPipelineCls;
+        class TextStreamCls;
+
+        // Stages of TextPipelineCls, each one does what the StringPkg.h function with the same name does
+        namespace Pipe
+        {
+            TextPipelineCls LeftTrim();
+            TextPipelineCls RightTrim();
+            TextPipelineCls Trim();
+            TextPipelineCls ToLower();
+            TextPipelineCls ToUpper();
+            // Empty "srcSubstr" leaves the text unchanged
+            TextPipelineCls ReplaceAll(std::string_view srcSubstr, std::string_view dstSubstr);
+            // Empty patterns are ignored
+            TextPipelineCls ReplaceMany(const std::vector<std::pair<std::string, std::string>>& replacementList);
+            TextPipelineCls ReplaceTabsWithSpaces(uint32_t spaceCount = 4);
+            TextPipelineCls RemoveSubstring(std::string_view substr);
+            TextPipelineCls RemoveSubstrings(const std::vector<std::string>& substrList);
+        }
+
+        // Chain of text transformations that runs as a single pass
+        //
+        // Stages are created by the functions of the Pipe namespace above and joined with operator|,
+        // the result is the same as calling the StringPkg.h functions one after the other:
+        //
+        // TextPipelineCls normalize = Pipe::Trim() | Pipe::ToLower() | Pipe::ReplaceTabsWithSpaces(4) | Pipe::RemoveSubstrings({ "\r" });
+        // std::string line = normalize.Apply(rawLine);    // Same as RemoveSubstrings(ReplaceTabsWithSpaces(ToLower(Trim(rawLine)), 4), { "\r" })
+        //
+        // Input is cut into blocks of BLOCK_SIZE bytes and every block goes through all of the stages before the next one is read,
+        // so intermediate text only lives in small per stage buffers that stay in the cache, and only the output is allocated
+        // Stages that need to see more than one block keep the smallest possible state between blocks:
+        // Trim stages count the spaces they have not written yet, replacement stages keep the last (longest pattern - 1) bytes,
+        // which could be the start of a match that is completed by the next block
+        //
+        // A pipeline is immutable, it can be shared between threads, every Apply() call and every TextStreamCls has its own state
+        class TextPipelineCls
+        {
+        private:
+            friend class TextStreamCls;
+            friend TextPipelineCls Pipe::LeftTrim();
+            friend TextPipelineCls Pipe::RightTrim();
+            friend TextPipelineCls Pipe::Trim();
+            friend TextPipelineCls Pipe::ToLower();
+            friend TextPipelineCls Pipe::ToUpper();
+            friend TextPipelineCls Pipe::ReplaceAll(std::string_view srcSubstr, std::string_view dstSubstr);
+            friend TextPipelineCls Pipe::ReplaceMany(const std::vector<std::pair<std::string, std::string>>& replacementList);
+
+            enum class StageType
+            {
+                LeftTrim = 0,
+                RightTrim,
+                Trim,
+                ToLower,
+                ToUpper,
+                ReplaceAll, // Single pattern, SearcherCls
+                ReplaceMany // Pattern list, KeywordMatcherCls (leftmost, then longest match, same as ReplaceMany())
+            };
+
+            struct StageStc
+            {
+                StageType Type;
+                SearcherCls Searcher;
+                std::string Replacement;
+                KeywordMatcherCls Matcher;
+                std::vector<std::string> ReplacementList; // Replacement of every keyword of the matcher
+                size_t MaxPatternSize;                    // 0 if the stage has no pattern (or only empty ones)
+            };
+
+            std::vector<StageStc> StageList;
+
+            explicit TextPipelineCls(StageType type);
+
+        public:
+            // Bytes that go through the stages at once
+            static constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+            // Default constructed pipeline has no stages, it copies its input
+            TextPipelineCls();
+
+            // operator|()
+            //
+            // Summary:
+            // Returns a pipeline that runs the stages of this pipeline, then the stages of "next"
+            //
+            // Arguments:
+            // const TextPipelineCls& next  --- In
+            //
+            // Returns:
+            // TextPipelineCls
+            TextPipelineCls operator|(const TextPipelineCls& next) const;
+
+            // Apply()
+            //
+            // Summary:
+            // Runs the pipeline on a string
+            // Output is reserved once with the input size, it only grows again if replacements make the text longer
+            //
+            // Arguments:
+            // std::string_view str  --- In
+            //
+            // Returns:
+            // std::string
+            std::string Apply(std::string_view str) const;
+
+            // Apply()
+            //
+            // Summary:
+            // Runs the pipeline on everything that can be read from the stream, BLOCK_SIZE bytes at a time
+            //
+            // Arguments:
+            // std::istream& stream  --- In
+            //
+            // Returns:
+            // std::string
+            std::string Apply(std::istream& stream) const;
+
+            // GetStageCount()
+            //
+            // Summary:
+            // Returns number of stages
+            //
+            // Arguments:
+            //
+            // Returns:
+            // size_t
+            size_t GetStageCount() const;
+        };
+
+        // Runs a pipeline on input that arrives in chunks (file blocks, socket reads)
+        // Input can be split at any byte, output is identical to running Apply() on the whole input at once
+        //
+        // TextStreamCls stream(normalize);
+        // while (ReadChunk(chunk)) { out.clear(); stream.Update(chunk, out); Write(out); }
+        // out.clear(); stream.Finish(out); Write(out);
+        //
+        // Important: The pipeline must outlive the stream
+        class TextStreamCls
+        {
+        private:
+            // Carried state of a single stage
+            struct StageStateStc
+            {
+                bool IsStarted;       // LeftTrim: first non-space byte was seen
+                size_t PendingSpaces; // RightTrim: spaces that are only written if a non-space byte follows
+                std::string Carry;    // Replacement: bytes that could be the start of an incomplete match
+                std::string Scratch;  // Output of case conversion and replacement stages
+            };
+
+            const TextPipelineCls& Pipeline;
+            std::vector<StageStateStc> StateList;
+            std::string* Out;
+
+            void Push(size_t index, std::string_view piece);
+            void PushTrim(size_t index, std::string_view piece);
+            void PushCase(size_t index, std::string_view piece);
+            void PushReplace(size_t index, std::string_view piece);
+            size_t ReplaceRange(size_t index, std::string_view data, size_t limit, std::string& output);
+            void PushSpaces(size_t index, size_t count);
+            void Flush(size_t index);
+
+        public:
+            // Constructor
+            //
+            // Arguments:
+            // const TextPipelineCls& pipeline  --- In
+            explicit TextStreamCls(const TextPipelineCls& pipeline);
+
+            // Update()
+            //
+            // Summary:
+            // Runs the chunk through the pipeline
+            // Output that can still change (trailing spaces, possible start of a match) is kept for the next call
+            //
+            // Arguments:
+            // std::string_view chunk  --- In
+            // std::string& out        --- Out (transformed text is appended)
+            //
+            // Returns:
+            void Update(std::string_view chunk, std::string& out);
+
+            // Finish()
+            //
+            // Summary:
+            // Writes the kept output, stream can be used for a new input afterwards
+            //
+            // Arguments:
+            // std::string& out  --- Out (transformed text is appended)
+            //
+            // Returns:
+            void Finish(std::string& out);
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef UTF8PKG_H
+#define UTF8PKG_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "StringPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // UTF-8 validation, counting, transcoding and lowercase conversion
+        //
+        // Validation follows RFC 3629: overlong forms, surrogates (U+D800 - U+DFFF), code points above U+10FFFF
+        // and truncated sequences are all errors
+        // Validation uses the lookup table algorithm of Keiser and Lemire (AVX2 or SSSE3, picked once through cpuid),
+        // every other function has an ASCII fast path that handles 16 or 32 bytes at a time
+
+        // ValidateUtf8()
+        //
+        // Summary:
+        // Checks if str is valid UTF-8
+        //
+        // Arguments:
+        // std::string_view str  --- In
+        //
+        // Returns:
+        // bool
+        bool ValidateUtf8(std::string_view str);
+
+        // FindInvalidUtf8()
+        //
+        // Summary:
+        // Finds the first byte that does not start a valid UTF-8 sequence
+        //
+        // Arguments:
+        // std::string_view str  --- In
+        //
+        // Returns:
+        // size_t (std::string_view::npos if str is valid UTF-8)
+        size_t FindInvalidUtf8(std::string_view str);
+
+        // CountUtf8CodePoints()
+        //
+        // Summary:
+        // Counts code points of a valid UTF-8 string (bytes that are not continuation bytes)
+        //
+        // Arguments:
+        // std::string_view str  --- In (must be valid UTF-8, result is meaningless otherwise)
+        //
+        // Returns:
+        // size_t
+        size_t CountUtf8CodePoints(std::string_view str);
+
+        // Utf8ToUtf16()
+        //
+        // Summary:
+        // Converts UTF-8 to UTF-16, code points above U+FFFF become surrogate pairs
+        //
+        // Arguments:
+        // std::string_view str  --- In
+        // std::u16string& out   --- Out (replaced, empty on failure)
+        //
+        // Returns:
+        // StringError (InvalidArgument if str is not valid UTF-8)
+        StringError Utf8ToUtf16(std::string_view str, std::u16string& out);
+
+        // Utf8ToUtf32()
+        //
+        // Summary:
+        // Converts UTF-8 to UTF-32
+        //
+        // Arguments:
+        // std::string_view str  --- In
+        // std::u32string& out   --- Out (replaced, empty on failure)
+        //
+        // Returns:
+        // StringError (InvalidArgument if str is not valid UTF-8)
+        StringError Utf8ToUtf32(std::string_view str, std::u32string& out);
+
+        // Utf16ToUtf8()
+        //
+        // Summary:
+        // Converts UTF-16 to UTF-8
+        //
+        // Arguments:
+        // std::u16string_view str  --- In
+        // std::string& out         --- Out (replaced, empty on failure)
+        //
+        // Returns:
+        // StringError (InvalidArgument if str has an unpaired surrogate)
+        StringError Utf16ToUtf8(std::u16string_view str, std::string& out);
+
+        // Utf32ToUtf8()
+        //
+        // Summary:
+        // Converts UTF-32 to UTF-8
+        //
+        // Arguments:
+        // std::u32string_view str  --- In
+        // std::string& out         --- Out (replaced, empty on failure)
+        //
+        // Returns:
+        // StringError (InvalidArgument if str has a surrogate or a value above U+10FFFF)
+        StringError Utf32ToUtf8(std::u32string_view str, std::string& out);
+
+        // ToLowerUtf8()
+        //
+        // Summary:
+        // Converts [first, last) to lowercase in place
+        // ASCII is converted with ToLowerAscii(), then the non ASCII parts are visited one sequence at a time
+        // Uppercase letters of Latin-1, Latin Extended-A, Greek and Cyrillic are converted, their lowercase forms
+        // have the same encoded length so the string never changes size
+        // Other characters and invalid sequences are left untouched
+        //
+        // Arguments:
+        // char* first  --- In/Out
+        // char* last   --- In
+        //
+        // Returns:
+        void ToLowerUtf8(char* first, char* last);
+
+        // ToLowerUtf8()
+        //
+        // Summary:
+        // Writes lowercase version of src into dst, see ToLowerUtf8(char*, char*)
+        //
+        // Arguments:
+        // std::string_view src  --- In
+        // char* dst             --- Out (must have room for src.size() characters, can be equal to src.data())
+        //
+        // Returns:
+        void ToLowerUtf8(std::string_view src, char* dst);
+    }
+}
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef WORDVIEWCLS_H
+#define WORDVIEWCLS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+#include "ScanPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Lazy, allocation free word tokenizer
+        // A word is a maximal run of word characters (letters, digits and "'" by default), everything else separates words
+        // and is never part of a word, so punctuation and whitespace are dropped
+        //
+        // Characters are classified 512 bytes at a time into a bitmap (BuildSetBitmap() in ScanPkg.h, SIMD range compares,
+        // or the 256 bit class table of ByteSetCls for sets that are not a few ranges)
+        // Word starts and ends of each 64 byte block are then extracted together with bit scans, so moving to the next word
+        // does not branch on the characters
+        //
+        // for (std::string_view word : WordViewCls(text)) { ... }
+        //
+        // Important: String is not copied, it must outlive the view and every word taken from it
+        class WordViewCls : public std::ranges::view_interface<WordViewCls>
+        {
+        private:
+            std::string_view Source;
+            ByteSetCls WordChars;
+
+        public:
+            class Iterator
+            {
+            private:
+                static constexpr size_t BITMAP_SIZE = 8;
+
+                const WordViewCls* Parent;
+
+                // Word character bitmap of the next BITMAP_SIZE * 64 bytes
+                uint64_t Bitmap[BITMAP_SIZE];
+                size_t BitmapIndex;
+                size_t BitmapCount;
+                size_t BitmapStart;
+                uint64_t Carry;
+
+                // Offsets of word starts and ends inside the current 64 byte block, they alternate
+                uint8_t TransitionList[64];
+                size_t TransitionIndex;
+                size_t TransitionCount;
+                size_t BlockStart;
+
+                std::string_view Word;
+                bool IsEnd;
+
+                bool LoadBlock();
+                void Advance();
+
+                friend class WordViewCls;
+
+            public:
+                using iterator_concept = std::forward_iterator_tag;
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = std::string_view;
+                using difference_type = std::ptrdiff_t;
+
+                Iterator() :
+                    Parent(nullptr),
+                    Bitmap{},
+                    BitmapIndex(0),
+                    BitmapCount(0),
+                    BitmapStart(0),
+                    Carry(0),
+                    TransitionList{},
+                    TransitionIndex(0),
+                    TransitionCount(0),
+                    BlockStart(0),
+                    IsEnd(true)
+                {
+                }
+
+                std::string_view operator*() const
+                {
+                    return Word;
+                }
+                Iterator& operator++()
+                {
+                    Advance();
+                    return *this;
+                }
+                Iterator operator++(int)
+                {
+                    Iterator previous = *this;
+                    Advance();
+                    return previous;
+                }
+                bool operator==(const Iterator& other) const
+                {
+                    if (IsEnd || other.IsEnd)
+                    {
+                        return IsEnd == other.IsEnd;
+                    }
+                    return Word.data() == other.Word.data();
+                }
+                bool operator==(std::default_sentinel_t) const
+                {
+                    return IsEnd;
+                }
+            };
+
+            // Default constructed view yields no words
+            WordViewCls();
+
+            // Constructor
+            //
+            // Arguments:
+            // std::string_view str         --- In
+            // const ByteSetCls& wordChars  --- In (default WORD_CHARS, bytes that can be part of a word)
+            WordViewCls(std::string_view str, const ByteSetCls& wordChars = WORD_CHARS);
+
+            // Returns an iterator to the first word
+            Iterator begin() const;
+            // Returns std::default_sentinel, iterator compares equal to it after the last word
+            std::default_sentinel_t end() const;
+        };
+
+        // CountWords()
+        //
+        // Summary:
+        // Counts words of str without yielding them, word starts are counted with popcount on the character bitmap
+        //
+        // Arguments:
+        // std::string_view str         --- In
+        // const ByteSetCls& wordChars  --- In (default WORD_CHARS)
+        //
+        // Returns:
+        // size_t
+        size_t CountWords(std::string_view str, const ByteSetCls& wordChars = WORD_CHARS);
+
+        // GetUniqueWords()
+        //
+        // Summary:
+        // Returns every distinct word of str once, in order of first occurrence
+        // Words are compared case sensitively, through a flat hash set sized from CountWords()
+        //
+        // Arguments:
+        // std::string_view str         --- In (words point into str)
+        // const ByteSetCls& wordChars  --- In (default WORD_CHARS)
+        //
+        // Returns:
+        // std::vector<std::string_view>
+        std::vector<std::string_view> GetUniqueWords(std::string_view str, const ByteSetCls& wordChars = WORD_CHARS);
+    }
+}
+
+#endif
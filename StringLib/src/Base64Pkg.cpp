@@ -0,0 +1,630 @@
+#include "Base64Pkg.h"
+#include "CpuFeaturePkg.h"
+
+#include <cstdint>
+
+#if defined(UTILITYLIB_X86)
+#include <immintrin.h>
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        static constexpr char STANDARD_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        static constexpr char URL_SAFE_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+        static constexpr uint8_t INVALID_VALUE = 0xFF;
+
+        struct DecodeTableStc
+        {
+            uint8_t Value[256];
+        };
+
+        static constexpr DecodeTableStc BuildDecodeTable(const char* chars)
+        {
+            DecodeTableStc table{};
+            for (size_t i = 0; i < 256; i++)
+            {
+                table.Value[i] = INVALID_VALUE;
+            }
+            for (size_t i = 0; i < 64; i++)
+            {
+                table.Value[static_cast<unsigned char>(chars[i])] = static_cast<uint8_t>(i);
+            }
+            return table;
+        }
+
+        static constexpr DecodeTableStc STANDARD_TABLE = BuildDecodeTable(STANDARD_CHARS);
+        static constexpr DecodeTableStc URL_SAFE_TABLE = BuildDecodeTable(URL_SAFE_CHARS);
+
+        static const char* GetChars(Base64Alphabet alphabet)
+        {
+            return alphabet == Base64Alphabet::UrlSafe ? URL_SAFE_CHARS : STANDARD_CHARS;
+        }
+        static const uint8_t* GetDecodeTable(Base64Alphabet alphabet)
+        {
+            return alphabet == Base64Alphabet::UrlSafe ? URL_SAFE_TABLE.Value : STANDARD_TABLE.Value;
+        }
+        static bool IsPadded(Base64Alphabet alphabet)
+        {
+            return alphabet == Base64Alphabet::Standard;
+        }
+
+        // Scalar kernels
+        // Encoding works on complete 3 byte groups, decoding on complete 4 character groups without padding
+
+        static size_t EncodeScalar(const unsigned char* in, size_t size, char* out, Base64Alphabet alphabet)
+        {
+            const char* chars = GetChars(alphabet);
+            char* start = out;
+
+            for (size_t i = 0; i + 3 <= size; i += 3)
+            {
+                uint32_t value = (static_cast<uint32_t>(in[i]) << 16) | (static_cast<uint32_t>(in[i + 1]) << 8) | in[i + 2];
+                out[0] = chars[value >> 18];
+                out[1] = chars[(value >> 12) & 0x3F];
+                out[2] = chars[(value >> 6) & 0x3F];
+                out[3] = chars[value & 0x3F];
+                out += 4;
+            }
+
+            return static_cast<size_t>(out - start);
+        }
+        static bool DecodeScalar(const char* in, size_t size, unsigned char* out, Base64Alphabet alphabet)
+        {
+            const uint8_t* table = GetDecodeTable(alphabet);
+
+            for (size_t i = 0; i + 4 <= size; i += 4)
+            {
+                uint32_t a = table[static_cast<unsigned char>(in[i])];
+                uint32_t b = table[static_cast<unsigned char>(in[i + 1])];
+                uint32_t c = table[static_cast<unsigned char>(in[i + 2])];
+                uint32_t d = table[static_cast<unsigned char>(in[i + 3])];
+                if (((a | b | c | d) & 0x80) != 0)
+                {
+                    return false;
+                }
+
+                uint32_t value = (a << 18) | (b << 12) | (c << 6) | d;
+                out[0] = static_cast<unsigned char>(value >> 16);
+                out[1] = static_cast<unsigned char>(value >> 8);
+                out[2] = static_cast<unsigned char>(value);
+                out += 3;
+            }
+
+            return true;
+        }
+
+#if defined(UTILITYLIB_X86)
+        // SSSE3 kernels
+        //
+        // Encoding: 12 input bytes are spread so every 32 bit word holds one 3 byte group,
+        // multiply tricks move the four 6 bit fields into separate bytes,
+        // and a 16 entry table indexed by the value range turns every value into its character
+        //
+        // Decoding: a character is valid if (table of its low nibble) & (table of its high nibble) is zero,
+        // the value is the character plus an offset that depends on the high nibble ('/' is the only exception)
+        // After that multiply-add instructions pack four 6 bit values into 3 bytes
+
+        UTILITYLIB_TARGET("ssse3")
+        static __m128i EncodeReshuffleSsse3(__m128i in)
+        {
+            in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+            __m128i high = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+            __m128i low = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+            return _mm_or_si128(high, low);
+        }
+        UTILITYLIB_TARGET("ssse3")
+        static __m128i EncodeTranslateSsse3(__m128i values, __m128i offsets)
+        {
+            // Ranges: 0-25 -> 'A', 26-51 -> 'a', 52-61 -> '0', 62 and 63 are the two alphabet specific characters
+            __m128i indices = _mm_subs_epu8(values, _mm_set1_epi8(51));
+            indices = _mm_sub_epi8(indices, _mm_cmpgt_epi8(values, _mm_set1_epi8(25)));
+            return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, indices));
+        }
+        UTILITYLIB_TARGET("ssse3")
+        static __m128i GetEncodeOffsetsSsse3(Base64Alphabet alphabet)
+        {
+            const char* chars = GetChars(alphabet);
+            return _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                                 static_cast<char>(chars[62] - 62), static_cast<char>(chars[63] - 63), 0, 0);
+        }
+        UTILITYLIB_TARGET("ssse3")
+        static size_t EncodeSsse3(const unsigned char* in, size_t size, char* out, Base64Alphabet alphabet)
+        {
+            const __m128i offsets = GetEncodeOffsetsSsse3(alphabet);
+            size_t i = 0;
+            size_t written = 0;
+
+            // 16 bytes are loaded, 12 of them are used
+            for (; i + 16 <= size; i += 12)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                __m128i encoded = EncodeTranslateSsse3(EncodeReshuffleSsse3(block), offsets);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + written), encoded);
+                written += 16;
+            }
+
+            return written + EncodeScalar(in + i, size - i, out + written, alphabet);
+        }
+
+        // Replaces "-_" with "+/" so the standard tables can be used, "+/" themselves are rejected
+        UTILITYLIB_TARGET("ssse3")
+        static __m128i UrlSafeToStandardSsse3(__m128i block, bool& isValid)
+        {
+            __m128i isDash = _mm_cmpeq_epi8(block, _mm_set1_epi8('-'));
+            __m128i isUnderscore = _mm_cmpeq_epi8(block, _mm_set1_epi8('_'));
+            __m128i isForbidden = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('+')), _mm_cmpeq_epi8(block, _mm_set1_epi8('/')));
+            isValid = _mm_movemask_epi8(isForbidden) == 0;
+
+            block = _mm_or_si128(_mm_andnot_si128(isDash, block), _mm_and_si128(isDash, _mm_set1_epi8('+')));
+            return _mm_or_si128(_mm_andnot_si128(isUnderscore, block), _mm_and_si128(isUnderscore, _mm_set1_epi8('/')));
+        }
+        UTILITYLIB_TARGET("ssse3")
+        static bool DecodeSsse3(const char* in, size_t size, unsigned char* out, Base64Alphabet alphabet)
+        {
+            const __m128i lowTable = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                   0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+            const __m128i highTable = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+            const __m128i rollTable = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                                    0, 0, 0, 0, 0, 0, 0, 0);
+            const __m128i slash = _mm_set1_epi8('/');
+            const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+            const bool isUrlSafe = alphabet == Base64Alphabet::UrlSafe;
+            size_t i = 0;
+            size_t written = 0;
+
+            // 16 bytes are stored, 12 of them are used, so at least 4 more bytes must follow in the output
+            for (; i + 32 <= size; i += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                if (isUrlSafe)
+                {
+                    bool isValid = true;
+                    block = UrlSafeToStandardSsse3(block, isValid);
+                    if (isValid == false)
+                    {
+                        return false;
+                    }
+                }
+
+                __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(block, 4), nibbleMask);
+                __m128i lowNibbles = _mm_and_si128(block, nibbleMask);
+                __m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lowTable, lowNibbles), _mm_shuffle_epi8(highTable, highNibbles));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) != 0xFFFF)
+                {
+                    return false;
+                }
+
+                __m128i roll = _mm_shuffle_epi8(rollTable, _mm_add_epi8(_mm_cmpeq_epi8(block, slash), highNibbles));
+                __m128i values = _mm_add_epi8(block, roll);
+
+                __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+                __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+                __m128i bytes = _mm_shuffle_epi8(words, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + written), bytes);
+                written += 12;
+            }
+
+            return DecodeScalar(in + i, size - i, out + written, alphabet);
+        }
+
+        // AVX2 kernels
+        // Same algorithms as above, both 128 bit lanes work on their own 12 bytes / 16 characters
+
+        UTILITYLIB_TARGET("avx2")
+        static size_t EncodeAvx2(const unsigned char* in, size_t size, char* out, Base64Alphabet alphabet)
+        {
+            const __m128i offsets128 = GetEncodeOffsetsSsse3(alphabet);
+            const __m256i offsets = _mm256_broadcastsi128_si256(offsets128);
+            const __m256i spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+            size_t i = 0;
+            size_t written = 0;
+
+            // Second lane loads 16 bytes starting at i + 12
+            for (; i + 28 <= size; i += 24)
+            {
+                __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12));
+                __m256i block = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+
+                block = _mm256_shuffle_epi8(block, spread);
+                __m256i highBits = _mm256_mulhi_epu16(_mm256_and_si256(block, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+                __m256i lowBits = _mm256_mullo_epi16(_mm256_and_si256(block, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+                __m256i values = _mm256_or_si256(highBits, lowBits);
+
+                __m256i indices = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+                indices = _mm256_sub_epi8(indices, _mm256_cmpgt_epi8(values, _mm256_set1_epi8(25)));
+                __m256i encoded = _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, indices));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + written), encoded);
+                written += 32;
+            }
+
+            return written + EncodeSsse3(in + i, size - i, out + written, alphabet);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static bool DecodeAvx2(const char* in, size_t size, unsigned char* out, Base64Alphabet alphabet)
+        {
+            const __m256i lowTable = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                                      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                                      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+            const __m256i highTable = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                       0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                                       0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                                       0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+            const __m256i rollTable = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                                       0, 0, 0, 0, 0, 0, 0, 0,
+                                                       0, 16, 19, 4, -65, -65, -71, -71,
+                                                       0, 0, 0, 0, 0, 0, 0, 0);
+            const __m256i slash = _mm256_set1_epi8('/');
+            const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+            const bool isUrlSafe = alphabet == Base64Alphabet::UrlSafe;
+            size_t i = 0;
+            size_t written = 0;
+
+            // 32 bytes are stored, 24 of them are used, so at least 8 more bytes must follow in the output
+            for (; i + 64 <= size; i += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                if (isUrlSafe)
+                {
+                    __m256i isDash = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('-'));
+                    __m256i isUnderscore = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('_'));
+                    __m256i isForbidden = _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('+')), _mm256_cmpeq_epi8(block, slash));
+                    if (_mm256_testz_si256(isForbidden, isForbidden) == 0)
+                    {
+                        return false;
+                    }
+                    block = _mm256_blendv_epi8(block, _mm256_set1_epi8('+'), isDash);
+                    block = _mm256_blendv_epi8(block, slash, isUnderscore);
+                }
+
+                __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(block, 4), nibbleMask);
+                __m256i lowNibbles = _mm256_and_si256(block, nibbleMask);
+                if (_mm256_testz_si256(_mm256_shuffle_epi8(lowTable, lowNibbles), _mm256_shuffle_epi8(highTable, highNibbles)) == 0)
+                {
+                    return false;
+                }
+
+                __m256i roll = _mm256_shuffle_epi8(rollTable, _mm256_add_epi8(_mm256_cmpeq_epi8(block, slash), highNibbles));
+                __m256i values = _mm256_add_epi8(block, roll);
+
+                __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+                __m256i words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+                __m256i bytes = _mm256_shuffle_epi8(words, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                                            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+                bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + written), bytes);
+                written += 24;
+            }
+
+            return DecodeSsse3(in + i, size - i, out + written, alphabet);
+        }
+#endif
+
+        // Kernel table, selected once according to the CPU
+        struct Base64KernelStc
+        {
+            size_t (*Encode)(const unsigned char*, size_t, char*, Base64Alphabet);
+            bool (*Decode)(const char*, size_t, unsigned char*, Base64Alphabet);
+        };
+
+        static Base64KernelStc SelectKernels()
+        {
+#if defined(UTILITYLIB_X86)
+            const CpuFeatureStc& features = GetCpuFeatures();
+            if (features.Avx2)
+            {
+                return { EncodeAvx2, DecodeAvx2 };
+            }
+            if (features.Ssse3)
+            {
+                return { EncodeSsse3, DecodeSsse3 };
+            }
+#endif
+            return { EncodeScalar, DecodeScalar };
+        }
+        static const Base64KernelStc& GetKernels()
+        {
+            static const Base64KernelStc kernels = SelectKernels();
+            return kernels;
+        }
+
+        // Number of trailing '=' characters, at most two of them are padding
+        static size_t GetPaddingSize(std::string_view in)
+        {
+            size_t padding = 0;
+            while (padding < 2 && padding < in.size() && in[in.size() - 1 - padding] == '=')
+            {
+                padding++;
+            }
+            return padding;
+        }
+
+        size_t GetEncodedBase64Size(size_t size, Base64Alphabet alphabet)
+        {
+            if (IsPadded(alphabet))
+            {
+                return (size + 2) / 3 * 4;
+            }
+            return size / 3 * 4 + (size % 3 == 0 ? 0 : size % 3 + 1);
+        }
+        size_t GetDecodedBase64Size(std::string_view in)
+        {
+            size_t size = in.size() - GetPaddingSize(in);
+            size_t rest = size % 4;
+            return size / 4 * 3 + (rest > 1 ? rest - 1 : 0);
+        }
+
+        size_t EncodeBase64(std::string_view in, char* out, Base64Alphabet alphabet)
+        {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in.data());
+            const char* chars = GetChars(alphabet);
+
+            size_t fullSize = in.size() / 3 * 3;
+            size_t written = GetKernels().Encode(bytes, fullSize, out, alphabet);
+            size_t rest = in.size() - fullSize;
+
+            if (rest != 0)
+            {
+                uint32_t value = static_cast<uint32_t>(bytes[fullSize]) << 16;
+                if (rest == 2)
+                {
+                    value |= static_cast<uint32_t>(bytes[fullSize + 1]) << 8;
+                }
+
+                out[written++] = chars[value >> 18];
+                out[written++] = chars[(value >> 12) & 0x3F];
+                if (rest == 2)
+                {
+                    out[written++] = chars[(value >> 6) & 0x3F];
+                }
+                if (IsPadded(alphabet))
+                {
+                    for (size_t i = rest; i < 3; i++)
+                    {
+                        out[written++] = '=';
+                    }
+                }
+            }
+
+            return written;
+        }
+        std::string EncodeBase64(std::string_view in, Base64Alphabet alphabet)
+        {
+            std::string out(GetEncodedBase64Size(in.size(), alphabet), '\0');
+            EncodeBase64(in, out.data(), alphabet);
+            return out;
+        }
+
+        StringError DecodeBase64(std::string_view in, char* out, size_t& outSize, Base64Alphabet alphabet)
+        {
+            outSize = 0;
+
+            size_t padding = GetPaddingSize(in);
+            if (padding != 0 && in.size() % 4 != 0)
+            {
+                return StringError::InvalidArgument;
+            }
+
+            size_t size = in.size() - padding;
+            size_t fullSize = size / 4 * 4;
+            size_t rest = size - fullSize;
+            if (rest == 1)
+            {
+                return StringError::InvalidArgument;
+            }
+
+            unsigned char* bytes = reinterpret_cast<unsigned char*>(out);
+            if (GetKernels().Decode(in.data(), fullSize, bytes, alphabet) == false)
+            {
+                return StringError::InvalidArgument;
+            }
+            size_t written = fullSize / 4 * 3;
+
+            if (rest != 0)
+            {
+                const uint8_t* table = GetDecodeTable(alphabet);
+                uint32_t a = table[static_cast<unsigned char>(in[fullSize])];
+                uint32_t b = table[static_cast<unsigned char>(in[fullSize + 1])];
+                uint32_t c = rest == 3 ? table[static_cast<unsigned char>(in[fullSize + 2])] : 0;
+                if (((a | b | c) & 0x80) != 0)
+                {
+                    return StringError::InvalidArgument;
+                }
+
+                uint32_t value = (a << 18) | (b << 12) | (c << 6);
+                bytes[written++] = static_cast<unsigned char>(value >> 16);
+                if (rest == 3)
+                {
+                    bytes[written++] = static_cast<unsigned char>(value >> 8);
+                }
+            }
+
+            outSize = written;
+            return StringError::Success;
+        }
+        StringError DecodeBase64(std::string_view in, std::string& out, Base64Alphabet alphabet)
+        {
+            out.resize(GetDecodedBase64Size(in));
+
+            size_t outSize = 0;
+            StringError result = DecodeBase64(in, out.data(), outSize, alphabet);
+            if (result != StringError::Success)
+            {
+                out.clear();
+            }
+            return result;
+        }
+
+        Base64EncoderCls::Base64EncoderCls(Base64Alphabet alphabet) :
+            Alphabet(alphabet),
+            Pending{},
+            PendingSize(0)
+        {
+        }
+
+        void Base64EncoderCls::Update(std::string_view chunk, std::string& out)
+        {
+            // Complete the group left over from the previous call
+            if (PendingSize != 0)
+            {
+                while (PendingSize < 3 && chunk.empty() == false)
+                {
+                    Pending[PendingSize++] = chunk.front();
+                    chunk.remove_prefix(1);
+                }
+                if (PendingSize < 3)
+                {
+                    return;
+                }
+
+                size_t oldSize = out.size();
+                out.resize(oldSize + 4);
+                EncodeBase64(std::string_view(Pending, 3), out.data() + oldSize, Alphabet);
+                PendingSize = 0;
+            }
+
+            size_t fullSize = chunk.size() / 3 * 3;
+            if (fullSize != 0)
+            {
+                size_t oldSize = out.size();
+                out.resize(oldSize + fullSize / 3 * 4);
+                EncodeBase64(chunk.substr(0, fullSize), out.data() + oldSize, Alphabet);
+            }
+
+            for (size_t i = fullSize; i < chunk.size(); i++)
+            {
+                Pending[PendingSize++] = chunk[i];
+            }
+        }
+        void Base64EncoderCls::Finish(std::string& out)
+        {
+            std::string_view rest(Pending, PendingSize);
+            size_t oldSize = out.size();
+            out.resize(oldSize + GetEncodedBase64Size(rest.size(), Alphabet));
+            EncodeBase64(rest, out.data() + oldSize, Alphabet);
+            PendingSize = 0;
+        }
+
+        Base64DecoderCls::Base64DecoderCls(Base64Alphabet alphabet) :
+            Alphabet(alphabet),
+            Pending{},
+            PendingSize(0),
+            IsPaddingSeen(false)
+        {
+        }
+
+        StringError Base64DecoderCls::Update(std::string_view chunk, std::string& out)
+        {
+            if (chunk.empty())
+            {
+                return StringError::Success;
+            }
+            // Padding can only be at the very end of the stream
+            if (IsPaddingSeen)
+            {
+                return StringError::InvalidArgument;
+            }
+
+            // Complete the group left over from the previous call
+            if (PendingSize != 0)
+            {
+                while (PendingSize < 4 && chunk.empty() == false)
+                {
+                    Pending[PendingSize++] = chunk.front();
+                    chunk.remove_prefix(1);
+                }
+                if (PendingSize < 4)
+                {
+                    return StringError::Success;
+                }
+
+                if (chunk.empty() == false && Pending[3] == '=')
+                {
+                    return StringError::InvalidArgument;
+                }
+
+                size_t oldSize = out.size();
+                std::string_view group(Pending, 4);
+                out.resize(oldSize + GetDecodedBase64Size(group));
+                size_t written = 0;
+                if (DecodeBase64(group, out.data() + oldSize, written, Alphabet) != StringError::Success)
+                {
+                    out.resize(oldSize);
+                    return StringError::InvalidArgument;
+                }
+                IsPaddingSeen = Pending[3] == '=';
+                PendingSize = 0;
+            }
+
+            size_t fullSize = chunk.size() / 4 * 4;
+            if (fullSize != 0)
+            {
+                if (IsPaddingSeen)
+                {
+                    return StringError::InvalidArgument;
+                }
+
+                std::string_view groups = chunk.substr(0, fullSize);
+                size_t oldSize = out.size();
+                out.resize(oldSize + GetDecodedBase64Size(groups));
+                size_t written = 0;
+                if (DecodeBase64(groups, out.data() + oldSize, written, Alphabet) != StringError::Success)
+                {
+                    out.resize(oldSize);
+                    return StringError::InvalidArgument;
+                }
+                IsPaddingSeen = groups.back() == '=';
+            }
+
+            if (fullSize != chunk.size() && IsPaddingSeen)
+            {
+                return StringError::InvalidArgument;
+            }
+            for (size_t i = fullSize; i < chunk.size(); i++)
+            {
+                Pending[PendingSize++] = chunk[i];
+            }
+
+            return StringError::Success;
+        }
+        StringError Base64DecoderCls::Finish(std::string& out)
+        {
+            StringError result = StringError::Success;
+
+            if (PendingSize != 0)
+            {
+                // Unpadded stream, padding is only allowed in a complete group
+                std::string_view rest(Pending, PendingSize);
+                if (rest.back() == '=')
+                {
+                    result = StringError::InvalidArgument;
+                }
+                else
+                {
+                    size_t oldSize = out.size();
+                    out.resize(oldSize + GetDecodedBase64Size(rest));
+                    size_t written = 0;
+                    result = DecodeBase64(rest, out.data() + oldSize, written, Alphabet);
+                    if (result != StringError::Success)
+                    {
+                        out.resize(oldSize);
+                    }
+                }
+            }
+
+            Reset();
+            return result;
+        }
+        void Base64DecoderCls::Reset()
+        {
+            PendingSize = 0;
+            IsPaddingSeen = false;
+        }
+    }
+}
@@ -0,0 +1,296 @@
+#include "CasePkg.h"
+#include "CpuFeaturePkg.h"
+
+#include <bit>
+#include <cstdint>
+
+#if defined(UTILITYLIB_X86)
+#include <immintrin.h>
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Scalar kernels
+
+        static char FoldToLower(char ch)
+        {
+            return static_cast<unsigned char>(ch - 'A') < 26 ? static_cast<char>(ch | 0x20) : ch;
+        }
+        static char FoldToUpper(char ch)
+        {
+            return static_cast<unsigned char>(ch - 'a') < 26 ? static_cast<char>(ch & ~0x20) : ch;
+        }
+        template<bool ToUpper>
+        static void ConvertScalar(const char* src, size_t size, char* dst)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                dst[i] = ToUpper ? FoldToUpper(src[i]) : FoldToLower(src[i]);
+            }
+        }
+        static bool EqualsScalar(const char* lhs, const char* rhs, size_t size)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                if (FoldToLower(lhs[i]) != FoldToLower(rhs[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        // Haystack is at least as long as needle, needle is not empty
+        static size_t FindScalar(const char* haystack, size_t haystackSize, const char* needle, size_t needleSize)
+        {
+            const char first = FoldToLower(needle[0]);
+
+            for (size_t i = 0; i + needleSize <= haystackSize; i++)
+            {
+                if (FoldToLower(haystack[i]) == first && EqualsScalar(haystack + i + 1, needle + 1, needleSize - 1))
+                {
+                    return i;
+                }
+            }
+            return std::string_view::npos;
+        }
+
+#if defined(UTILITYLIB_X86)
+        // SSE2 kernels
+        // A byte is a letter to flip when (byte - low) <= 25 as an unsigned value, flipping is xor with 0x20
+
+        UTILITYLIB_TARGET("sse2")
+        static __m128i FoldSse2(__m128i block, __m128i low)
+        {
+            const __m128i width = _mm_set1_epi8(25);
+            const __m128i flip = _mm_set1_epi8(0x20);
+
+            __m128i shifted = _mm_sub_epi8(block, low);
+            __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(shifted, width), shifted);
+            return _mm_xor_si128(block, _mm_and_si128(isLetter, flip));
+        }
+        template<bool ToUpper>
+        UTILITYLIB_TARGET("sse2")
+        static void ConvertSse2(const char* src, size_t size, char* dst)
+        {
+            const __m128i low = _mm_set1_epi8(ToUpper ? 'a' : 'A');
+            size_t i = 0;
+
+            for (; i + 16 <= size; i += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), FoldSse2(block, low));
+            }
+
+            ConvertScalar<ToUpper>(src + i, size - i, dst + i);
+        }
+        UTILITYLIB_TARGET("sse2")
+        static bool EqualsSse2(const char* lhs, const char* rhs, size_t size)
+        {
+            const __m128i low = _mm_set1_epi8('A');
+            size_t i = 0;
+
+            for (; i + 16 <= size; i += 16)
+            {
+                __m128i lhsBlock = FoldSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)), low);
+                __m128i rhsBlock = FoldSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i)), low);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(lhsBlock, rhsBlock)) != 0xFFFF)
+                {
+                    return false;
+                }
+            }
+
+            return EqualsScalar(lhs + i, rhs + i, size - i);
+        }
+        // Candidates are positions where both the first and the last byte of the needle match
+        UTILITYLIB_TARGET("sse2")
+        static size_t FindSse2(const char* haystack, size_t haystackSize, const char* needle, size_t needleSize)
+        {
+            const __m128i low = _mm_set1_epi8('A');
+            const __m128i firstByte = _mm_set1_epi8(FoldToLower(needle[0]));
+            const __m128i lastByte = _mm_set1_epi8(FoldToLower(needle[needleSize - 1]));
+            size_t i = 0;
+
+            for (; i + needleSize - 1 + 16 <= haystackSize; i += 16)
+            {
+                __m128i firstBlock = FoldSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i)), low);
+                __m128i lastBlock = FoldSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i + needleSize - 1)), low);
+                __m128i candidates = _mm_and_si128(_mm_cmpeq_epi8(firstBlock, firstByte), _mm_cmpeq_epi8(lastBlock, lastByte));
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(candidates));
+
+                while (mask != 0)
+                {
+                    size_t candidate = i + std::countr_zero(mask);
+                    if (EqualsSse2(haystack + candidate, needle, needleSize))
+                    {
+                        return candidate;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+
+            size_t found = FindScalar(haystack + i, haystackSize - i, needle, needleSize);
+            return found != std::string_view::npos ? found + i : found;
+        }
+
+        // AVX2 kernels
+
+        UTILITYLIB_TARGET("avx2")
+        static __m256i FoldAvx2(__m256i block, __m256i low)
+        {
+            const __m256i width = _mm256_set1_epi8(25);
+            const __m256i flip = _mm256_set1_epi8(0x20);
+
+            __m256i shifted = _mm256_sub_epi8(block, low);
+            __m256i isLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, width), shifted);
+            return _mm256_xor_si256(block, _mm256_and_si256(isLetter, flip));
+        }
+        template<bool ToUpper>
+        UTILITYLIB_TARGET("avx2")
+        static void ConvertAvx2(const char* src, size_t size, char* dst)
+        {
+            const __m256i low = _mm256_set1_epi8(ToUpper ? 'a' : 'A');
+            size_t i = 0;
+
+            for (; i + 32 <= size; i += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), FoldAvx2(block, low));
+            }
+
+            ConvertSse2<ToUpper>(src + i, size - i, dst + i);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static bool EqualsAvx2(const char* lhs, const char* rhs, size_t size)
+        {
+            const __m256i low = _mm256_set1_epi8('A');
+            size_t i = 0;
+
+            for (; i + 32 <= size; i += 32)
+            {
+                __m256i lhsBlock = FoldAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i)), low);
+                __m256i rhsBlock = FoldAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i)), low);
+                if (static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhsBlock, rhsBlock))) != 0xFFFFFFFFu)
+                {
+                    return false;
+                }
+            }
+
+            return EqualsSse2(lhs + i, rhs + i, size - i);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static size_t FindAvx2(const char* haystack, size_t haystackSize, const char* needle, size_t needleSize)
+        {
+            const __m256i low = _mm256_set1_epi8('A');
+            const __m256i firstByte = _mm256_set1_epi8(FoldToLower(needle[0]));
+            const __m256i lastByte = _mm256_set1_epi8(FoldToLower(needle[needleSize - 1]));
+            size_t i = 0;
+
+            for (; i + needleSize - 1 + 32 <= haystackSize; i += 32)
+            {
+                __m256i firstBlock = FoldAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i)), low);
+                __m256i lastBlock = FoldAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i + needleSize - 1)), low);
+                __m256i candidates = _mm256_and_si256(_mm256_cmpeq_epi8(firstBlock, firstByte), _mm256_cmpeq_epi8(lastBlock, lastByte));
+                uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(candidates));
+
+                while (mask != 0)
+                {
+                    size_t candidate = i + std::countr_zero(mask);
+                    if (EqualsAvx2(haystack + candidate, needle, needleSize))
+                    {
+                        return candidate;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+
+            size_t found = FindSse2(haystack + i, haystackSize - i, needle, needleSize);
+            return found != std::string_view::npos ? found + i : found;
+        }
+#endif
+
+        // Kernel table, selected once according to the CPU
+        struct CaseKernelStc
+        {
+            void (*ToLower)(const char*, size_t, char*);
+            void (*ToUpper)(const char*, size_t, char*);
+            bool (*Equals)(const char*, const char*, size_t);
+            size_t (*Find)(const char*, size_t, const char*, size_t);
+        };
+
+        static CaseKernelStc SelectKernels()
+        {
+            switch (GetSimdLevel())
+            {
+#if defined(UTILITYLIB_X86)
+                case SimdLevel::Avx512Bw:
+                case SimdLevel::Avx2:
+                {
+                    return { ConvertAvx2<false>, ConvertAvx2<true>, EqualsAvx2, FindAvx2 };
+                }
+                case SimdLevel::Sse2:
+                {
+                    return { ConvertSse2<false>, ConvertSse2<true>, EqualsSse2, FindSse2 };
+                }
+#endif
+                default:
+                {
+                    return { ConvertScalar<false>, ConvertScalar<true>, EqualsScalar, FindScalar };
+                }
+            }
+        }
+        static const CaseKernelStc& GetKernels()
+        {
+            static const CaseKernelStc kernels = SelectKernels();
+            return kernels;
+        }
+
+        void ToLowerAscii(char* first, char* last)
+        {
+            GetKernels().ToLower(first, static_cast<size_t>(last - first), first);
+        }
+        void ToLowerAscii(std::string_view src, char* dst)
+        {
+            GetKernels().ToLower(src.data(), src.size(), dst);
+        }
+        void ToUpperAscii(char* first, char* last)
+        {
+            GetKernels().ToUpper(first, static_cast<size_t>(last - first), first);
+        }
+        void ToUpperAscii(std::string_view src, char* dst)
+        {
+            GetKernels().ToUpper(src.data(), src.size(), dst);
+        }
+        bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs)
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+            return GetKernels().Equals(lhs.data(), rhs.data(), lhs.size());
+        }
+        bool IsStartWithIgnoreCase(std::string_view str, std::string_view prefix)
+        {
+            if (prefix.size() > str.size())
+            {
+                return false;
+            }
+            return GetKernels().Equals(str.data(), prefix.data(), prefix.size());
+        }
+        size_t FindIgnoreCase(std::string_view haystack, std::string_view needle, size_t pos)
+        {
+            if (pos > haystack.size() || haystack.size() - pos < needle.size())
+            {
+                return std::string_view::npos;
+            }
+            if (needle.empty())
+            {
+                return pos;
+            }
+
+            size_t found = GetKernels().Find(haystack.data() + pos, haystack.size() - pos, needle.data(), needle.size());
+            return found != std::string_view::npos ? found + pos : found;
+        }
+    }
+}
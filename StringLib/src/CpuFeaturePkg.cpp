@@ -0,0 +1,123 @@
+#include "CpuFeaturePkg.h"
+
+#if defined(UTILITYLIB_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+#if defined(UTILITYLIB_X86)
+        static void Cpuid(uint32_t leaf, uint32_t subleaf, uint32_t registers[4])
+        {
+#if defined(_MSC_VER)
+            int result[4]{};
+            __cpuidex(result, static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (size_t i = 0; i < 4; i++)
+            {
+                registers[i] = static_cast<uint32_t>(result[i]);
+            }
+#else
+            registers[0] = registers[1] = registers[2] = registers[3] = 0;
+            __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+        }
+
+        // Reads XCR0 to check which register states are saved by the operating system
+        static uint64_t ReadXcr0()
+        {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#else
+            uint32_t eax = 0;
+            uint32_t edx = 0;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+        }
+
+        static bool IsBitSet(uint32_t value, uint32_t bit)
+        {
+            return ((value >> bit) & 1) != 0;
+        }
+#endif
+
+        static CpuFeatureStc DetectCpuFeatures()
+        {
+            CpuFeatureStc features{};
+
+#if defined(UTILITYLIB_X86)
+            uint32_t registers[4]{};
+
+            Cpuid(0, 0, registers);
+            uint32_t maxLeaf = registers[0];
+
+            if (maxLeaf < 1)
+            {
+                return features;
+            }
+
+            Cpuid(1, 0, registers);
+            uint32_t ecx = registers[2];
+            uint32_t edx = registers[3];
+
+            features.Sse2 = IsBitSet(edx, 26);
+            features.Ssse3 = IsBitSet(ecx, 9);
+            features.Sse41 = IsBitSet(ecx, 19);
+            features.Sse42 = IsBitSet(ecx, 20);
+            features.Pclmul = IsBitSet(ecx, 1);
+            features.Popcnt = IsBitSet(ecx, 23);
+
+            // AVX registers are only usable if OS saves them on context switch
+            bool isOsXsaveEnabled = IsBitSet(ecx, 27) && IsBitSet(ecx, 28);
+            uint64_t xcr0 = isOsXsaveEnabled ? ReadXcr0() : 0;
+            bool isAvxStateEnabled = (xcr0 & 0x06) == 0x06;
+            bool isAvx512StateEnabled = isAvxStateEnabled && (xcr0 & 0xE0) == 0xE0;
+
+            if (maxLeaf >= 7)
+            {
+                Cpuid(7, 0, registers);
+                uint32_t ebx = registers[1];
+
+                features.Avx2 = isAvxStateEnabled && IsBitSet(ebx, 5);
+                features.Bmi2 = IsBitSet(ebx, 8);
+                features.Avx512F = isAvx512StateEnabled && IsBitSet(ebx, 16);
+                features.Avx512Bw = features.Avx512F && IsBitSet(ebx, 30);
+                features.Avx512Vl = features.Avx512F && IsBitSet(ebx, 31);
+            }
+#endif
+
+            return features;
+        }
+
+        const CpuFeatureStc& GetCpuFeatures()
+        {
+            static const CpuFeatureStc features = DetectCpuFeatures();
+            return features;
+        }
+
+        SimdLevel GetSimdLevel()
+        {
+            const CpuFeatureStc& features = GetCpuFeatures();
+
+            if (features.Avx512Bw)
+            {
+                return SimdLevel::Avx512Bw;
+            }
+            if (features.Avx2)
+            {
+                return SimdLevel::Avx2;
+            }
+            if (features.Sse2)
+            {
+                return SimdLevel::Sse2;
+            }
+            return SimdLevel::Scalar;
+        }
+    }
+}
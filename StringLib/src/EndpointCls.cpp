@@ -0,0 +1,153 @@
+#include "EndpointCls.h"
+#include "NumberPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        StringError ParsePort(std::string_view str, uint16_t& port)
+        {
+            if (str.empty() || str.size() > MAX_PORT_CHARS)
+            {
+                return str.empty() ? StringError::InvalidArgument : StringError::OutOfRange;
+            }
+
+            uint32_t value = 0;
+            for (char ch : str)
+            {
+                uint32_t digit = static_cast<uint32_t>(static_cast<uint8_t>(ch)) - '0';
+                if (digit > 9)
+                {
+                    return StringError::InvalidArgument;
+                }
+                value = value * 10 + digit;
+            }
+
+            if (value > UINT16_MAX)
+            {
+                return StringError::OutOfRange;
+            }
+
+            port = static_cast<uint16_t>(value);
+            return StringError::Success;
+        }
+
+        EndpointCls::EndpointCls() :
+            Port(0)
+        {
+        }
+        EndpointCls::EndpointCls(const IpAddressCls& address, uint16_t port) :
+            Address(address),
+            Port(port)
+        {
+        }
+
+        StringError EndpointCls::Parse(std::string_view str, EndpointCls& out)
+        {
+            std::string_view address;
+            std::string_view port;
+            bool isV6 = str.empty() == false && str.front() == '[';
+
+            if (isV6)
+            {
+                size_t close = str.find(']');
+                if (close == std::string_view::npos || close + 1 == str.size() || str[close + 1] != ':')
+                {
+                    return StringError::InvalidArgument;
+                }
+                address = str.substr(1, close - 1);
+                port = str.substr(close + 2);
+            }
+            else
+            {
+                // IPv6 addresses must be in brackets, so the only ':' separates the port
+                size_t colon = str.find(':');
+                if (colon == std::string_view::npos || str.find(':', colon + 1) != std::string_view::npos)
+                {
+                    return StringError::InvalidArgument;
+                }
+                address = str.substr(0, colon);
+                port = str.substr(colon + 1);
+            }
+
+            IpAddressCls ip;
+            uint16_t portNum = 0;
+            StringError result = isV6 ? IpAddressCls::ParseV6(address, ip) : IpAddressCls::ParseV4(address, ip);
+            if (result == StringError::Success)
+            {
+                result = ParsePort(port, portNum);
+            }
+            if (result == StringError::Success)
+            {
+                out = EndpointCls(ip, portNum);
+            }
+            return result;
+        }
+        StringError EndpointCls::Parse(std::string_view ipAddress, std::string_view port, EndpointCls& out)
+        {
+            IpAddressCls ip;
+            uint16_t portNum = 0;
+
+            StringError result = StringError::Success;
+            if (ipAddress.empty() == false)
+            {
+                result = IpAddressCls::Parse(ipAddress, ip);
+            }
+            if (result == StringError::Success)
+            {
+                result = ParsePort(port, portNum);
+            }
+            if (result == StringError::Success)
+            {
+                out = EndpointCls(ip, portNum);
+            }
+            return result;
+        }
+
+        const IpAddressCls& EndpointCls::GetAddress() const
+        {
+            return Address;
+        }
+        uint16_t EndpointCls::GetPort() const
+        {
+            return Port;
+        }
+        void EndpointCls::SetAddress(const IpAddressCls& address)
+        {
+            Address = address;
+        }
+        void EndpointCls::SetPort(uint16_t port)
+        {
+            Port = port;
+        }
+
+        size_t EndpointCls::Format(char* buffer) const
+        {
+            size_t size = 0;
+            if (Address.IsV4())
+            {
+                size = Address.Format(buffer);
+            }
+            else
+            {
+                buffer[size++] = '[';
+                size += Address.Format(buffer + size);
+                buffer[size++] = ']';
+            }
+            buffer[size++] = ':';
+            return size + FormatIntegral<uint16_t>(Port, buffer + size);
+        }
+        InlineStringCls<MAX_ENDPOINT_CHARS> EndpointCls::ToString() const
+        {
+            InlineStringCls<MAX_ENDPOINT_CHARS> result;
+            result.resize(MAX_ENDPOINT_CHARS);
+            result.resize(Format(result.data()));
+            return result;
+        }
+
+        bool EndpointCls::operator==(const EndpointCls& other) const
+        {
+            return Port == other.Port && Address == other.Address;
+        }
+    }
+}
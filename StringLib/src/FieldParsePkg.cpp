@@ -0,0 +1,384 @@
+#include "FieldParsePkg.h"
+#include "CpuFeaturePkg.h"
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(UTILITYLIB_X86)
+#include <immintrin.h>
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Separator masks: bit i is set if block[i] is the delimiter or '\n', blocks are 64 bytes
+
+        static uint64_t SeparatorMaskScalar(const char* block, char delimiter)
+        {
+            uint64_t mask = 0;
+            for (size_t i = 0; i < 64; i++)
+            {
+                if (block[i] == delimiter || block[i] == '\n')
+                {
+                    mask |= uint64_t(1) << i;
+                }
+            }
+            return mask;
+        }
+
+#if defined(UTILITYLIB_X86)
+        UTILITYLIB_TARGET("sse2")
+        static uint64_t SeparatorMaskSse2(const char* block, char delimiter)
+        {
+            const __m128i delimiterByte = _mm_set1_epi8(delimiter);
+            const __m128i newLine = _mm_set1_epi8('\n');
+            uint64_t mask = 0;
+
+            for (size_t i = 0; i < 64; i += 16)
+            {
+                __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+                __m128i isSeparator = _mm_or_si128(_mm_cmpeq_epi8(chars, delimiterByte), _mm_cmpeq_epi8(chars, newLine));
+                mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(isSeparator))) << i;
+            }
+            return mask;
+        }
+        UTILITYLIB_TARGET("avx2")
+        static uint64_t SeparatorMaskAvx2(const char* block, char delimiter)
+        {
+            const __m256i delimiterByte = _mm256_set1_epi8(delimiter);
+            const __m256i newLine = _mm256_set1_epi8('\n');
+
+            __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+            __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+            __m256i isLowSeparator = _mm256_or_si256(_mm256_cmpeq_epi8(low, delimiterByte), _mm256_cmpeq_epi8(low, newLine));
+            __m256i isHighSeparator = _mm256_or_si256(_mm256_cmpeq_epi8(high, delimiterByte), _mm256_cmpeq_epi8(high, newLine));
+
+            uint64_t lowMask = static_cast<uint32_t>(_mm256_movemask_epi8(isLowSeparator));
+            uint64_t highMask = static_cast<uint32_t>(_mm256_movemask_epi8(isHighSeparator));
+            return lowMask | (highMask << 32);
+        }
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static uint64_t SeparatorMaskAvx512Bw(const char* block, char delimiter)
+        {
+            __m512i chars = _mm512_loadu_si512(block);
+            return _mm512_cmpeq_epi8_mask(chars, _mm512_set1_epi8(delimiter)) | _mm512_cmpeq_epi8_mask(chars, _mm512_set1_epi8('\n'));
+        }
+#endif
+
+        using SeparatorMaskFunction = uint64_t (*)(const char*, char);
+
+        static SeparatorMaskFunction SelectSeparatorMask()
+        {
+            switch (GetSimdLevel())
+            {
+#if defined(UTILITYLIB_X86)
+                case SimdLevel::Avx512Bw:
+                {
+                    return SeparatorMaskAvx512Bw;
+                }
+                case SimdLevel::Avx2:
+                {
+                    return SeparatorMaskAvx2;
+                }
+                case SimdLevel::Sse2:
+                {
+                    return SeparatorMaskSse2;
+                }
+#endif
+                default:
+                {
+                    return SeparatorMaskScalar;
+                }
+            }
+        }
+        static SeparatorMaskFunction GetSeparatorMask()
+        {
+            static const SeparatorMaskFunction separatorMask = SelectSeparatorMask();
+            return separatorMask;
+        }
+
+        // Calls parseField(first, last) for every field, stops at the first one that fails
+        template<typename ParseFieldT>
+        static FieldParseResultStc ForEachField(std::string_view str, char delimiter, ParseFieldT&& parseField)
+        {
+            const char* data = str.data();
+            const size_t size = str.size();
+            size_t fieldStart = 0;
+            size_t fieldIndex = 0;
+            FieldParseResultStc result{ StringError::Success, 0, size };
+
+            auto endField = [&](size_t separator) -> bool
+            {
+                size_t fieldEnd = separator;
+                if (data[separator] == '\n' && fieldEnd > fieldStart && data[fieldEnd - 1] == '\r')
+                {
+                    fieldEnd--;
+                }
+
+                StringError error = parseField(data + fieldStart, data + fieldEnd);
+                if (error != StringError::Success)
+                {
+                    result = { error, fieldIndex, fieldStart };
+                    return false;
+                }
+
+                fieldIndex++;
+                fieldStart = separator + 1;
+                return true;
+            };
+
+            const SeparatorMaskFunction separatorMask = GetSeparatorMask();
+            size_t blockStart = 0;
+
+            for (; blockStart + 64 <= size; blockStart += 64)
+            {
+                uint64_t mask = separatorMask(data + blockStart, delimiter);
+                while (mask != 0)
+                {
+                    if (endField(blockStart + std::countr_zero(mask)) == false)
+                    {
+                        return result;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+            for (size_t i = blockStart; i < size; i++)
+            {
+                if ((data[i] == delimiter || data[i] == '\n') && endField(i) == false)
+                {
+                    return result;
+                }
+            }
+
+            if (fieldStart < size)
+            {
+                StringError error = parseField(data + fieldStart, data + size);
+                if (error != StringError::Success)
+                {
+                    return { error, fieldIndex, fieldStart };
+                }
+                fieldIndex++;
+            }
+            else if (size != 0 && data[size - 1] != '\n')
+            {
+                // Input ends with a delimiter, the last field is empty
+                return { StringError::InvalidArgument, fieldIndex, size };
+            }
+
+            return { StringError::Success, fieldIndex, size };
+        }
+
+        // True if all 8 bytes are '0'-'9'
+        static bool IsEightDigits(uint64_t chunk)
+        {
+            return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+        }
+        // Converts 8 digits (first digit in the lowest byte) with three multiplications
+        static uint32_t ParseEightDigits(uint64_t chunk)
+        {
+            chunk = ((chunk & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+            chunk = ((chunk & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+            return static_cast<uint32_t>(((chunk & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+        }
+
+        template<typename T>
+        static StringError ParseIntegralField(const char* first, const char* last, T& value)
+        {
+            const char* pos = first;
+            bool isNegative = false;
+            if constexpr (std::is_signed_v<T>)
+            {
+                if (pos != last && *pos == '-')
+                {
+                    isNegative = true;
+                    pos++;
+                }
+            }
+            if (pos == last)
+            {
+                return StringError::InvalidArgument;
+            }
+
+            // 19 digits always fit into uint64_t, longer fields are rare enough for std::from_chars
+            if (last - pos > 19)
+            {
+                std::from_chars_result conversionResult = std::from_chars(first, last, value);
+                if (conversionResult.ec == std::errc::result_out_of_range)
+                {
+                    return StringError::OutOfRange;
+                }
+                if (conversionResult.ec != std::errc() || conversionResult.ptr != last)
+                {
+                    return StringError::InvalidArgument;
+                }
+                return StringError::Success;
+            }
+
+            uint64_t magnitude = 0;
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                for (; last - pos >= 8; pos += 8)
+                {
+                    uint64_t chunk;
+                    std::memcpy(&chunk, pos, sizeof(chunk));
+                    if (IsEightDigits(chunk) == false)
+                    {
+                        return StringError::InvalidArgument;
+                    }
+                    magnitude = magnitude * 100000000 + ParseEightDigits(chunk);
+                }
+            }
+            for (; pos != last; pos++)
+            {
+                uint32_t digit = static_cast<unsigned char>(*pos) - static_cast<uint32_t>('0');
+                if (digit > 9)
+                {
+                    return StringError::InvalidArgument;
+                }
+                magnitude = magnitude * 10 + digit;
+            }
+
+            using UnsignedT = std::make_unsigned_t<T>;
+            if (isNegative)
+            {
+                // Magnitude of the minimum value is one more than the maximum
+                if (magnitude > static_cast<uint64_t>(std::numeric_limits<T>::max()) + 1)
+                {
+                    return StringError::OutOfRange;
+                }
+                value = static_cast<T>(static_cast<UnsignedT>(0u - static_cast<UnsignedT>(magnitude)));
+            }
+            else
+            {
+                if (magnitude > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+                {
+                    return StringError::OutOfRange;
+                }
+                value = static_cast<T>(magnitude);
+            }
+            return StringError::Success;
+        }
+
+        template<typename T>
+        static StringError ParseFloatingField(const char* first, const char* last, T& value)
+        {
+            if (first == last)
+            {
+                return StringError::InvalidArgument;
+            }
+
+            std::from_chars_result conversionResult = std::from_chars(first, last, value);
+            if (conversionResult.ec == std::errc::result_out_of_range)
+            {
+                return StringError::OutOfRange;
+            }
+            if (conversionResult.ec != std::errc() || conversionResult.ptr != last)
+            {
+                return StringError::InvalidArgument;
+            }
+            return StringError::Success;
+        }
+
+        template<FieldParseIntegral T>
+        FieldParseResultStc ParseIntegralFields(std::string_view str, char delimiter, std::vector<T>& values)
+        {
+            return ForEachField(str, delimiter, [&values](const char* first, const char* last)
+            {
+                T value{};
+                StringError error = ParseIntegralField(first, last, value);
+                if (error == StringError::Success)
+                {
+                    values.push_back(value);
+                }
+                return error;
+            });
+        }
+        template<FieldParseIntegral T>
+        FieldParseResultStc ParseIntegralFields(std::string_view str, char delimiter, std::span<T> values)
+        {
+            size_t count = 0;
+            return ForEachField(str, delimiter, [&values, &count](const char* first, const char* last)
+            {
+                T value{};
+                StringError error = ParseIntegralField(first, last, value);
+                if (error != StringError::Success)
+                {
+                    return error;
+                }
+                if (count == values.size())
+                {
+                    return StringError::OutOfRange;
+                }
+                values[count++] = value;
+                return StringError::Success;
+            });
+        }
+        template<FieldParseFloating T>
+        FieldParseResultStc ParseFloatingFields(std::string_view str, char delimiter, std::vector<T>& values)
+        {
+            return ForEachField(str, delimiter, [&values](const char* first, const char* last)
+            {
+                T value{};
+                StringError error = ParseFloatingField(first, last, value);
+                if (error == StringError::Success)
+                {
+                    values.push_back(value);
+                }
+                return error;
+            });
+        }
+        template<FieldParseFloating T>
+        FieldParseResultStc ParseFloatingFields(std::string_view str, char delimiter, std::span<T> values)
+        {
+            size_t count = 0;
+            return ForEachField(str, delimiter, [&values, &count](const char* first, const char* last)
+            {
+                T value{};
+                StringError error = ParseFloatingField(first, last, value);
+                if (error != StringError::Success)
+                {
+                    return error;
+                }
+                if (count == values.size())
+                {
+                    return StringError::OutOfRange;
+                }
+                values[count++] = value;
+                return StringError::Success;
+            });
+        }
+
+        // Explicit instantiations for the standard integer types and float/double
+        template FieldParseResultStc ParseIntegralFields<signed char>(std::string_view, char, std::vector<signed char>&);
+        template FieldParseResultStc ParseIntegralFields<unsigned char>(std::string_view, char, std::vector<unsigned char>&);
+        template FieldParseResultStc ParseIntegralFields<short>(std::string_view, char, std::vector<short>&);
+        template FieldParseResultStc ParseIntegralFields<unsigned short>(std::string_view, char, std::vector<unsigned short>&);
+        template FieldParseResultStc ParseIntegralFields<int>(std::string_view, char, std::vector<int>&);
+        template FieldParseResultStc ParseIntegralFields<unsigned int>(std::string_view, char, std::vector<unsigned int>&);
+        template FieldParseResultStc ParseIntegralFields<long>(std::string_view, char, std::vector<long>&);
+        template FieldParseResultStc ParseIntegralFields<unsigned long>(std::string_view, char, std::vector<unsigned long>&);
+        template FieldParseResultStc ParseIntegralFields<long long>(std::string_view, char, std::vector<long long>&);
+        template FieldParseResultStc ParseIntegralFields<unsigned long long>(std::string_view, char, std::vector<unsigned long long>&);
+
+        template FieldParseResultStc ParseIntegralFields<signed char>(std::string_view, char, std::span<signed char>);
+        template FieldParseResultStc ParseIntegralFields<unsigned char>(std::string_view, char, std::span<unsigned char>);
+        template FieldParseResultStc ParseIntegralFields<short>(std::string_view, char, std::span<short>);
+        template FieldParseResultStc ParseIntegralFields<unsigned short>(std::string_view, char, std::span<unsigned short>);
+        template FieldParseResultStc ParseIntegralFields<int>(std::string_view, char, std::span<int>);
+        template FieldParseResultStc ParseIntegralFields<unsigned int>(std::string_view, char, std::span<unsigned int>);
+        template FieldParseResultStc ParseIntegralFields<long>(std::string_view, char, std::span<long>);
+        template FieldParseResultStc ParseIntegralFields<unsigned long>(std::string_view, char, std::span<unsigned long>);
+        template FieldParseResultStc ParseIntegralFields<long long>(std::string_view, char, std::span<long long>);
+        template FieldParseResultStc ParseIntegralFields<unsigned long long>(std::string_view, char, std::span<unsigned long long>);
+
+        template FieldParseResultStc ParseFloatingFields<float>(std::string_view, char, std::vector<float>&);
+        template FieldParseResultStc ParseFloatingFields<double>(std::string_view, char, std::vector<double>&);
+        template FieldParseResultStc ParseFloatingFields<float>(std::string_view, char, std::span<float>);
+        template FieldParseResultStc ParseFloatingFields<double>(std::string_view, char, std::span<double>);
+    }
+}
@@ -0,0 +1,51 @@
+#include "FormatPkg.h"
+
+#include <charconv>
+#include <system_error>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        template<typename T>
+        static size_t FormatFloatingSpecImpl(T value, char type, size_t precision, std::span<char> out)
+        {
+            char* first = out.data();
+            char* last = out.data() + out.size();
+            std::to_chars_result result;
+
+            if (type == '\0' && precision == FORMAT_NO_PRECISION)
+            {
+                result = std::to_chars(first, last, value);
+            }
+            else
+            {
+                // No type with a precision behaves like 'g', same as std::format()
+                std::chars_format format = type == 'f' ? std::chars_format::fixed : (type == 'e' ? std::chars_format::scientific : std::chars_format::general);
+                if (precision == FORMAT_NO_PRECISION)
+                {
+                    result = std::to_chars(first, last, value, format);
+                }
+                else
+                {
+                    result = std::to_chars(first, last, value, format, static_cast<int>(precision));
+                }
+            }
+
+            if (result.ec != std::errc())
+            {
+                return 0;
+            }
+            return static_cast<size_t>(result.ptr - first);
+        }
+
+        size_t FormatFloatingSpec(float value, char type, size_t precision, std::span<char> out)
+        {
+            return FormatFloatingSpecImpl(value, type, precision, out);
+        }
+        size_t FormatFloatingSpec(double value, char type, size_t precision, std::span<char> out)
+        {
+            return FormatFloatingSpecImpl(value, type, precision, out);
+        }
+    }
+}
@@ -0,0 +1,253 @@
+#include "FuzzyMatcherCls.h"
+
+#include <algorithm>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        static constexpr size_t BLOCK_BITS = 64;
+        static constexpr uint64_t HIGH_BIT = uint64_t{ 1 } << 63;
+
+        struct DistanceBlockStc
+        {
+            uint64_t Pv;     // Vertical +1 deltas of the column
+            uint64_t Mv;     // Vertical -1 deltas of the column
+            ptrdiff_t Score; // Distance at the last row of the block
+        };
+
+        // Advances one 64 row block by one text character
+        // hin is the horizontal delta entering the first row, returns the horizontal delta of the row selected by outBit
+        static inline ptrdiff_t AdvanceBlock(DistanceBlockStc& block, uint64_t eq, ptrdiff_t hin, uint64_t outBit)
+        {
+            uint64_t pv = block.Pv;
+            uint64_t mv = block.Mv;
+            uint64_t hinIsNegative = hin < 0 ? 1 : 0;
+
+            uint64_t xv = eq | mv;
+            eq |= hinIsNegative;
+            uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+            uint64_t ph = mv | ~(xh | pv);
+            uint64_t mh = pv & xh;
+
+            // ph and mh never share a bit
+            ptrdiff_t hout = static_cast<ptrdiff_t>((ph & outBit) != 0) - static_cast<ptrdiff_t>((mh & outBit) != 0);
+
+            ph = (ph << 1) | static_cast<uint64_t>(hin > 0);
+            mh = (mh << 1) | hinIsNegative;
+            block.Pv = mh | ~(xv | ph);
+            block.Mv = ph & xv;
+
+            return hout;
+        }
+
+        // Pattern of 1 - 64 characters, one word holds the whole column
+        // Returns the distance, or any value above maxDistance once the distance can no longer come down to it
+        static size_t DistanceSingleBlock(const uint64_t* matchMask, size_t patternSize,
+                                          const uint8_t* str, size_t size, size_t maxDistance)
+        {
+            const uint64_t lastBit = uint64_t{ 1 } << (patternSize - 1);
+            uint64_t pv = ~uint64_t{ 0 };
+            uint64_t mv = 0;
+            size_t score = patternSize;
+
+            for (size_t i = 0; i < size; i++)
+            {
+                uint64_t eq = matchMask[str[i]];
+                uint64_t xv = eq | mv;
+                uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+                uint64_t ph = mv | ~(xh | pv);
+                uint64_t mh = pv & xh;
+
+                score += static_cast<size_t>((ph & lastBit) != 0);
+                score -= static_cast<size_t>((mh & lastBit) != 0);
+
+                // First row of the matrix is 0, 1, 2, ... so every column enters with a +1 horizontal delta
+                ph = (ph << 1) | 1;
+                mh = mh << 1;
+                pv = mh | ~(xv | ph);
+                mv = ph & xv;
+
+                // Distance at the last row drops by at most one per remaining column
+                if (score > maxDistance + (size - i - 1))
+                {
+                    return maxDistance + 1;
+                }
+            }
+
+            return score;
+        }
+
+        // Pattern of any length, split into 64 row blocks
+        //
+        // A cell at row r of column c is at least r - c, so at column c only the rows up to c + maxDistance
+        // can be on a path that ends within maxDistance
+        // Blocks below that band are not computed yet, a block joins when the band reaches its first row,
+        // starting with +1 vertical deltas below the block above it
+        // Those starting values are never lower than the real ones and every one of them is above maxDistance,
+        // so they can not change any cell that is within maxDistance
+        static size_t DistanceMultiBlock(const uint64_t* matchMask, size_t blockCount, size_t patternSize,
+                                         const uint8_t* str, size_t size, size_t maxDistance)
+        {
+            const uint64_t lastBit = uint64_t{ 1 } << ((patternSize - 1) % BLOCK_BITS);
+            const size_t lastBlock = blockCount - 1;
+
+            std::vector<DistanceBlockStc> blockList(blockCount);
+            size_t activeBlock = std::min(lastBlock, maxDistance / BLOCK_BITS);
+            for (size_t b = 0; b <= activeBlock; b++)
+            {
+                blockList[b].Pv = ~uint64_t{ 0 };
+                blockList[b].Mv = 0;
+                blockList[b].Score = static_cast<ptrdiff_t>(std::min(patternSize, (b + 1) * BLOCK_BITS));
+            }
+
+            for (size_t i = 0; i < size; i++)
+            {
+                size_t column = i + 1;
+                size_t bandBlock = std::min(lastBlock, (column + maxDistance - 1) / BLOCK_BITS);
+                while (activeBlock < bandBlock)
+                {
+                    activeBlock++;
+                    size_t rows = std::min(BLOCK_BITS, patternSize - activeBlock * BLOCK_BITS);
+                    blockList[activeBlock].Pv = ~uint64_t{ 0 };
+                    blockList[activeBlock].Mv = 0;
+                    blockList[activeBlock].Score = blockList[activeBlock - 1].Score + static_cast<ptrdiff_t>(rows);
+                }
+
+                const uint64_t* eq = matchMask + static_cast<size_t>(str[i]) * blockCount;
+                ptrdiff_t hin = 1;
+                for (size_t b = 0; b <= activeBlock; b++)
+                {
+                    hin = AdvanceBlock(blockList[b], eq[b], hin, b == lastBlock ? lastBit : HIGH_BIT);
+                    blockList[b].Score += hin;
+                }
+
+                // Distance at the bottom of the last computed block bounds the final distance from below:
+                // it can drop by one per column on the diagonal, and change by one per row after that
+                size_t row = std::min(patternSize, (activeBlock + 1) * BLOCK_BITS);
+                size_t remaining = size - column;
+                size_t offset = patternSize - row > remaining ? patternSize - row - remaining : remaining - (patternSize - row);
+                if (static_cast<size_t>(blockList[activeBlock].Score) > maxDistance + offset)
+                {
+                    return maxDistance + 1;
+                }
+            }
+
+            return static_cast<size_t>(blockList[lastBlock].Score);
+        }
+
+        // Distance limited to maxDistance, which must not be above the longer size, so maxDistance + 1 can not overflow
+        static size_t BoundedDistance(const uint64_t* matchMask, size_t blockCount, size_t patternSize,
+                                      std::string_view str, size_t maxDistance)
+        {
+            size_t difference = patternSize > str.size() ? patternSize - str.size() : str.size() - patternSize;
+            if (difference > maxDistance)
+            {
+                return maxDistance + 1;
+            }
+            if (patternSize == 0 || str.empty())
+            {
+                return difference;
+            }
+
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(str.data());
+            if (blockCount == 1)
+            {
+                return DistanceSingleBlock(matchMask, patternSize, bytes, str.size(), maxDistance);
+            }
+            return DistanceMultiBlock(matchMask, blockCount, patternSize, bytes, str.size(), maxDistance);
+        }
+
+        FuzzyMatcherCls::FuzzyMatcherCls() :
+            PatternSize(0),
+            BlockCount(0)
+        {
+        }
+        FuzzyMatcherCls::FuzzyMatcherCls(std::string_view pattern) :
+            PatternSize(pattern.size()),
+            BlockCount((pattern.size() + BLOCK_BITS - 1) / BLOCK_BITS),
+            MatchMask(256 * ((pattern.size() + BLOCK_BITS - 1) / BLOCK_BITS), 0)
+        {
+            for (size_t i = 0; i < pattern.size(); i++)
+            {
+                size_t ch = static_cast<uint8_t>(pattern[i]);
+                MatchMask[ch * BlockCount + i / BLOCK_BITS] |= uint64_t{ 1 } << (i % BLOCK_BITS);
+            }
+        }
+
+        size_t FuzzyMatcherCls::Distance(std::string_view str) const
+        {
+            return BoundedDistance(MatchMask.data(), BlockCount, PatternSize, str, std::max(PatternSize, str.size()));
+        }
+        size_t FuzzyMatcherCls::Distance(std::string_view str, size_t maxDistance) const
+        {
+            size_t limit = std::max(PatternSize, str.size());
+            if (maxDistance >= limit)
+            {
+                return BoundedDistance(MatchMask.data(), BlockCount, PatternSize, str, limit);
+            }
+
+            size_t distance = BoundedDistance(MatchMask.data(), BlockCount, PatternSize, str, maxDistance);
+            return distance > maxDistance ? maxDistance + 1 : distance;
+        }
+        bool FuzzyMatcherCls::IsMatch(std::string_view str, size_t maxDistance) const
+        {
+            return Distance(str, maxDistance) <= maxDistance;
+        }
+        size_t FuzzyMatcherCls::GetPatternSize() const
+        {
+            return PatternSize;
+        }
+
+        size_t EditDistance(std::string_view first, std::string_view second)
+        {
+            return EditDistance(first, second, std::max(first.size(), second.size()));
+        }
+        size_t EditDistance(std::string_view first, std::string_view second, size_t maxDistance)
+        {
+            // Matching ends never take part in an optimal alignment, skipping them keeps the pattern short
+            size_t prefix = 0;
+            size_t common = std::min(first.size(), second.size());
+            while (prefix < common && first[prefix] == second[prefix])
+            {
+                prefix++;
+            }
+            first.remove_prefix(prefix);
+            second.remove_prefix(prefix);
+
+            size_t suffix = 0;
+            common -= prefix;
+            while (suffix < common && first[first.size() - suffix - 1] == second[second.size() - suffix - 1])
+            {
+                suffix++;
+            }
+            first.remove_suffix(suffix);
+            second.remove_suffix(suffix);
+
+            if (first.size() > second.size())
+            {
+                std::swap(first, second);
+            }
+
+            size_t limit = std::min(maxDistance, second.size());
+            size_t distance;
+            if (first.size() <= BLOCK_BITS)
+            {
+                // Single block pattern fits on the stack, no allocation
+                uint64_t matchMask[256] = {};
+                for (size_t i = 0; i < first.size(); i++)
+                {
+                    matchMask[static_cast<uint8_t>(first[i])] |= uint64_t{ 1 } << i;
+                }
+                distance = BoundedDistance(matchMask, 1, first.size(), second, limit);
+            }
+            else
+            {
+                FuzzyMatcherCls matcher(first);
+                distance = matcher.Distance(second, limit);
+            }
+
+            return distance > maxDistance ? maxDistance + 1 : distance;
+        }
+    }
+}
@@ -0,0 +1,420 @@
+#include "GlobPatternCls.h"
+
+#include <cstring>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        GlobPatternCls::GlobPatternCls() :
+            Mode(GlobMode::Text)
+        {
+            Compile();
+        }
+        GlobPatternCls::GlobPatternCls(std::string_view pattern, GlobMode mode) :
+            Pattern(pattern),
+            Mode(mode)
+        {
+            Compile();
+        }
+
+        struct NamedClassStc
+        {
+            std::string_view Name;
+            ByteSetCls Set;
+        };
+
+        // POSIX character classes that can be used inside brackets, such as [[:digit:]_] (ASCII only)
+        static constexpr NamedClassStc NAMED_CLASS_LIST[] =
+        {
+            { "alnum", ALNUM_CHARS },
+            { "alpha", ALPHA_CHARS },
+            { "blank", ByteSetCls(" \t") },
+            { "digit", DIGIT_CHARS },
+            { "lower", ByteSetCls().AddRange('a', 'z') },
+            { "punct", ByteSetCls().AddRange('!', '/').AddRange(':', '@').AddRange('[', '`').AddRange('{', '~') },
+            { "space", SPACE_CHARS },
+            { "upper", ByteSetCls().AddRange('A', 'Z') },
+            { "xdigit", ByteSetCls().AddRange('0', '9').AddRange('a', 'f').AddRange('A', 'F') }
+        };
+
+        // Adds the bytes that are (or are not) in source to set, a range at a time
+        static void AddRuns(ByteSetCls& set, const ByteSetCls& source, bool isMember)
+        {
+            size_t value = 0;
+            while (value < 256)
+            {
+                if (source.Contains(static_cast<char>(value)) != isMember)
+                {
+                    value++;
+                    continue;
+                }
+
+                size_t low = value;
+                while (value < 256 && source.Contains(static_cast<char>(value)) == isMember)
+                {
+                    value++;
+                }
+                set.AddRange(static_cast<char>(low), static_cast<char>(value - 1));
+            }
+        }
+
+        // Adds a "[:name:]" class that starts at pattern[pos] to the set, returns index after it or pos if there is none
+        static size_t ParseNamedClass(std::string_view pattern, size_t pos, ByteSetCls& set)
+        {
+            if (pattern.substr(pos, 2) != "[:")
+            {
+                return pos;
+            }
+
+            size_t end = pattern.find(":]", pos + 2);
+            if (end == std::string_view::npos)
+            {
+                return pos;
+            }
+
+            std::string_view name = pattern.substr(pos + 2, end - pos - 2);
+            for (const NamedClassStc& namedClass : NAMED_CLASS_LIST)
+            {
+                if (namedClass.Name == name)
+                {
+                    AddRuns(set, namedClass.Set, true);
+                    return end + 2;
+                }
+            }
+            return pos;
+        }
+
+        // Parses a bracket expression that starts at pattern[pos] == '['
+        // Returns index after the closing ']', or pos if the class is not terminated (then '[' is a literal byte)
+        static size_t ParseClass(std::string_view pattern, size_t pos, ByteSetCls& set)
+        {
+            size_t i = pos + 1;
+            bool isNegated = i < pattern.size() && (pattern[i] == '!' || pattern[i] == '^');
+            if (isNegated)
+            {
+                i++;
+            }
+
+            ByteSetCls members;
+            bool isFirst = true;
+            while (i < pattern.size() && (pattern[i] != ']' || isFirst))
+            {
+                isFirst = false;
+
+                size_t next = ParseNamedClass(pattern, i, members);
+                if (next != i)
+                {
+                    i = next;
+                    continue;
+                }
+
+                char low = pattern[i];
+                if (low == '\\' && i + 1 < pattern.size())
+                {
+                    low = pattern[++i];
+                }
+                i++;
+
+                char high = low;
+                if (i + 1 < pattern.size() && pattern[i] == '-' && pattern[i + 1] != ']')
+                {
+                    i++;
+                    high = pattern[i];
+                    if (high == '\\' && i + 1 < pattern.size())
+                    {
+                        high = pattern[++i];
+                    }
+                    i++;
+                }
+
+                // Reversed ranges such as [z-a] are empty, same as in shells
+                if (static_cast<unsigned char>(low) <= static_cast<unsigned char>(high))
+                {
+                    members.AddRange(low, high);
+                }
+            }
+
+            if (i == pattern.size())
+            {
+                return pos;
+            }
+
+            if (isNegated)
+            {
+                ByteSetCls inverse;
+                AddRuns(inverse, members, false);
+                members = inverse;
+            }
+
+            set = members;
+            return i + 1;
+        }
+
+        void GlobPatternCls::Compile()
+        {
+            SegmentList.clear();
+            ComponentList.clear();
+            ClassList.clear();
+
+            SegmentStc segment;
+            bool hasWildcard = false;
+            ComponentStc component = { 0, 0, 0 };
+
+            auto closeSegment = [&]()
+            {
+                if (hasWildcard == false)
+                {
+                    segment.ElementList.clear();
+                    segment.Searcher = SearcherCls(segment.Literal);
+                }
+                component.MinSize += segment.Literal.size();
+                component.SegmentCount++;
+                SegmentList.push_back(std::move(segment));
+                segment = SegmentStc();
+                hasWildcard = false;
+            };
+            auto closeComponent = [&]()
+            {
+                closeSegment();
+
+                // "**" leaves an empty segment between the stars, it does not change what matches
+                size_t last = component.FirstSegment + component.SegmentCount - 1;
+                for (size_t i = last; i > component.FirstSegment + 1; i--)
+                {
+                    if (SegmentList[i - 1].Literal.empty())
+                    {
+                        SegmentList.erase(SegmentList.begin() + static_cast<ptrdiff_t>(i - 1));
+                        component.SegmentCount--;
+                    }
+                }
+
+                ComponentList.push_back(component);
+                component = { SegmentList.size(), 0, 0 };
+            };
+            auto addElement = [&](uint16_t element)
+            {
+                segment.Literal.push_back(element < ANY_BYTE ? static_cast<char>(element) : '\0');
+                segment.ElementList.push_back(element);
+                hasWildcard = hasWildcard || element >= ANY_BYTE;
+            };
+
+            // Literal bytes before the first wildcard are compared up front, in Path mode they can span '/'
+            Prefix.clear();
+            bool isPrefix = true;
+
+            const std::string_view pattern = Pattern;
+            size_t i = 0;
+            while (i < pattern.size())
+            {
+                char ch = pattern[i];
+
+                isPrefix = isPrefix && ch != '*' && ch != '?' && ch != '[';
+
+                if (ch == '*')
+                {
+                    closeSegment();
+                    i++;
+                }
+                else if (ch == '?')
+                {
+                    addElement(ANY_BYTE);
+                    i++;
+                }
+                else if (ch == '[')
+                {
+                    ByteSetCls set;
+                    size_t next = ParseClass(pattern, i, set);
+                    if (next == i)
+                    {
+                        addElement(static_cast<unsigned char>(ch));
+                        i++;
+                    }
+                    else
+                    {
+                        addElement(static_cast<uint16_t>(FIRST_CLASS + ClassList.size()));
+                        ClassList.push_back(set);
+                        i = next;
+                    }
+                }
+                else
+                {
+                    if (ch == '\\' && i + 1 < pattern.size())
+                    {
+                        ch = pattern[++i];
+                    }
+                    i++;
+
+                    if (isPrefix)
+                    {
+                        Prefix.push_back(ch);
+                    }
+
+                    if (ch == '/' && Mode == GlobMode::Path)
+                    {
+                        closeComponent();
+                    }
+                    else
+                    {
+                        addElement(static_cast<unsigned char>(ch));
+                    }
+                }
+            }
+
+            closeComponent();
+        }
+
+        bool GlobPatternCls::MatchSegment(const SegmentStc& segment, const char* str) const
+        {
+            const size_t size = segment.Literal.size();
+            if (segment.ElementList.empty())
+            {
+                return size == 0 || std::memcmp(str, segment.Literal.data(), size) == 0;
+            }
+
+            for (size_t i = 0; i < size; i++)
+            {
+                uint16_t element = segment.ElementList[i];
+                if (element < ANY_BYTE)
+                {
+                    if (static_cast<unsigned char>(str[i]) != element)
+                    {
+                        return false;
+                    }
+                }
+                else if (element != ANY_BYTE && ClassList[element - FIRST_CLASS].Contains(str[i]) == false)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Finds the leftmost position at or after pos where the segment matches
+        size_t GlobPatternCls::FindSegment(const SegmentStc& segment, std::string_view str, size_t pos) const
+        {
+            if (segment.ElementList.empty())
+            {
+                return segment.Searcher.Find(str, pos);
+            }
+
+            const size_t size = segment.Literal.size();
+            for (; pos + size <= str.size(); pos++)
+            {
+                if (MatchSegment(segment, str.data() + pos))
+                {
+                    return pos;
+                }
+            }
+            return std::string_view::npos;
+        }
+
+        // Segments between two '*' can be matched at their leftmost position:
+        // a later position leaves less room for the segments after it and never helps
+        bool GlobPatternCls::MatchComponent(const ComponentStc& component, std::string_view str) const
+        {
+            if (str.size() < component.MinSize)
+            {
+                return false;
+            }
+
+            const SegmentStc* segmentList = SegmentList.data() + component.FirstSegment;
+            const SegmentStc& head = segmentList[0];
+            if (component.SegmentCount == 1)
+            {
+                return str.size() == head.Literal.size() && MatchSegment(head, str.data());
+            }
+
+            const SegmentStc& tail = segmentList[component.SegmentCount - 1];
+            size_t start = head.Literal.size();
+            size_t end = str.size() - tail.Literal.size();
+            if (MatchSegment(head, str.data()) == false || MatchSegment(tail, str.data() + end) == false)
+            {
+                return false;
+            }
+
+            // Middle segments must not run into the tail
+            std::string_view middle = str.substr(0, end);
+            for (size_t i = 1; i + 1 < component.SegmentCount; i++)
+            {
+                size_t found = FindSegment(segmentList[i], middle, start);
+                if (found == std::string_view::npos)
+                {
+                    return false;
+                }
+                start = found + segmentList[i].Literal.size();
+            }
+
+            return true;
+        }
+
+        bool GlobPatternCls::Match(std::string_view str) const
+        {
+            if (str.size() < Prefix.size() || std::memcmp(str.data(), Prefix.data(), Prefix.size()) != 0)
+            {
+                return false;
+            }
+
+            if (Mode == GlobMode::Text)
+            {
+                return MatchComponent(ComponentList.front(), str);
+            }
+
+            const char* first = str.data();
+            const char* last = first + str.size();
+            for (size_t i = 0; i < ComponentList.size(); i++)
+            {
+                const char* slash = FindByte(first, last, '/');
+                bool isLastComponent = i + 1 == ComponentList.size();
+
+                // String must have exactly as many '/' as the pattern
+                if ((slash == last) != isLastComponent)
+                {
+                    return false;
+                }
+                if (MatchComponent(ComponentList[i], std::string_view(first, static_cast<size_t>(slash - first))) == false)
+                {
+                    return false;
+                }
+
+                first = slash + 1;
+            }
+
+            return true;
+        }
+
+        std::string_view GlobPatternCls::GetPattern() const
+        {
+            return Pattern;
+        }
+
+        std::vector<std::string> FilterMatching(const std::vector<std::string>& strList, const GlobPatternCls& pattern)
+        {
+            std::vector<std::string> filteredList;
+
+            for (const std::string& str : strList)
+            {
+                if (pattern.Match(str))
+                {
+                    filteredList.push_back(str);
+                }
+            }
+
+            return filteredList;
+        }
+        std::vector<std::string> FilterNotMatching(const std::vector<std::string>& strList, const GlobPatternCls& pattern)
+        {
+            std::vector<std::string> filteredList;
+
+            for (const std::string& str : strList)
+            {
+                if (pattern.Match(str) == false)
+                {
+                    filteredList.push_back(str);
+                }
+            }
+
+            return filteredList;
+        }
+    }
+}
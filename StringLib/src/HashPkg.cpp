@@ -0,0 +1,498 @@
+#include "HashPkg.h"
+#include "CpuFeaturePkg.h"
+
+#include <cstring>
+
+#if defined(UTILITYLIB_X86)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Default secret of wyhash final version 4
+        static constexpr uint64_t HASH_SECRET[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+        // Reflected polynomials
+        static constexpr uint32_t CRC32C_POLY = 0x82F63B78;
+        static constexpr uint32_t CRC32_POLY = 0xEDB88320;
+
+        // Stream sizes of the interleaved crc32 instruction kernel
+        // Long streams leave the 3 cycle latency of the instruction hidden for large inputs, short streams for the rest
+        static constexpr size_t CRC_LONG_BLOCK_SIZE = 8192;
+        static constexpr size_t CRC_SHORT_BLOCK_SIZE = 256;
+
+        static uint64_t Load64(const unsigned char* data)
+        {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+        static uint64_t Load32(const unsigned char* data)
+        {
+            uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        // 64 x 64 bit multiplication, low half of the product is written to a, high half to b
+        static void Multiply128(uint64_t& a, uint64_t& b)
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+#elif defined(__SIZEOF_INT128__)
+            unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+            a = static_cast<uint64_t>(product);
+            b = static_cast<uint64_t>(product >> 64);
+#else
+            uint64_t highA = a >> 32;
+            uint64_t highB = b >> 32;
+            uint64_t lowA = static_cast<uint32_t>(a);
+            uint64_t lowB = static_cast<uint32_t>(b);
+            uint64_t high = highA * highB;
+            uint64_t middle0 = highA * lowB;
+            uint64_t middle1 = highB * lowA;
+            uint64_t low = lowA * lowB;
+            uint64_t sum = low + (middle0 << 32);
+            uint64_t carry = sum < low;
+            uint64_t result = sum + (middle1 << 32);
+            carry += result < sum;
+            a = result;
+            b = high + (middle0 >> 32) + (middle1 >> 32) + carry;
+#endif
+        }
+        static uint64_t Mix(uint64_t a, uint64_t b)
+        {
+            Multiply128(a, b);
+            return a ^ b;
+        }
+
+        static uint64_t MixSeed(uint64_t seed)
+        {
+            return seed ^ Mix(seed ^ HASH_SECRET[0], HASH_SECRET[1]);
+        }
+        static void MixBlock(const unsigned char* data, uint64_t& see0, uint64_t& see1, uint64_t& see2)
+        {
+            see0 = Mix(Load64(data) ^ HASH_SECRET[1], Load64(data + 8) ^ see0);
+            see1 = Mix(Load64(data + 16) ^ HASH_SECRET[2], Load64(data + 24) ^ see1);
+            see2 = Mix(Load64(data + 32) ^ HASH_SECRET[3], Load64(data + 40) ^ see2);
+        }
+        static uint64_t FinishHash(uint64_t a, uint64_t b, uint64_t see, uint64_t totalSize)
+        {
+            a ^= HASH_SECRET[1];
+            b ^= see;
+            Multiply128(a, b);
+            return Mix(a ^ HASH_SECRET[0] ^ totalSize, b ^ HASH_SECRET[1]);
+        }
+        static uint64_t HashShort(const unsigned char* data, size_t size, uint64_t see)
+        {
+            uint64_t a = 0;
+            uint64_t b = 0;
+            if (size >= 4)
+            {
+                size_t shift = (size >> 3) << 2;
+                a = (Load32(data) << 32) | Load32(data + shift);
+                b = (Load32(data + size - 4) << 32) | Load32(data + size - 4 - shift);
+            }
+            else if (size > 0)
+            {
+                a = (static_cast<uint64_t>(data[0]) << 16) | (static_cast<uint64_t>(data[size >> 1]) << 8) | data[size - 1];
+            }
+            return FinishHash(a, b, see, size);
+        }
+        // Hashes the last 1 - 48 bytes of data longer than 16 bytes, 16 bytes before "data" must be readable
+        static uint64_t HashTail(const unsigned char* data, size_t size, uint64_t see, uint64_t totalSize)
+        {
+            while (size > 16)
+            {
+                see = Mix(Load64(data) ^ HASH_SECRET[1], Load64(data + 8) ^ see);
+                data += 16;
+                size -= 16;
+            }
+            return FinishHash(Load64(data + size - 16), Load64(data + size - 8), see, totalSize);
+        }
+
+        struct CrcTableStc
+        {
+            uint32_t Value[8][256];
+        };
+        // Table k gives the CRC of a byte that is followed by k zero bytes
+        static constexpr CrcTableStc BuildCrcTable(uint32_t poly)
+        {
+            CrcTableStc table{};
+            for (uint32_t i = 0; i < 256; i++)
+            {
+                uint32_t crc = i;
+                for (size_t bit = 0; bit < 8; bit++)
+                {
+                    crc = (crc >> 1) ^ ((crc & 1) != 0 ? poly : 0);
+                }
+                table.Value[0][i] = crc;
+            }
+            for (size_t k = 1; k < 8; k++)
+            {
+                for (size_t i = 0; i < 256; i++)
+                {
+                    uint32_t previous = table.Value[k - 1][i];
+                    table.Value[k][i] = (previous >> 8) ^ table.Value[0][previous & 0xFF];
+                }
+            }
+            return table;
+        }
+
+        static constexpr CrcTableStc CRC32C_TABLE = BuildCrcTable(CRC32C_POLY);
+        static constexpr CrcTableStc CRC32_TABLE = BuildCrcTable(CRC32_POLY);
+
+        // "crc" is the register value here, the public functions invert it on the way in and out
+        static uint32_t UpdateCrcScalar(const CrcTableStc& table, const unsigned char* data, size_t size, uint32_t crc)
+        {
+            for (; size >= 8; data += 8, size -= 8)
+            {
+                uint32_t low = static_cast<uint32_t>(Load32(data)) ^ crc;
+                uint32_t high = static_cast<uint32_t>(Load32(data + 4));
+                crc = table.Value[7][low & 0xFF] ^ table.Value[6][(low >> 8) & 0xFF] ^
+                      table.Value[5][(low >> 16) & 0xFF] ^ table.Value[4][low >> 24] ^
+                      table.Value[3][high & 0xFF] ^ table.Value[2][(high >> 8) & 0xFF] ^
+                      table.Value[1][(high >> 16) & 0xFF] ^ table.Value[0][high >> 24];
+            }
+            for (; size != 0; data++, size--)
+            {
+                crc = table.Value[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+            }
+            return crc;
+        }
+        static uint32_t Crc32cScalar(const unsigned char* data, size_t size, uint32_t crc)
+        {
+            return UpdateCrcScalar(CRC32C_TABLE, data, size, crc);
+        }
+        static uint32_t Crc32Scalar(const unsigned char* data, size_t size, uint32_t crc)
+        {
+            return UpdateCrcScalar(CRC32_TABLE, data, size, crc);
+        }
+
+#if defined(_M_X64) || defined(__x86_64__)
+        // Linear operator on the 32 bit CRC register over GF(2), Column[i] is the image of bit i
+        struct CrcOperatorStc
+        {
+            uint32_t Column[32];
+        };
+        struct CrcShiftTableStc
+        {
+            uint32_t Value[4][256];
+        };
+
+        static uint32_t ApplyOperator(const CrcOperatorStc& op, uint32_t value)
+        {
+            uint32_t result = 0;
+            for (size_t i = 0; value != 0; i++, value >>= 1)
+            {
+                if ((value & 1) != 0)
+                {
+                    result ^= op.Column[i];
+                }
+            }
+            return result;
+        }
+        static CrcOperatorStc CombineOperator(const CrcOperatorStc& first, const CrcOperatorStc& second)
+        {
+            CrcOperatorStc result{};
+            for (size_t i = 0; i < 32; i++)
+            {
+                result.Column[i] = ApplyOperator(second, first.Column[i]);
+            }
+            return result;
+        }
+        // Table that moves a CRC register over "size" zero bytes, so that the CRC of A + B is Shift(crc(A), |B|) ^ crc(B)
+        static CrcShiftTableStc BuildShiftTable(uint32_t poly, size_t size)
+        {
+            // A single zero bit, then squared up for every bit of size * 8
+            CrcOperatorStc power{};
+            power.Column[0] = poly;
+            for (size_t i = 1; i < 32; i++)
+            {
+                power.Column[i] = uint32_t(1) << (i - 1);
+            }
+            CrcOperatorStc shift{};
+            for (size_t i = 0; i < 32; i++)
+            {
+                shift.Column[i] = uint32_t(1) << i;
+            }
+            for (size_t bitCount = size * 8; bitCount != 0; bitCount >>= 1)
+            {
+                if ((bitCount & 1) != 0)
+                {
+                    shift = CombineOperator(shift, power);
+                }
+                power = CombineOperator(power, power);
+            }
+
+            CrcShiftTableStc table{};
+            for (size_t k = 0; k < 4; k++)
+            {
+                for (uint32_t i = 0; i < 256; i++)
+                {
+                    table.Value[k][i] = ApplyOperator(shift, i << (8 * k));
+                }
+            }
+            return table;
+        }
+
+        // Built once on the first call, it takes too many steps for the constant evaluation limit of MSVC
+        struct CrcShiftTableSetStc
+        {
+            CrcShiftTableStc Long;
+            CrcShiftTableStc Short;
+        };
+        static const CrcShiftTableSetStc& GetCrc32cShiftTables()
+        {
+            static const CrcShiftTableSetStc tables = { BuildShiftTable(CRC32C_POLY, CRC_LONG_BLOCK_SIZE), BuildShiftTable(CRC32C_POLY, CRC_SHORT_BLOCK_SIZE) };
+            return tables;
+        }
+
+        static uint64_t ShiftCrc(const CrcShiftTableStc& table, uint64_t crc)
+        {
+            return table.Value[0][crc & 0xFF] ^ table.Value[1][(crc >> 8) & 0xFF] ^ table.Value[2][(crc >> 16) & 0xFF] ^ table.Value[3][(crc >> 24) & 0xFF];
+        }
+
+        // Three streams of blockSize bytes are computed at once, the second and third start from 0 and are shifted in at the end
+        UTILITYLIB_TARGET("sse4.2")
+        static uint64_t Crc32cSse42Streams(const unsigned char*& data, size_t& size, uint64_t crc0, size_t blockSize, const CrcShiftTableStc& table)
+        {
+            for (; size >= 3 * blockSize; data += 3 * blockSize, size -= 3 * blockSize)
+            {
+                uint64_t crc1 = 0;
+                uint64_t crc2 = 0;
+                for (size_t i = 0; i < blockSize; i += 8)
+                {
+                    crc0 = _mm_crc32_u64(crc0, Load64(data + i));
+                    crc1 = _mm_crc32_u64(crc1, Load64(data + blockSize + i));
+                    crc2 = _mm_crc32_u64(crc2, Load64(data + 2 * blockSize + i));
+                }
+                crc0 = ShiftCrc(table, crc0) ^ crc1;
+                crc0 = ShiftCrc(table, crc0) ^ crc2;
+            }
+            return crc0;
+        }
+        UTILITYLIB_TARGET("sse4.2")
+        static uint32_t Crc32cSse42(const unsigned char* data, size_t size, uint32_t crc)
+        {
+            const CrcShiftTableSetStc& tables = GetCrc32cShiftTables();
+            uint64_t crc0 = crc;
+            crc0 = Crc32cSse42Streams(data, size, crc0, CRC_LONG_BLOCK_SIZE, tables.Long);
+            crc0 = Crc32cSse42Streams(data, size, crc0, CRC_SHORT_BLOCK_SIZE, tables.Short);
+
+            for (; size >= 8; data += 8, size -= 8)
+            {
+                crc0 = _mm_crc32_u64(crc0, Load64(data));
+            }
+            uint32_t result = static_cast<uint32_t>(crc0);
+            for (; size != 0; data++, size--)
+            {
+                result = _mm_crc32_u8(result, *data);
+            }
+            return result;
+        }
+
+        // Folding constants of the reflected IEEE polynomial (x^n mod P for the fold distances, then Barrett reduction)
+        // See "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" of Intel
+        alignas(16) static constexpr uint64_t CRC32_FOLD_64[2] = { 0x0154442bd4, 0x01c6e41596 };
+        alignas(16) static constexpr uint64_t CRC32_FOLD_16[2] = { 0x01751997d0, 0x00ccaa009e };
+        alignas(16) static constexpr uint64_t CRC32_FOLD_8[2] = { 0x0163cd6124, 0x0000000000 };
+        alignas(16) static constexpr uint64_t CRC32_BARRETT[2] = { 0x01db710641, 0x01f7011641 };
+
+        UTILITYLIB_TARGET("sse4.1,pclmul")
+        static __m128i FoldCrc(__m128i value, __m128i constant, __m128i next)
+        {
+            __m128i low = _mm_clmulepi64_si128(value, constant, 0x00);
+            __m128i high = _mm_clmulepi64_si128(value, constant, 0x11);
+            return _mm_xor_si128(_mm_xor_si128(high, low), next);
+        }
+        // Four 16 byte lanes are folded forward by 64 bytes at a time, then into a single lane and reduced to 32 bits
+        UTILITYLIB_TARGET("sse4.1,pclmul")
+        static uint32_t Crc32Pclmul(const unsigned char* data, size_t size, uint32_t crc)
+        {
+            if (size < 64)
+            {
+                return Crc32Scalar(data, size, crc);
+            }
+
+            __m128i lane0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), _mm_cvtsi32_si128(static_cast<int>(crc)));
+            __m128i lane1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16));
+            __m128i lane2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32));
+            __m128i lane3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48));
+            data += 64;
+            size -= 64;
+
+            __m128i constant = _mm_load_si128(reinterpret_cast<const __m128i*>(CRC32_FOLD_64));
+            for (; size >= 64; data += 64, size -= 64)
+            {
+                lane0 = FoldCrc(lane0, constant, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+                lane1 = FoldCrc(lane1, constant, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)));
+                lane2 = FoldCrc(lane2, constant, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)));
+                lane3 = FoldCrc(lane3, constant, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)));
+            }
+
+            constant = _mm_load_si128(reinterpret_cast<const __m128i*>(CRC32_FOLD_16));
+            __m128i value = FoldCrc(lane0, constant, lane1);
+            value = FoldCrc(value, constant, lane2);
+            value = FoldCrc(value, constant, lane3);
+            for (; size >= 16; data += 16, size -= 16)
+            {
+                value = FoldCrc(value, constant, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+            }
+
+            // 128 to 64 bits
+            const __m128i mask32 = _mm_setr_epi32(-1, 0, -1, 0);
+            value = _mm_xor_si128(_mm_srli_si128(value, 8), _mm_clmulepi64_si128(value, constant, 0x10));
+            constant = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(CRC32_FOLD_8));
+            value = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(value, mask32), constant, 0x00), _mm_srli_si128(value, 4));
+
+            // Barrett reduction to 32 bits
+            constant = _mm_load_si128(reinterpret_cast<const __m128i*>(CRC32_BARRETT));
+            __m128i quotient = _mm_clmulepi64_si128(_mm_and_si128(value, mask32), constant, 0x10);
+            quotient = _mm_clmulepi64_si128(_mm_and_si128(quotient, mask32), constant, 0x00);
+            uint32_t result = static_cast<uint32_t>(_mm_extract_epi32(_mm_xor_si128(value, quotient), 1));
+
+            return Crc32Scalar(data, size, result);
+        }
+#endif
+
+        // Kernel table, selected once according to the CPU
+        struct HashKernelStc
+        {
+            uint32_t (*Crc32c)(const unsigned char*, size_t, uint32_t);
+            uint32_t (*Crc32)(const unsigned char*, size_t, uint32_t);
+        };
+
+        static HashKernelStc SelectKernels()
+        {
+            HashKernelStc kernels = { Crc32cScalar, Crc32Scalar };
+#if defined(_M_X64) || defined(__x86_64__)
+            const CpuFeatureStc& features = GetCpuFeatures();
+            if (features.Sse42)
+            {
+                kernels.Crc32c = Crc32cSse42;
+            }
+            if (features.Pclmul && features.Sse41)
+            {
+                kernels.Crc32 = Crc32Pclmul;
+            }
+#endif
+            return kernels;
+        }
+        static const HashKernelStc& GetKernels()
+        {
+            static const HashKernelStc kernels = SelectKernels();
+            return kernels;
+        }
+
+        uint64_t Hash64(std::string_view data, uint64_t seed)
+        {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data.data());
+            size_t size = data.size();
+            uint64_t see0 = MixSeed(seed);
+
+            if (size <= 16)
+            {
+                return HashShort(bytes, size, see0);
+            }
+            if (size > 48)
+            {
+                uint64_t see1 = see0;
+                uint64_t see2 = see0;
+                do
+                {
+                    MixBlock(bytes, see0, see1, see2);
+                    bytes += 48;
+                    size -= 48;
+                } while (size > 48);
+                see0 ^= see1 ^ see2;
+            }
+            return HashTail(bytes, size, see0, data.size());
+        }
+
+        uint32_t Crc32c(std::string_view data, uint32_t crc)
+        {
+            return ~GetKernels().Crc32c(reinterpret_cast<const unsigned char*>(data.data()), data.size(), ~crc);
+        }
+
+        uint32_t Crc32(std::string_view data, uint32_t crc)
+        {
+            return ~GetKernels().Crc32(reinterpret_cast<const unsigned char*>(data.data()), data.size(), ~crc);
+        }
+
+        Hash64StreamCls::Hash64StreamCls(uint64_t seed)
+        {
+            Reset(seed);
+        }
+
+        void Hash64StreamCls::Reset(uint64_t seed)
+        {
+            Seed = MixSeed(seed);
+            See0 = Seed;
+            See1 = Seed;
+            See2 = Seed;
+            TotalSize = 0;
+            PendingSize = 0;
+            std::memset(Buffer, 0, sizeof(Buffer));
+        }
+
+        // A block is only mixed once a byte after it is known, Hash64() leaves the last 1 - 48 bytes to HashTail() as well
+        void Hash64StreamCls::Update(std::string_view data)
+        {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data.data());
+            size_t size = data.size();
+            unsigned char* pending = Buffer + HISTORY_SIZE;
+            TotalSize += size;
+
+            if (PendingSize + size <= BLOCK_SIZE)
+            {
+                std::memcpy(pending + PendingSize, bytes, size);
+                PendingSize += size;
+                return;
+            }
+
+            // Buffer is completed and mixed first, at least one byte of "data" is left after it
+            const unsigned char* lastBlock = nullptr;
+            if (PendingSize != 0)
+            {
+                size_t fillSize = BLOCK_SIZE - PendingSize;
+                std::memcpy(pending + PendingSize, bytes, fillSize);
+                MixBlock(pending, See0, See1, See2);
+                lastBlock = pending;
+                bytes += fillSize;
+                size -= fillSize;
+            }
+            for (; size > BLOCK_SIZE; bytes += BLOCK_SIZE, size -= BLOCK_SIZE)
+            {
+                MixBlock(bytes, See0, See1, See2);
+                lastBlock = bytes;
+            }
+
+            // Last 16 bytes that are mixed become the history of the pending bytes
+            std::memmove(Buffer, lastBlock + BLOCK_SIZE - HISTORY_SIZE, HISTORY_SIZE);
+            std::memcpy(pending, bytes, size);
+            PendingSize = size;
+        }
+
+        uint64_t Hash64StreamCls::Finish() const
+        {
+            const unsigned char* pending = Buffer + HISTORY_SIZE;
+            if (TotalSize <= 16)
+            {
+                return HashShort(pending, PendingSize, Seed);
+            }
+
+            uint64_t see = See0;
+            if (TotalSize > BLOCK_SIZE)
+            {
+                see ^= See1 ^ See2;
+            }
+            return HashTail(pending, PendingSize, see, TotalSize);
+        }
+    }
+}
@@ -0,0 +1,424 @@
+#include "HexPkg.h"
+#include "CpuFeaturePkg.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(UTILITYLIB_X86)
+#include <immintrin.h>
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        static constexpr char LOWER_DIGITS[] = "0123456789abcdef";
+        static constexpr char UPPER_DIGITS[] = "0123456789ABCDEF";
+        static constexpr uint8_t INVALID_VALUE = 0xFF;
+
+        // Offset, two spaces, 16 * "xx " plus the space in the middle, " |", gutter, "|\n"
+        static constexpr size_t LINE_PREFIX_SIZE = 10;
+        static constexpr size_t LINE_HEX_SIZE = HEX_DUMP_LINE_BYTES * 3 + 1;
+        static constexpr size_t LINE_GUTTER_START = LINE_PREFIX_SIZE + LINE_HEX_SIZE + 2;
+        static constexpr size_t FULL_LINE_SIZE = LINE_GUTTER_START + HEX_DUMP_LINE_BYTES + 2;
+
+        struct PairTableStc
+        {
+            char Pair[512];
+        };
+        struct DecodeTableStc
+        {
+            uint8_t Value[256];
+        };
+
+        static constexpr PairTableStc BuildPairTable(const char* digits)
+        {
+            PairTableStc table{};
+            for (size_t i = 0; i < 256; i++)
+            {
+                table.Pair[2 * i] = digits[i >> 4];
+                table.Pair[2 * i + 1] = digits[i & 0x0F];
+            }
+            return table;
+        }
+        static constexpr DecodeTableStc BuildDecodeTable()
+        {
+            DecodeTableStc table{};
+            for (size_t i = 0; i < 256; i++)
+            {
+                table.Value[i] = INVALID_VALUE;
+            }
+            for (size_t i = 0; i < 16; i++)
+            {
+                table.Value[static_cast<unsigned char>(LOWER_DIGITS[i])] = static_cast<uint8_t>(i);
+                table.Value[static_cast<unsigned char>(UPPER_DIGITS[i])] = static_cast<uint8_t>(i);
+            }
+            return table;
+        }
+
+        static constexpr PairTableStc LOWER_TABLE = BuildPairTable(LOWER_DIGITS);
+        static constexpr PairTableStc UPPER_TABLE = BuildPairTable(UPPER_DIGITS);
+        static constexpr DecodeTableStc DECODE_TABLE = BuildDecodeTable();
+
+        static const char* GetDigits(HexCase hexCase)
+        {
+            return hexCase == HexCase::Upper ? UPPER_DIGITS : LOWER_DIGITS;
+        }
+        static const char* GetPairTable(HexCase hexCase)
+        {
+            return hexCase == HexCase::Upper ? UPPER_TABLE.Pair : LOWER_TABLE.Pair;
+        }
+
+        // Scalar kernels
+
+        static void EncodeScalar(const unsigned char* in, size_t size, char* out, HexCase hexCase)
+        {
+            const char* table = GetPairTable(hexCase);
+            for (size_t i = 0; i < size; i++)
+            {
+                std::memcpy(out + 2 * i, table + 2 * in[i], 2);
+            }
+        }
+        static bool DecodeScalar(const char* in, size_t size, unsigned char* out)
+        {
+            for (size_t i = 0; i + 2 <= size; i += 2)
+            {
+                uint32_t high = DECODE_TABLE.Value[static_cast<unsigned char>(in[i])];
+                uint32_t low = DECODE_TABLE.Value[static_cast<unsigned char>(in[i + 1])];
+                if (((high | low) & 0x80) != 0)
+                {
+                    return false;
+                }
+                out[i / 2] = static_cast<unsigned char>((high << 4) | low);
+            }
+            return true;
+        }
+
+        static void WriteOffset(size_t offset, char* out)
+        {
+            const char* table = LOWER_TABLE.Pair;
+            uint32_t value = static_cast<uint32_t>(offset);
+            std::memcpy(out, table + 2 * (value >> 24), 2);
+            std::memcpy(out + 2, table + 2 * ((value >> 16) & 0xFF), 2);
+            std::memcpy(out + 4, table + 2 * ((value >> 8) & 0xFF), 2);
+            std::memcpy(out + 6, table + 2 * (value & 0xFF), 2);
+            out[8] = ' ';
+            out[9] = ' ';
+        }
+
+        // Writes one line of 1 - 16 bytes, returns its size
+        static size_t DumpLineScalar(const unsigned char* in, size_t size, char* out, size_t offset)
+        {
+            const char* table = LOWER_TABLE.Pair;
+            WriteOffset(offset, out);
+
+            char* hex = out + LINE_PREFIX_SIZE;
+            for (size_t i = 0; i < HEX_DUMP_LINE_BYTES; i++)
+            {
+                if (i < size)
+                {
+                    std::memcpy(hex, table + 2 * in[i], 2);
+                }
+                else
+                {
+                    hex[0] = ' ';
+                    hex[1] = ' ';
+                }
+                hex[2] = ' ';
+                hex += 3;
+                if (i == HEX_DUMP_LINE_BYTES / 2 - 1)
+                {
+                    *hex++ = ' ';
+                }
+            }
+
+            *hex++ = ' ';
+            *hex++ = '|';
+            for (size_t i = 0; i < size; i++)
+            {
+                *hex++ = in[i] >= 0x20 && in[i] <= 0x7E ? static_cast<char>(in[i]) : '.';
+            }
+            *hex++ = '|';
+            *hex++ = '\n';
+
+            return static_cast<size_t>(hex - out);
+        }
+        static void DumpScalar(const unsigned char* in, size_t lineCount, char* out, size_t offset)
+        {
+            for (size_t line = 0; line < lineCount; line++)
+            {
+                DumpLineScalar(in + line * HEX_DUMP_LINE_BYTES, HEX_DUMP_LINE_BYTES, out + line * FULL_LINE_SIZE, offset + line * HEX_DUMP_LINE_BYTES);
+            }
+        }
+
+#if defined(UTILITYLIB_X86)
+        // SSSE3 kernels
+        //
+        // Encoding: both nibbles of every byte index a 16 entry table of digits, the two digit vectors are interleaved
+        //
+        // Decoding: a character is a digit if (ch - '0') < 10 or ((ch | 0x20) - 'a') < 6 as unsigned bytes,
+        // multiply-add packs every digit pair into a byte
+        //
+        // Hexdump: the 32 digits of a line are spread over the hex columns by shuffles that leave holes for the spaces,
+        // the separators are ORed into the holes
+        // Stores overlap, every one of them stays inside the line and later stores overwrite the unused tail of earlier ones
+
+        UTILITYLIB_TARGET("ssse3")
+        static void SplitDigitsSsse3(__m128i block, __m128i digits, __m128i& highDigits, __m128i& lowDigits)
+        {
+            const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+            highDigits = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(block, 4), nibbleMask));
+            lowDigits = _mm_shuffle_epi8(digits, _mm_and_si128(block, nibbleMask));
+        }
+        UTILITYLIB_TARGET("ssse3")
+        static void EncodeSsse3(const unsigned char* in, size_t size, char* out, HexCase hexCase)
+        {
+            const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(GetDigits(hexCase)));
+            size_t i = 0;
+
+            for (; i + 16 <= size; i += 16)
+            {
+                __m128i highDigits;
+                __m128i lowDigits;
+                SplitDigitsSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), digits, highDigits, lowDigits);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm_unpacklo_epi8(highDigits, lowDigits));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16), _mm_unpackhi_epi8(highDigits, lowDigits));
+            }
+
+            EncodeScalar(in + i, size - i, out + 2 * i, hexCase);
+        }
+
+        // Returns value of every digit, "isValid" keeps 0xFF only in the bytes that were digits
+        UTILITYLIB_TARGET("ssse3")
+        static __m128i DigitValuesSsse3(__m128i block, __m128i& isValid)
+        {
+            __m128i decimal = _mm_sub_epi8(block, _mm_set1_epi8('0'));
+            __m128i isDecimal = _mm_cmpeq_epi8(_mm_min_epu8(decimal, _mm_set1_epi8(9)), decimal);
+            __m128i letter = _mm_sub_epi8(_mm_or_si128(block, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+
+            isValid = _mm_and_si128(isValid, _mm_or_si128(isDecimal, isLetter));
+            return _mm_or_si128(_mm_and_si128(isDecimal, decimal), _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+        }
+        UTILITYLIB_TARGET("ssse3")
+        static bool DecodeSsse3(const char* in, size_t size, unsigned char* out)
+        {
+            const __m128i weights = _mm_set1_epi16(0x0110);
+            __m128i isValid = _mm_set1_epi8(-1);
+            size_t i = 0;
+
+            for (; i + 32 <= size; i += 32)
+            {
+                __m128i first = DigitValuesSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), isValid);
+                __m128i second = DigitValuesSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 16)), isValid);
+                __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 2), bytes);
+            }
+
+            if (_mm_movemask_epi8(isValid) != 0xFFFF)
+            {
+                return false;
+            }
+            return DecodeScalar(in + i, size - i, out + i / 2);
+        }
+
+        UTILITYLIB_TARGET("ssse3")
+        static void DumpSsse3(const unsigned char* in, size_t lineCount, char* out, size_t offset)
+        {
+            const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(LOWER_DIGITS));
+            // Digit pairs of 8 bytes become 24 columns "xx xx ... xx ", written as 16 + 8 columns
+            const __m128i headSpread = _mm_setr_epi8(0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1, 10);
+            const __m128i tailSpread = _mm_setr_epi8(11, -1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+            const __m128i headSpaces = _mm_setr_epi8(0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0);
+            // Tail of the first half is followed by the middle space, tail of the second half by " |"
+            const __m128i firstTailSpaces = _mm_setr_epi8(0, ' ', 0, 0, ' ', 0, 0, ' ', ' ', 0, 0, 0, 0, 0, 0, 0);
+            const __m128i secondTailSpaces = _mm_setr_epi8(0, ' ', 0, 0, ' ', 0, 0, ' ', ' ', '|', 0, 0, 0, 0, 0, 0);
+            const __m128i dot = _mm_set1_epi8('.');
+
+            for (size_t line = 0; line < lineCount; line++)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + line * HEX_DUMP_LINE_BYTES));
+                char* lineOut = out + line * FULL_LINE_SIZE;
+                WriteOffset(offset + line * HEX_DUMP_LINE_BYTES, lineOut);
+
+                __m128i highDigits;
+                __m128i lowDigits;
+                SplitDigitsSsse3(block, digits, highDigits, lowDigits);
+                __m128i firstPairs = _mm_unpacklo_epi8(highDigits, lowDigits);
+                __m128i secondPairs = _mm_unpackhi_epi8(highDigits, lowDigits);
+
+                char* hex = lineOut + LINE_PREFIX_SIZE;
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(hex), _mm_or_si128(_mm_shuffle_epi8(firstPairs, headSpread), headSpaces));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(hex + 16), _mm_or_si128(_mm_shuffle_epi8(firstPairs, tailSpread), firstTailSpaces));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(hex + 25), _mm_or_si128(_mm_shuffle_epi8(secondPairs, headSpread), headSpaces));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(hex + 41), _mm_or_si128(_mm_shuffle_epi8(secondPairs, tailSpread), secondTailSpaces));
+
+                // 0x80 - 0xFF are negative as signed bytes, so a single signed range check covers them
+                __m128i isPrintable = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(0x1F)), _mm_cmplt_epi8(block, _mm_set1_epi8(0x7F)));
+                __m128i gutter = _mm_or_si128(_mm_and_si128(isPrintable, block), _mm_andnot_si128(isPrintable, dot));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(lineOut + LINE_GUTTER_START), gutter);
+                lineOut[FULL_LINE_SIZE - 2] = '|';
+                lineOut[FULL_LINE_SIZE - 1] = '\n';
+            }
+        }
+
+        // AVX2 kernels
+        // Same algorithms as above, both 128 bit lanes work on their own half, tails are finished by the scalar kernels
+
+        UTILITYLIB_TARGET("avx2")
+        static void EncodeAvx2(const unsigned char* in, size_t size, char* out, HexCase hexCase)
+        {
+            const __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(GetDigits(hexCase))));
+            const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+            size_t i = 0;
+
+            for (; i + 32 <= size; i += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                __m256i highDigits = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(block, 4), nibbleMask));
+                __m256i lowDigits = _mm256_shuffle_epi8(digits, _mm256_and_si256(block, nibbleMask));
+
+                // Interleaving works per lane: low result holds bytes 0 - 7 and 16 - 23, high result 8 - 15 and 24 - 31
+                __m256i low = _mm256_unpacklo_epi8(highDigits, lowDigits);
+                __m256i high = _mm256_unpackhi_epi8(highDigits, lowDigits);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i), _mm256_permute2x128_si256(low, high, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32), _mm256_permute2x128_si256(low, high, 0x31));
+            }
+
+            EncodeScalar(in + i, size - i, out + 2 * i, hexCase);
+        }
+
+        UTILITYLIB_TARGET("avx2")
+        static __m256i DigitValuesAvx2(__m256i block, __m256i& isValid)
+        {
+            __m256i decimal = _mm256_sub_epi8(block, _mm256_set1_epi8('0'));
+            __m256i isDecimal = _mm256_cmpeq_epi8(_mm256_min_epu8(decimal, _mm256_set1_epi8(9)), decimal);
+            __m256i letter = _mm256_sub_epi8(_mm256_or_si256(block, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+            __m256i isLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+
+            isValid = _mm256_and_si256(isValid, _mm256_or_si256(isDecimal, isLetter));
+            return _mm256_or_si256(_mm256_and_si256(isDecimal, decimal), _mm256_and_si256(isLetter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+        }
+        UTILITYLIB_TARGET("avx2")
+        static bool DecodeAvx2(const char* in, size_t size, unsigned char* out)
+        {
+            const __m256i weights = _mm256_set1_epi16(0x0110);
+            __m256i isValid = _mm256_set1_epi8(-1);
+            size_t i = 0;
+
+            for (; i + 64 <= size; i += 64)
+            {
+                __m256i first = DigitValuesAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)), isValid);
+                __m256i second = DigitValuesAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 32)), isValid);
+                __m256i bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(first, weights), _mm256_maddubs_epi16(second, weights));
+                // Packing works per lane, 8 byte quarters come out as first.low, second.low, first.high, second.high
+                bytes = _mm256_permute4x64_epi64(bytes, 0xD8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i / 2), bytes);
+            }
+
+            if (static_cast<uint32_t>(_mm256_movemask_epi8(isValid)) != 0xFFFFFFFF)
+            {
+                return false;
+            }
+            return DecodeScalar(in + i, size - i, out + i / 2);
+        }
+#endif
+
+        // Kernel table, selected once according to the CPU
+        // Hexdump works on single 16 byte lines, AVX2 has nothing to add to the SSSE3 kernel there
+        struct HexKernelStc
+        {
+            void (*Encode)(const unsigned char*, size_t, char*, HexCase);
+            bool (*Decode)(const char*, size_t, unsigned char*);
+            void (*Dump)(const unsigned char*, size_t, char*, size_t);
+        };
+
+        static HexKernelStc SelectKernels()
+        {
+#if defined(UTILITYLIB_X86)
+            const CpuFeatureStc& features = GetCpuFeatures();
+            if (features.Avx2)
+            {
+                return { EncodeAvx2, DecodeAvx2, DumpSsse3 };
+            }
+            if (features.Ssse3)
+            {
+                return { EncodeSsse3, DecodeSsse3, DumpSsse3 };
+            }
+#endif
+            return { EncodeScalar, DecodeScalar, DumpScalar };
+        }
+        static const HexKernelStc& GetKernels()
+        {
+            static const HexKernelStc kernels = SelectKernels();
+            return kernels;
+        }
+
+        size_t EncodeHex(std::string_view in, char* out, HexCase hexCase)
+        {
+            GetKernels().Encode(reinterpret_cast<const unsigned char*>(in.data()), in.size(), out, hexCase);
+            return 2 * in.size();
+        }
+        std::string EncodeHex(std::string_view in, HexCase hexCase)
+        {
+            std::string out(2 * in.size(), '\0');
+            EncodeHex(in, out.data(), hexCase);
+            return out;
+        }
+
+        StringError DecodeHex(std::string_view in, char* out, size_t& outSize)
+        {
+            outSize = 0;
+            if (in.size() % 2 != 0)
+            {
+                return StringError::InvalidArgument;
+            }
+            if (GetKernels().Decode(in.data(), in.size(), reinterpret_cast<unsigned char*>(out)) == false)
+            {
+                return StringError::InvalidArgument;
+            }
+
+            outSize = in.size() / 2;
+            return StringError::Success;
+        }
+        StringError DecodeHex(std::string_view in, std::string& out)
+        {
+            out.resize(in.size() / 2);
+
+            size_t outSize = 0;
+            StringError result = DecodeHex(in, out.data(), outSize);
+            if (result != StringError::Success)
+            {
+                out.clear();
+            }
+            return result;
+        }
+
+        size_t GetHexDumpSize(size_t size)
+        {
+            size_t rest = size % HEX_DUMP_LINE_BYTES;
+            return size / HEX_DUMP_LINE_BYTES * FULL_LINE_SIZE + (rest == 0 ? 0 : FULL_LINE_SIZE - HEX_DUMP_LINE_BYTES + rest);
+        }
+
+        size_t FormatHexDump(std::string_view in, char* out, size_t offset)
+        {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in.data());
+            size_t lineCount = in.size() / HEX_DUMP_LINE_BYTES;
+            GetKernels().Dump(bytes, lineCount, out, offset);
+
+            size_t written = lineCount * FULL_LINE_SIZE;
+            size_t done = lineCount * HEX_DUMP_LINE_BYTES;
+            if (done != in.size())
+            {
+                written += DumpLineScalar(bytes + done, in.size() - done, out + written, offset + done);
+            }
+            return written;
+        }
+        void AppendHexDump(std::string_view in, std::string& out, size_t offset)
+        {
+            size_t oldSize = out.size();
+            out.resize(oldSize + GetHexDumpSize(in.size()));
+            FormatHexDump(in, out.data() + oldSize, offset);
+        }
+    }
+}
@@ -0,0 +1,463 @@
+#include "IpAddressCls.h"
+
+#include <array>
+#include <bit>
+#include <cstring>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        static constexpr uint64_t LOW_BITS = 0x0101010101010101ull;
+        static constexpr uint64_t HIGH_BITS = 0x8080808080808080ull;
+        static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+        // Decimal text of every octet, 1 - 3 characters
+        struct OctetTextStc
+        {
+            char Text[3];
+            uint8_t Size;
+        };
+
+        static constexpr std::array<OctetTextStc, 256> OCTET_TEXT_TABLE = []()
+        {
+            std::array<OctetTextStc, 256> table{};
+            for (size_t i = 0; i < table.size(); i++)
+            {
+                OctetTextStc& entry = table[i];
+                if (i >= 100)
+                {
+                    entry.Text[entry.Size++] = static_cast<char>('0' + i / 100);
+                }
+                if (i >= 10)
+                {
+                    entry.Text[entry.Size++] = static_cast<char>('0' + i / 10 % 10);
+                }
+                entry.Text[entry.Size++] = static_cast<char>('0' + i % 10);
+            }
+            return table;
+        }();
+
+        // Sets the high bit of every byte of word that equals ch, bytes never carry into each other
+        static uint64_t MatchByte(uint64_t word, uint8_t ch)
+        {
+            uint64_t x = word ^ (LOW_BITS * ch);
+            return ~(((x & ~HIGH_BITS) + ~HIGH_BITS) | x) & HIGH_BITS;
+        }
+        // Sets the high bit of every byte of word that is '0' - '9'
+        static uint64_t MatchDigit(uint64_t word)
+        {
+            uint64_t low = word & ~HIGH_BITS;
+            uint64_t atLeastZero = low + LOW_BITS * (0x80 - '0');
+            uint64_t aboveNine = low + LOW_BITS * (0x80 - '9' - 1);
+            return atLeastZero & ~aboveNine & ~word & HIGH_BITS;
+        }
+        // Reads count (1 - 8) bytes as a little endian word, so the first byte is always the low byte
+        static uint64_t LoadWord(const char* str, size_t count)
+        {
+            uint64_t word = 0;
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                memcpy(&word, str, count);
+            }
+            else
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    word |= static_cast<uint64_t>(static_cast<uint8_t>(str[i])) << (i * 8);
+                }
+            }
+            return word;
+        }
+        // Gathers the high bits of the 8 bytes into the low 8 bits, byte 0 becomes bit 0
+        static uint32_t GatherHighBits(uint64_t mask)
+        {
+            return static_cast<uint32_t>(((mask >> 7) * 0x0102040810204080ull) >> 56);
+        }
+
+        // Returns the 3 bytes of the 16 byte text held in low and high that come right before end (1 - 15),
+        // bytes before the text are zero
+        static uint32_t GetThreeBytesBefore(uint64_t low, uint64_t high, size_t end)
+        {
+            uint64_t word;
+            if (end <= 8)
+            {
+                word = (low << (8 * (8 - end))) >> 40;
+            }
+            else if (end >= 11)
+            {
+                word = high >> (8 * (end - 11));
+            }
+            else
+            {
+                word = (low >> (8 * (end - 3))) | (high << (8 * (11 - end)));
+            }
+            return static_cast<uint32_t>(word & 0xFFFFFF);
+        }
+
+        // Converts the last digitCount (1 - 3) characters of word into their value
+        // Digits are moved to 16 bit lanes and one multiplication adds d0 * 100 + d1 * 10 + d2 in the third lane
+        static uint32_t ParseOctet(uint32_t word, size_t digitCount)
+        {
+            uint32_t mask = (0xFFFFFFu << (8 * (3 - digitCount))) & 0xFFFFFFu;
+            uint64_t digits = (word & mask) - (0x303030u & mask);
+            uint64_t lanes = (digits & 0xFF) | ((digits & 0xFF00) << 8) | ((digits & 0xFF0000) << 16);
+            return static_cast<uint32_t>(((lanes * ((100ull << 32) | (10ull << 16) | 1)) >> 32) & 0xFFFF);
+        }
+
+        // Returns false if str is not a dotted quad, bytes is written only on success
+        static bool ParseDottedQuad(std::string_view str, uint8_t* bytes)
+        {
+            const size_t size = str.size();
+            if (size < 7 || size > MAX_IPV4_ADDRESS_CHARS)
+            {
+                return false;
+            }
+
+            // Text is held in two words, zeros after the end
+            // Loads stay inside str, the high word is loaded from the last 8 bytes and shifted down
+            uint64_t low = 0;
+            uint64_t high = 0;
+            if (size >= 8)
+            {
+                low = LoadWord(str.data(), 8);
+                high = (LoadWord(str.data() + size - 8, 8) >> 8) >> (8 * (15 - size));
+            }
+            else
+            {
+                low = LoadWord(str.data(), 7);
+            }
+
+            // Every character is either a dot or a digit
+            uint32_t dots = GatherHighBits(MatchByte(low, '.')) | (GatherHighBits(MatchByte(high, '.')) << 8);
+            uint32_t digits = GatherHighBits(MatchDigit(low)) | (GatherHighBits(MatchDigit(high)) << 8);
+
+            if ((dots | digits) != (1u << size) - 1)
+            {
+                return false;
+            }
+
+            // Fields end at the dots and at the end of the text, the fourth field must end at the end of the text
+            // (fewer dots make a field longer than 3 digits, more dots leave a dot for the fourth end)
+            uint32_t ends = dots | (1u << size);
+            uint8_t result[4];
+            size_t start = 0;
+            for (size_t i = 0; i < 4; i++)
+            {
+                size_t end = static_cast<size_t>(std::countr_zero(ends));
+                ends &= ends - 1;
+
+                size_t digitCount = end - start;
+                if (digitCount == 0 || digitCount > 3)
+                {
+                    return false;
+                }
+
+                // Leading zeros are rejected
+                uint32_t word = GetThreeBytesBefore(low, high, end);
+                if (digitCount > 1 && ((word >> (8 * (3 - digitCount))) & 0xFF) == '0')
+                {
+                    return false;
+                }
+
+                uint32_t value = ParseOctet(word, digitCount);
+                if (value > 255)
+                {
+                    return false;
+                }
+
+                result[i] = static_cast<uint8_t>(value);
+                start = end + 1;
+            }
+
+            if (ends != 0)
+            {
+                return false;
+            }
+
+            memcpy(bytes, result, sizeof(result));
+            return true;
+        }
+
+        static int32_t HexDigitValue(char ch)
+        {
+            if (ch >= '0' && ch <= '9') return ch - '0';
+            if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+            if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+            return -1;
+        }
+
+        // Returns false if str is not IPv6 text, bytes is written only on success
+        static bool ParseIpv6Text(std::string_view str, uint8_t* bytes)
+        {
+            const size_t size = str.size();
+            if (size < 2 || size > MAX_IP_ADDRESS_CHARS)
+            {
+                return false;
+            }
+
+            uint16_t groups[8] = {};
+            size_t groupCount = 0;
+            size_t gapIndex = SIZE_MAX;
+            size_t pos = 0;
+
+            if (str[0] == ':')
+            {
+                if (str[1] != ':')
+                {
+                    return false;
+                }
+                gapIndex = 0;
+                pos = 2;
+            }
+
+            while (pos < size)
+            {
+                size_t groupStart = pos;
+                uint32_t value = 0;
+                int32_t digit;
+                while (pos < size && pos - groupStart < 5 && (digit = HexDigitValue(str[pos])) >= 0)
+                {
+                    value = (value << 4) | static_cast<uint32_t>(digit);
+                    pos++;
+                }
+
+                // Dotted quad takes the last two groups
+                if (pos < size && str[pos] == '.')
+                {
+                    uint8_t quad[4];
+                    if (groupCount > 6 || ParseDottedQuad(str.substr(groupStart), quad) == false)
+                    {
+                        return false;
+                    }
+                    groups[groupCount++] = static_cast<uint16_t>((quad[0] << 8) | quad[1]);
+                    groups[groupCount++] = static_cast<uint16_t>((quad[2] << 8) | quad[3]);
+                    pos = size;
+                    break;
+                }
+
+                size_t digitCount = pos - groupStart;
+                if (digitCount == 0 || digitCount > 4 || groupCount == 8)
+                {
+                    return false;
+                }
+                groups[groupCount++] = static_cast<uint16_t>(value);
+
+                if (pos == size)
+                {
+                    break;
+                }
+                if (str[pos] != ':' || ++pos == size)
+                {
+                    return false;
+                }
+                if (str[pos] == ':')
+                {
+                    if (gapIndex != SIZE_MAX)
+                    {
+                        return false;
+                    }
+                    gapIndex = groupCount;
+                    pos++;
+                }
+            }
+
+            // "::" stands for at least one zero group
+            if ((gapIndex == SIZE_MAX && groupCount != 8) || (gapIndex != SIZE_MAX && groupCount > 7))
+            {
+                return false;
+            }
+
+            uint16_t expanded[8] = {};
+            if (gapIndex == SIZE_MAX)
+            {
+                memcpy(expanded, groups, sizeof(groups));
+            }
+            else
+            {
+                size_t tailCount = groupCount - gapIndex;
+                memcpy(expanded, groups, gapIndex * sizeof(uint16_t));
+                memcpy(expanded + 8 - tailCount, groups + gapIndex, tailCount * sizeof(uint16_t));
+            }
+
+            for (size_t i = 0; i < 8; i++)
+            {
+                bytes[i * 2] = static_cast<uint8_t>(expanded[i] >> 8);
+                bytes[i * 2 + 1] = static_cast<uint8_t>(expanded[i]);
+            }
+            return true;
+        }
+
+        // Writes "a.b.c.d", returns number of characters written
+        static size_t FormatDottedQuad(const uint8_t* bytes, char* buffer)
+        {
+            // Each octet is copied as 4 bytes and the extra byte is overwritten by the next one,
+            // so the text is built in a local buffer with a spare byte at the end
+            char text[MAX_IPV4_ADDRESS_CHARS + 1];
+            size_t size = 0;
+            for (size_t i = 0; i < 4; i++)
+            {
+                const OctetTextStc& entry = OCTET_TEXT_TABLE[bytes[i]];
+                memcpy(text + size, &entry, sizeof(entry));
+                size += entry.Size;
+                text[size] = '.';
+                size += i != 3 ? 1 : 0;
+            }
+            memcpy(buffer, text, size);
+            return size;
+        }
+
+        // Writes RFC 5952 text, returns number of characters written
+        static size_t FormatIpv6Text(const uint8_t* bytes, char* buffer)
+        {
+            uint16_t groups[8];
+            for (size_t i = 0; i < 8; i++)
+            {
+                groups[i] = static_cast<uint16_t>((bytes[i * 2] << 8) | bytes[i * 2 + 1]);
+            }
+
+            size_t size = 0;
+
+            // IPv4 mapped addresses keep their dotted quad
+            if (groups[0] == 0 && groups[1] == 0 && groups[2] == 0 && groups[3] == 0 && groups[4] == 0 && groups[5] == 0xFFFF)
+            {
+                memcpy(buffer, "::ffff:", 7);
+                return 7 + FormatDottedQuad(bytes + 12, buffer + 7);
+            }
+
+            // Longest run of at least two zero groups is written as "::", the first one wins ties
+            size_t gapStart = 8;
+            size_t gapLength = 1;
+            for (size_t i = 0; i < 8;)
+            {
+                if (groups[i] != 0)
+                {
+                    i++;
+                    continue;
+                }
+                size_t runStart = i;
+                while (i < 8 && groups[i] == 0)
+                {
+                    i++;
+                }
+                if (i - runStart > gapLength)
+                {
+                    gapStart = runStart;
+                    gapLength = i - runStart;
+                }
+            }
+
+            for (size_t i = 0; i < 8; i++)
+            {
+                if (i == gapStart)
+                {
+                    buffer[size++] = ':';
+                    buffer[size++] = ':';
+                    i += gapLength - 1;
+                    continue;
+                }
+                if (i != 0 && i != gapStart + gapLength)
+                {
+                    buffer[size++] = ':';
+                }
+
+                uint16_t group = groups[i];
+                size_t digitCount = group == 0 ? 1 : (static_cast<size_t>(std::bit_width(group)) + 3) / 4;
+                for (size_t j = digitCount; j > 0; j--)
+                {
+                    buffer[size++] = HEX_DIGITS[(group >> ((j - 1) * 4)) & 0xF];
+                }
+            }
+            return size;
+        }
+
+        IpAddressCls::IpAddressCls() :
+            Bytes{},
+            Family(IpAddressFamily::V4)
+        {
+        }
+
+        IpAddressCls IpAddressCls::FromV4Bytes(const uint8_t* bytes)
+        {
+            IpAddressCls address;
+            memcpy(address.Bytes, bytes, 4);
+            return address;
+        }
+        IpAddressCls IpAddressCls::FromV6Bytes(const uint8_t* bytes)
+        {
+            IpAddressCls address;
+            memcpy(address.Bytes, bytes, 16);
+            address.Family = IpAddressFamily::V6;
+            return address;
+        }
+
+        StringError IpAddressCls::Parse(std::string_view str, IpAddressCls& out)
+        {
+            // IPv6 text always has a ':', IPv4 text never does
+            if (str.find(':') != std::string_view::npos)
+            {
+                return ParseV6(str, out);
+            }
+            return ParseV4(str, out);
+        }
+        StringError IpAddressCls::ParseV4(std::string_view str, IpAddressCls& out)
+        {
+            uint8_t bytes[4];
+            if (ParseDottedQuad(str, bytes) == false)
+            {
+                return StringError::InvalidArgument;
+            }
+            out = FromV4Bytes(bytes);
+            return StringError::Success;
+        }
+        StringError IpAddressCls::ParseV6(std::string_view str, IpAddressCls& out)
+        {
+            uint8_t bytes[16];
+            if (ParseIpv6Text(str, bytes) == false)
+            {
+                return StringError::InvalidArgument;
+            }
+            out = FromV6Bytes(bytes);
+            return StringError::Success;
+        }
+
+        IpAddressFamily IpAddressCls::GetFamily() const
+        {
+            return Family;
+        }
+        bool IpAddressCls::IsV4() const
+        {
+            return Family == IpAddressFamily::V4;
+        }
+        const uint8_t* IpAddressCls::GetBytes() const
+        {
+            return Bytes;
+        }
+        size_t IpAddressCls::GetByteCount() const
+        {
+            return Family == IpAddressFamily::V4 ? 4 : 16;
+        }
+
+        size_t IpAddressCls::Format(char* buffer) const
+        {
+            if (Family == IpAddressFamily::V4)
+            {
+                return FormatDottedQuad(Bytes, buffer);
+            }
+            return FormatIpv6Text(Bytes, buffer);
+        }
+        InlineStringCls<MAX_IP_ADDRESS_CHARS> IpAddressCls::ToString() const
+        {
+            InlineStringCls<MAX_IP_ADDRESS_CHARS> result;
+            result.resize(MAX_IP_ADDRESS_CHARS);
+            result.resize(Format(result.data()));
+            return result;
+        }
+
+        bool IpAddressCls::operator==(const IpAddressCls& other) const
+        {
+            // Unused bytes of IPv4 addresses are always zero
+            return Family == other.Family && memcmp(Bytes, other.Bytes, sizeof(Bytes)) == 0;
+        }
+    }
+}
@@ -0,0 +1,321 @@
+#include "KeywordMatcherCls.h"
+
+#include <algorithm>
+#include <bit>
+#include <queue>
+#include <stdexcept>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        KeywordMatcherCls::KeywordMatcherCls() :
+            ByteClass{},
+            AlphabetSize(1),
+            Transitions(1, 0),
+            StateKeyword(1, NONE),
+            DictionaryLink(1, NONE),
+            StateDepth(1, 0),
+            MaxKeywordLength(0)
+        {
+        }
+        KeywordMatcherCls::KeywordMatcherCls(const std::vector<std::string>& keywordList) :
+            ByteClass{},
+            AlphabetSize(1),
+            MaxKeywordLength(0)
+        {
+            Compile(keywordList);
+        }
+
+        void KeywordMatcherCls::Compile(const std::vector<std::string>& keywordList)
+        {
+            // Every byte that appears in a keyword gets its own column, all other bytes share column 0
+            for (const std::string& keyword : keywordList)
+            {
+                for (char ch : keyword)
+                {
+                    unsigned char value = static_cast<unsigned char>(ch);
+                    if (ByteClass[value] == 0)
+                    {
+                        ByteClass[value] = static_cast<uint16_t>(AlphabetSize++);
+                    }
+                }
+            }
+
+            // Keyword indexes are stored in 32 bits, NONE is reserved
+            if (keywordList.size() >= NONE)
+            {
+                throw std::length_error("KeywordMatcherCls: too many keywords");
+            }
+
+            // Root state
+            Transitions.assign(AlphabetSize, 0);
+            StateKeyword.assign(1, NONE);
+            StateDepth.assign(1, 0);
+            NextSameKeyword.assign(keywordList.size(), NONE);
+            KeywordLength.assign(keywordList.size(), 0);
+
+            // Build the trie, 0 means there is no edge since no edge can point back to the root
+            for (size_t i = 0; i < keywordList.size(); i++)
+            {
+                const std::string& keyword = keywordList[i];
+                uint32_t keywordIndex = static_cast<uint32_t>(i);
+                KeywordLength[i] = static_cast<uint32_t>(keyword.size());
+                MaxKeywordLength = std::max(MaxKeywordLength, keyword.size());
+
+                if (keyword.empty())
+                {
+                    EmptyKeywordList.push_back(keywordIndex);
+                    continue;
+                }
+
+                size_t row = 0;
+                for (char ch : keyword)
+                {
+                    size_t column = ByteClass[static_cast<unsigned char>(ch)];
+                    if (Transitions[row + column] == 0)
+                    {
+                        // Rows are stored in 31 bits, the top bit is OUTPUT_FLAG
+                        if (Transitions.size() + AlphabetSize > OUTPUT_FLAG)
+                        {
+                            throw std::length_error("KeywordMatcherCls: transition table exceeds 2^31 entries");
+                        }
+                        Transitions[row + column] = static_cast<uint32_t>(Transitions.size());
+                        Transitions.resize(Transitions.size() + AlphabetSize, 0);
+                        StateKeyword.push_back(NONE);
+                        StateDepth.push_back(StateDepth[row / AlphabetSize] + 1);
+                    }
+                    row = Transitions[row + column];
+                }
+
+                // Same keyword is given more than once, chain it after the previous one
+                uint32_t& stateKeyword = StateKeyword[row / AlphabetSize];
+                if (stateKeyword == NONE)
+                {
+                    stateKeyword = keywordIndex;
+                }
+                else
+                {
+                    uint32_t last = stateKeyword;
+                    while (NextSameKeyword[last] != NONE)
+                    {
+                        last = NextSameKeyword[last];
+                    }
+                    NextSameKeyword[last] = keywordIndex;
+                }
+            }
+
+            // Breadth first walk computes failure links and turns the trie into a full DFA
+            // Missing edges are replaced by the edge of the failure state
+            size_t stateCount = StateKeyword.size();
+            std::vector<uint32_t> failure(stateCount, 0);
+            DictionaryLink.assign(stateCount, NONE);
+
+            std::queue<uint32_t> stateQueue;
+            for (size_t column = 0; column < AlphabetSize; column++)
+            {
+                uint32_t child = Transitions[column];
+                if (child != 0)
+                {
+                    stateQueue.push(child / static_cast<uint32_t>(AlphabetSize));
+                }
+            }
+
+            while (stateQueue.empty() == false)
+            {
+                uint32_t state = stateQueue.front();
+                stateQueue.pop();
+
+                size_t row = static_cast<size_t>(state) * AlphabetSize;
+                size_t failureRow = static_cast<size_t>(failure[state]) * AlphabetSize;
+
+                for (size_t column = 0; column < AlphabetSize; column++)
+                {
+                    uint32_t child = Transitions[row + column];
+                    if (child == 0)
+                    {
+                        Transitions[row + column] = Transitions[failureRow + column];
+                        continue;
+                    }
+
+                    uint32_t childState = child / static_cast<uint32_t>(AlphabetSize);
+                    uint32_t childFailure = Transitions[failureRow + column] / static_cast<uint32_t>(AlphabetSize);
+                    failure[childState] = childFailure;
+                    DictionaryLink[childState] = StateKeyword[childFailure] != NONE ? childFailure : DictionaryLink[childFailure];
+                    stateQueue.push(childState);
+                }
+            }
+
+            // Mark transitions into states that report something
+            for (uint32_t& transition : Transitions)
+            {
+                uint32_t state = transition / static_cast<uint32_t>(AlphabetSize);
+                if (StateKeyword[state] != NONE || DictionaryLink[state] != NONE)
+                {
+                    transition |= OUTPUT_FLAG;
+                }
+            }
+        }
+
+        void KeywordMatcherCls::AddMatches(uint32_t state, size_t endOffset, std::vector<KeywordMatchStc>& matchList) const
+        {
+            if (StateKeyword[state] == NONE)
+            {
+                state = DictionaryLink[state];
+            }
+
+            while (state != NONE)
+            {
+                for (uint32_t keyword = StateKeyword[state]; keyword != NONE; keyword = NextSameKeyword[keyword])
+                {
+                    size_t length = KeywordLength[keyword];
+                    matchList.push_back({ endOffset - length, length, keyword });
+                }
+                state = DictionaryLink[state];
+            }
+        }
+
+        bool KeywordMatcherCls::IsMatch(std::string_view str) const
+        {
+            if (EmptyKeywordList.empty() == false)
+            {
+                return true;
+            }
+
+            const uint32_t* transitions = Transitions.data();
+            uint32_t row = 0;
+
+            for (char ch : str)
+            {
+                row = transitions[row + ByteClass[static_cast<unsigned char>(ch)]];
+                if ((row & OUTPUT_FLAG) != 0)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        std::vector<KeywordMatchStc> KeywordMatcherCls::FindAll(std::string_view str) const
+        {
+            std::vector<KeywordMatchStc> matchList;
+            const uint32_t* transitions = Transitions.data();
+            uint32_t row = 0;
+
+            for (uint32_t keyword : EmptyKeywordList)
+            {
+                matchList.push_back({ 0, 0, keyword });
+            }
+
+            for (size_t i = 0; i < str.size(); i++)
+            {
+                row = transitions[(row & ~OUTPUT_FLAG) + ByteClass[static_cast<unsigned char>(str[i])]];
+                if ((row & OUTPUT_FLAG) != 0)
+                {
+                    AddMatches((row & ~OUTPUT_FLAG) / static_cast<uint32_t>(AlphabetSize), i + 1, matchList);
+                }
+
+                for (uint32_t keyword : EmptyKeywordList)
+                {
+                    matchList.push_back({ i + 1, 0, keyword });
+                }
+            }
+
+            return matchList;
+        }
+
+        std::vector<KeywordMatchStc> KeywordMatcherCls::FindNonOverlapping(std::string_view str) const
+        {
+            std::vector<KeywordMatchStc> matchList;
+            if (MaxKeywordLength == 0)
+            {
+                return matchList;
+            }
+
+            // Best match per start offset for the offsets that can still get a longer match, indexed by offset & windowMask
+            // A match ending at i + 1 starts within the last StateDepth bytes, so at most MaxKeywordLength + 1 offsets are open
+            const size_t windowMask = std::bit_ceil(MaxKeywordLength + 1) - 1;
+            std::vector<KeywordMatchStc> window(windowMask + 1, KeywordMatchStc{ 0, 0, NONE });
+            size_t openCount = 0;
+
+            const uint32_t* transitions = Transitions.data();
+            uint32_t row = 0;
+            size_t closedOffset = 0;   // Every start offset below it is decided
+            size_t nextFreeOffset = 0; // End of the last taken match
+
+            // Start offsets below frontier cannot get another match, they are taken or dropped from left to right
+            auto closeUntil = [&](size_t frontier)
+            {
+                for (; closedOffset < frontier && openCount != 0; closedOffset++)
+                {
+                    KeywordMatchStc& best = window[closedOffset & windowMask];
+                    if (best.Length == 0)
+                    {
+                        continue;
+                    }
+                    if (closedOffset >= nextFreeOffset)
+                    {
+                        matchList.push_back(best);
+                        nextFreeOffset = best.Offset + best.Length;
+                    }
+                    best.Length = 0;
+                    openCount--;
+                }
+                closedOffset = std::max(closedOffset, frontier);
+            };
+
+            for (size_t i = 0; i < str.size(); i++)
+            {
+                row = transitions[(row & ~OUTPUT_FLAG) + ByteClass[static_cast<unsigned char>(str[i])]];
+                if ((row & OUTPUT_FLAG) == 0 && openCount == 0)
+                {
+                    continue;
+                }
+
+                uint32_t state = (row & ~OUTPUT_FLAG) / static_cast<uint32_t>(AlphabetSize);
+                if ((row & OUTPUT_FLAG) != 0)
+                {
+                    uint32_t outputState = StateKeyword[state] != NONE ? state : DictionaryLink[state];
+                    for (; outputState != NONE; outputState = DictionaryLink[outputState])
+                    {
+                        // Duplicates are chained after the first keyword, which wins the tie
+                        uint32_t keyword = StateKeyword[outputState];
+                        size_t length = KeywordLength[keyword];
+                        size_t offset = i + 1 - length;
+                        if (offset < nextFreeOffset)
+                        {
+                            continue;
+                        }
+
+                        // Longer keywords come first in the chain, so a filled slot only changes for a longer match from a later end
+                        KeywordMatchStc& best = window[offset & windowMask];
+                        if (best.Length == 0)
+                        {
+                            // Offsets are only walked while something is open, nothing below the current frontier needs a visit
+                            if (openCount++ == 0)
+                            {
+                                closedOffset = std::max(closedOffset, i + 1 - StateDepth[state]);
+                            }
+                            best = { offset, length, keyword };
+                        }
+                        else if (length > best.Length)
+                        {
+                            best = { offset, length, keyword };
+                        }
+                    }
+                }
+
+                closeUntil(i + 1 - StateDepth[state]);
+            }
+            closeUntil(str.size());
+
+            return matchList;
+        }
+
+        size_t KeywordMatcherCls::GetKeywordCount() const
+        {
+            return KeywordLength.size();
+        }
+    }
+}
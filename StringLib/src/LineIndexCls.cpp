@@ -0,0 +1,163 @@
+#include "LineIndexCls.h"
+#include "ScanPkg.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Bytes whose bitmap is built at once, the bitmap stays on the stack
+        static constexpr size_t BITMAP_BLOCK_SIZE = 16 * 1024;
+
+        // Appends the absolute offset of every '\n' in [first, last) to endList
+        // Newlines of a block are counted from the bitmap first, so the list grows once per block and offsets are written without checks
+        template <typename OffsetT>
+        static void IndexNewlines(const char* data, size_t first, size_t last, std::vector<OffsetT>& endList)
+        {
+            uint64_t bitmap[BITMAP_BLOCK_SIZE / 64];
+
+            for (size_t blockStart = first; blockStart < last; blockStart += BITMAP_BLOCK_SIZE)
+            {
+                size_t blockEnd = std::min(last, blockStart + BITMAP_BLOCK_SIZE);
+                size_t wordCount = (blockEnd - blockStart + 63) / 64;
+                BuildByteBitmap(data + blockStart, data + blockEnd, '\n', bitmap);
+
+                size_t count = 0;
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    count += static_cast<size_t>(std::popcount(bitmap[i]));
+                }
+                if (count == 0)
+                {
+                    continue;
+                }
+
+                size_t oldSize = endList.size();
+                endList.resize(oldSize + count);
+                OffsetT* out = endList.data() + oldSize;
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    uint64_t mask = bitmap[i];
+                    size_t wordOffset = blockStart + 64 * i;
+                    while (mask != 0)
+                    {
+                        *out++ = static_cast<OffsetT>(wordOffset + static_cast<size_t>(std::countr_zero(mask)));
+                        mask &= mask - 1;
+                    }
+                }
+            }
+        }
+
+        template <typename OffsetT>
+            requires std::same_as<OffsetT, uint32_t> || std::same_as<OffsetT, uint64_t>
+        LineIndexCls<OffsetT>::LineIndexCls()
+        {
+        }
+
+        template <typename OffsetT>
+            requires std::same_as<OffsetT, uint32_t> || std::same_as<OffsetT, uint64_t>
+        StringError LineIndexCls<OffsetT>::Build(std::string_view buffer)
+        {
+            return Build(buffer, ParallelOptionStc{ 1, 0 });
+        }
+
+        template <typename OffsetT>
+            requires std::same_as<OffsetT, uint32_t> || std::same_as<OffsetT, uint64_t>
+        StringError LineIndexCls<OffsetT>::Build(std::string_view buffer, const ParallelOptionStc& option)
+        {
+            Source = std::string_view();
+            EndList.clear();
+
+            if (buffer.size() > std::numeric_limits<OffsetT>::max())
+            {
+                return StringError::OutOfRange;
+            }
+
+            const ParallelOptionStc chunkOption = { option.ThreadCount, option.ChunkSize == 0 ? LINE_INDEX_CHUNK_SIZE : option.ChunkSize };
+            const size_t chunkCount = GetChunkCount(buffer.size(), chunkOption);
+            std::vector<std::vector<OffsetT>> chunkEndList(chunkCount);
+
+            ForEachChunk(buffer.size(), chunkOption, [&](size_t chunk, size_t first, size_t last)
+            {
+                IndexNewlines(buffer.data(), first, last, chunkEndList[chunk]);
+            });
+
+            // Chunk results are copied after each other, position of every chunk comes from a prefix sum of their sizes
+            std::vector<size_t> positionList(chunkCount + 1, 0);
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+            {
+                positionList[chunk + 1] = positionList[chunk] + chunkEndList[chunk].size();
+            }
+
+            const bool isLastLineOpen = buffer.empty() == false && buffer.back() != '\n';
+            EndList.resize(positionList.back() + (isLastLineOpen ? 1 : 0));
+
+            ForEachChunk(chunkCount, ParallelOptionStc{ option.ThreadCount, 1 }, [&](size_t chunk, size_t, size_t)
+            {
+                std::copy(chunkEndList[chunk].begin(), chunkEndList[chunk].end(), EndList.begin() + static_cast<std::ptrdiff_t>(positionList[chunk]));
+                std::vector<OffsetT>().swap(chunkEndList[chunk]);
+            });
+
+            if (isLastLineOpen)
+            {
+                EndList.back() = static_cast<OffsetT>(buffer.size());
+            }
+
+            Source = buffer;
+            return StringError::Success;
+        }
+
+        template <typename OffsetT>
+            requires std::same_as<OffsetT, uint32_t> || std::same_as<OffsetT, uint64_t>
+        size_t LineIndexCls<OffsetT>::GetLineCount() const
+        {
+            return EndList.size();
+        }
+
+        template <typename OffsetT>
+            requires std::same_as<OffsetT, uint32_t> || std::same_as<OffsetT, uint64_t>
+        std::string_view LineIndexCls<OffsetT>::GetLine(size_t index) const
+        {
+            size_t offset = GetLineOffset(index);
+            return Source.substr(offset, static_cast<size_t>(EndList[index]) - offset);
+        }
+
+        template <typename OffsetT>
+            requires std::same_as<OffsetT, uint32_t> || std::same_as<OffsetT, uint64_t>
+        size_t LineIndexCls<OffsetT>::GetLineOffset(size_t index) const
+        {
+            return index == 0 ? 0 : static_cast<size_t>(EndList[index - 1]) + 1;
+        }
+
+        template <typename OffsetT>
+            requires std::same_as<OffsetT, uint32_t> || std::same_as<OffsetT, uint64_t>
+        size_t LineIndexCls<OffsetT>::FindLine(size_t offset) const
+        {
+            if (offset >= Source.size())
+            {
+                return EndList.size();
+            }
+
+            // First line whose end is at or after the offset
+            auto line = std::lower_bound(EndList.begin(), EndList.end(), offset, [](OffsetT end, size_t value)
+            {
+                return static_cast<size_t>(end) < value;
+            });
+            return static_cast<size_t>(line - EndList.begin());
+        }
+
+        template <typename OffsetT>
+            requires std::same_as<OffsetT, uint32_t> || std::same_as<OffsetT, uint64_t>
+        const std::vector<OffsetT>& LineIndexCls<OffsetT>::GetEndList() const
+        {
+            return EndList;
+        }
+
+        template class LineIndexCls<uint32_t>;
+        template class LineIndexCls<uint64_t>;
+    }
+}
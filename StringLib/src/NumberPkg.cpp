@@ -0,0 +1,48 @@
+#include "NumberPkg.h"
+
+#include <charconv>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Without a precision argument std::to_chars produces the shortest round trip representation
+        template<typename T>
+        static size_t FormatFloatingImpl(T value, char* first, char* last)
+        {
+            std::to_chars_result result = std::to_chars(first, last, value);
+            if (result.ec != std::errc())
+            {
+                return 0;
+            }
+            return static_cast<size_t>(result.ptr - first);
+        }
+
+        size_t FormatFloating(float value, char* out)
+        {
+            return FormatFloatingImpl(value, out, out + MAX_FLOATING_CHARS);
+        }
+        size_t FormatFloating(double value, char* out)
+        {
+            return FormatFloatingImpl(value, out, out + MAX_FLOATING_CHARS);
+        }
+        size_t FormatFloating(float value, std::span<char> out)
+        {
+            return FormatFloatingImpl(value, out.data(), out.data() + out.size());
+        }
+        size_t FormatFloating(double value, std::span<char> out)
+        {
+            return FormatFloatingImpl(value, out.data(), out.data() + out.size());
+        }
+        void AppendFloating(float value, std::string& out)
+        {
+            char buffer[MAX_FLOATING_CHARS];
+            out.append(buffer, FormatFloating(value, buffer));
+        }
+        void AppendFloating(double value, std::string& out)
+        {
+            char buffer[MAX_FLOATING_CHARS];
+            out.append(buffer, FormatFloating(value, buffer));
+        }
+    }
+}
@@ -0,0 +1,215 @@
+#include "ParallelPkg.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        static size_t GetChunkSize(const ParallelOptionStc& option)
+        {
+            return option.ChunkSize == 0 ? DEFAULT_CHUNK_SIZE : option.ChunkSize;
+        }
+
+        size_t GetChunkCount(size_t size, const ParallelOptionStc& option)
+        {
+            size_t chunkSize = GetChunkSize(option);
+            return (size + chunkSize - 1) / chunkSize;
+        }
+
+        void ForEachChunk(size_t size, const ParallelOptionStc& option, const std::function<void(size_t, size_t, size_t)>& func)
+        {
+            const size_t chunkSize = GetChunkSize(option);
+            const size_t chunkCount = GetChunkCount(size, option);
+
+            size_t threadCount = option.ThreadCount;
+            if (threadCount == 0)
+            {
+                threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            }
+            threadCount = std::min(threadCount, chunkCount);
+
+            if (threadCount <= 1)
+            {
+                for (size_t chunk = 0; chunk < chunkCount; chunk++)
+                {
+                    func(chunk, chunk * chunkSize, std::min(size, (chunk + 1) * chunkSize));
+                }
+                return;
+            }
+
+            std::atomic<size_t> nextChunk = 0;
+            std::mutex errorMutex;
+            std::exception_ptr error;
+
+            auto runChunks = [&]()
+            {
+                try
+                {
+                    size_t chunk;
+                    while ((chunk = nextChunk.fetch_add(1, std::memory_order_relaxed)) < chunkCount)
+                    {
+                        func(chunk, chunk * chunkSize, std::min(size, (chunk + 1) * chunkSize));
+                    }
+                }
+                catch (...)
+                {
+                    // Other threads stop after their current chunk
+                    nextChunk.store(chunkCount, std::memory_order_relaxed);
+
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (error == nullptr)
+                    {
+                        error = std::current_exception();
+                    }
+                }
+            };
+
+            std::vector<std::thread> threadList;
+            threadList.reserve(threadCount - 1);
+            for (size_t i = 1; i < threadCount; i++)
+            {
+                threadList.emplace_back(runChunks);
+            }
+            runChunks();
+            for (std::thread& thread : threadList)
+            {
+                thread.join();
+            }
+
+            if (error != nullptr)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // Every chunk copies the strings it keeps into its own vector, the vectors are moved into the result in chunk order
+        // Chunk vectors are reserved for the whole chunk, growing them costs more than the unused std::string slots
+        template <typename PredicateT>
+        static std::vector<std::string> FilterChunks(const std::vector<std::string>& strList, PredicateT isKept, const ParallelOptionStc& option)
+        {
+            std::vector<std::vector<std::string>> chunkResultList(GetChunkCount(strList.size(), option));
+
+            ForEachChunk(strList.size(), option, [&](size_t chunk, size_t first, size_t last)
+            {
+                std::vector<std::string>& chunkResult = chunkResultList[chunk];
+                chunkResult.reserve(last - first);
+                for (size_t i = first; i < last; i++)
+                {
+                    if (isKept(strList[i]))
+                    {
+                        chunkResult.push_back(strList[i]);
+                    }
+                }
+            });
+
+            size_t total = 0;
+            for (const std::vector<std::string>& chunkResult : chunkResultList)
+            {
+                total += chunkResult.size();
+            }
+
+            std::vector<std::string> filteredList;
+            filteredList.reserve(total);
+            for (std::vector<std::string>& chunkResult : chunkResultList)
+            {
+                filteredList.insert(filteredList.end(), std::make_move_iterator(chunkResult.begin()), std::make_move_iterator(chunkResult.end()));
+            }
+
+            return filteredList;
+        }
+
+        template <typename PredicateT>
+        static size_t CountChunks(const std::vector<std::string>& strList, PredicateT isCounted, const ParallelOptionStc& option)
+        {
+            std::vector<size_t> countList(GetChunkCount(strList.size(), option), 0);
+
+            ForEachChunk(strList.size(), option, [&](size_t chunk, size_t first, size_t last)
+            {
+                size_t count = 0;
+                for (size_t i = first; i < last; i++)
+                {
+                    count += isCounted(strList[i]) ? 1 : 0;
+                }
+                countList[chunk] = count;
+            });
+
+            size_t total = 0;
+            for (size_t count : countList)
+            {
+                total += count;
+            }
+            return total;
+        }
+
+        std::vector<std::string> Filter(const std::vector<std::string>& strList, const std::string& keyword, const ParallelOptionStc& option)
+        {
+            return FilterChunks(strList, [&](const std::string& str) { return str.find(keyword) == std::string::npos; }, option);
+        }
+        std::vector<std::string> Filter(const std::vector<std::string>& strList, const KeywordMatcherCls& matcher, const ParallelOptionStc& option)
+        {
+            return FilterChunks(strList, [&](const std::string& str) { return matcher.IsMatch(str) == false; }, option);
+        }
+
+        size_t Count(const std::vector<std::string>& strList, const std::string& keyword, const ParallelOptionStc& option)
+        {
+            return CountChunks(strList, [&](const std::string& str) { return str.find(keyword) != std::string::npos; }, option);
+        }
+        size_t Count(const std::vector<std::string>& strList, const KeywordMatcherCls& matcher, const ParallelOptionStc& option)
+        {
+            return CountChunks(strList, [&](const std::string& str) { return matcher.IsMatch(str); }, option);
+        }
+
+        std::string Join(const std::vector<std::string>& stringList, const std::string& delimiter, const ParallelOptionStc& option)
+        {
+            const size_t size = stringList.size();
+            if (size == 0)
+            {
+                return std::string();
+            }
+
+            // Every string except the first one is preceded by the delimiter
+            std::vector<size_t> offsetList(GetChunkCount(size, option) + 1, 0);
+            ForEachChunk(size, option, [&](size_t chunk, size_t first, size_t last)
+            {
+                size_t length = 0;
+                for (size_t i = first; i < last; i++)
+                {
+                    length += stringList[i].size();
+                }
+                offsetList[chunk + 1] = length + (last - first) * delimiter.size();
+            });
+
+            for (size_t chunk = 1; chunk < offsetList.size(); chunk++)
+            {
+                offsetList[chunk] += offsetList[chunk - 1];
+            }
+
+            std::string result(offsetList.back() - delimiter.size(), '\0');
+            char* data = result.data();
+            ForEachChunk(size, option, [&](size_t chunk, size_t first, size_t last)
+            {
+                // First chunk has no delimiter in front of its first string, the others start right after one
+                char* out = data + (chunk == 0 ? 0 : offsetList[chunk] - delimiter.size());
+                for (size_t i = first; i < last; i++)
+                {
+                    if (i != 0)
+                    {
+                        std::memcpy(out, delimiter.data(), delimiter.size());
+                        out += delimiter.size();
+                    }
+                    std::memcpy(out, stringList[i].data(), stringList[i].size());
+                    out += stringList[i].size();
+                }
+            });
+
+            return result;
+        }
+    }
+}
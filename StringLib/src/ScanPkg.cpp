@@ -0,0 +1,623 @@
+#include "ScanPkg.h"
+#include "CpuFeaturePkg.h"
+
+#include <bit>
+#include <cstring>
+
+#if defined(UTILITYLIB_X86)
+#include <immintrin.h>
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Scalar kernels
+        // Used on non x86 targets, for sets that cannot be described as ranges, and for short tails
+
+        static const char* FindByteScalar(const char* first, const char* last, char ch)
+        {
+            if (first == last)
+            {
+                return last;
+            }
+
+            const void* found = memchr(first, ch, static_cast<size_t>(last - first));
+            return found != nullptr ? static_cast<const char*>(found) : last;
+        }
+        static size_t CountByteScalar(const char* first, const char* last, char ch)
+        {
+            size_t count = 0;
+            for (; first != last; first++)
+            {
+                count += (*first == ch) ? 1 : 0;
+            }
+            return count;
+        }
+        template<bool Negate>
+        static const char* FindFirstInSetScalar(const char* first, const char* last, const ByteSetCls& set)
+        {
+            for (; first != last; first++)
+            {
+                if (set.Contains(*first) != Negate)
+                {
+                    return first;
+                }
+            }
+            return last;
+        }
+        // Returns nullptr when nothing is found
+        template<bool Negate>
+        static const char* FindLastInSetScalar(const char* first, const char* last, const ByteSetCls& set)
+        {
+            while (last != first)
+            {
+                last--;
+                if (set.Contains(*last) != Negate)
+                {
+                    return last;
+                }
+            }
+            return nullptr;
+        }
+
+        static void BuildByteBitmapScalar(const char* first, const char* last, char ch, uint64_t* bitmap)
+        {
+            while (first != last)
+            {
+                size_t count = static_cast<size_t>(last - first) < 64 ? static_cast<size_t>(last - first) : 64;
+                uint64_t mask = 0;
+                for (size_t i = 0; i < count; i++)
+                {
+                    mask |= static_cast<uint64_t>(first[i] == ch) << i;
+                }
+                *bitmap++ = mask;
+                first += count;
+            }
+        }
+
+        // Writes the bits of [first, last) from bit 0 of *bitmap, bits after last are cleared
+        static void BuildSetBitmapScalar(const char* first, const char* last, const ByteSetCls& set, uint64_t* bitmap)
+        {
+            while (first != last)
+            {
+                size_t count = static_cast<size_t>(last - first) < 64 ? static_cast<size_t>(last - first) : 64;
+                uint64_t mask = 0;
+                for (size_t i = 0; i < count; i++)
+                {
+                    mask |= static_cast<uint64_t>(set.Contains(first[i])) << i;
+                }
+                *bitmap++ = mask;
+                first += count;
+            }
+        }
+
+#if defined(UTILITYLIB_X86)
+        // SSE2 kernels
+
+        struct SetVectorsSse2Stc
+        {
+            __m128i Low[ByteSetCls::MAX_RANGE_COUNT];
+            __m128i Width[ByteSetCls::MAX_RANGE_COUNT];
+            size_t Count;
+        };
+
+        UTILITYLIB_TARGET("sse2")
+        static void PrepareSetSse2(const ByteSetCls& set, SetVectorsSse2Stc& vectors)
+        {
+            vectors.Count = set.GetRangeCount();
+            for (size_t i = 0; i < vectors.Count; i++)
+            {
+                vectors.Low[i] = _mm_set1_epi8(static_cast<char>(set.GetRangeLow(i)));
+                vectors.Width[i] = _mm_set1_epi8(static_cast<char>(set.GetRangeHigh(i) - set.GetRangeLow(i)));
+            }
+        }
+        // Byte is in [low, high] when (byte - low) <= (high - low) as unsigned values
+        UTILITYLIB_TARGET("sse2")
+        static uint32_t SetMaskSse2(__m128i block, const SetVectorsSse2Stc& vectors)
+        {
+            __m128i match = _mm_setzero_si128();
+            for (size_t i = 0; i < vectors.Count; i++)
+            {
+                __m128i shifted = _mm_sub_epi8(block, vectors.Low[i]);
+                match = _mm_or_si128(match, _mm_cmpeq_epi8(_mm_min_epu8(shifted, vectors.Width[i]), shifted));
+            }
+            return static_cast<uint32_t>(_mm_movemask_epi8(match));
+        }
+        UTILITYLIB_TARGET("sse2")
+        static const char* FindByteSse2(const char* first, const char* last, char ch)
+        {
+            const __m128i needle = _mm_set1_epi8(ch);
+
+            for (; last - first >= 16; first += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+                if (mask != 0)
+                {
+                    return first + std::countr_zero(mask);
+                }
+            }
+
+            return FindByteScalar(first, last, ch);
+        }
+        UTILITYLIB_TARGET("sse2")
+        static size_t CountByteSse2(const char* first, const char* last, char ch)
+        {
+            const __m128i needle = _mm_set1_epi8(ch);
+            size_t count = 0;
+
+            for (; last - first >= 16; first += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                count += std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle))));
+            }
+
+            return count + CountByteScalar(first, last, ch);
+        }
+        UTILITYLIB_TARGET("sse2")
+        static void BuildByteBitmapSse2(const char* first, const char* last, char ch, uint64_t* bitmap)
+        {
+            const __m128i needle = _mm_set1_epi8(ch);
+
+            for (; last - first >= 64; first += 64)
+            {
+                uint64_t mask0 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), needle)));
+                uint64_t mask1 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 16)), needle)));
+                uint64_t mask2 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 32)), needle)));
+                uint64_t mask3 = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 48)), needle)));
+                *bitmap++ = mask0 | (mask1 << 16) | (mask2 << 32) | (mask3 << 48);
+            }
+
+            BuildByteBitmapScalar(first, last, ch, bitmap);
+        }
+        template<bool Negate>
+        UTILITYLIB_TARGET("sse2")
+        static const char* FindFirstInSetSse2(const char* first, const char* last, const ByteSetCls& set)
+        {
+            SetVectorsSse2Stc vectors;
+            PrepareSetSse2(set, vectors);
+
+            for (; last - first >= 16; first += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                uint32_t mask = SetMaskSse2(block, vectors);
+                if (Negate)
+                {
+                    mask ^= 0xFFFF;
+                }
+                if (mask != 0)
+                {
+                    return first + std::countr_zero(mask);
+                }
+            }
+
+            return FindFirstInSetScalar<Negate>(first, last, set);
+        }
+        template<bool Negate>
+        UTILITYLIB_TARGET("sse2")
+        static const char* FindLastInSetSse2(const char* first, const char* last, const ByteSetCls& set)
+        {
+            SetVectorsSse2Stc vectors;
+            PrepareSetSse2(set, vectors);
+
+            for (; last - first >= 16; last -= 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(last - 16));
+                uint32_t mask = SetMaskSse2(block, vectors);
+                if (Negate)
+                {
+                    mask ^= 0xFFFF;
+                }
+                if (mask != 0)
+                {
+                    return last - 16 + (31 - std::countl_zero(mask));
+                }
+            }
+
+            return FindLastInSetScalar<Negate>(first, last, set);
+        }
+
+        UTILITYLIB_TARGET("sse2")
+        static void BuildSetBitmapSse2(const char* first, const char* last, const ByteSetCls& set, uint64_t* bitmap)
+        {
+            SetVectorsSse2Stc vectors;
+            PrepareSetSse2(set, vectors);
+
+            for (; last - first >= 64; first += 64)
+            {
+                uint64_t mask0 = SetMaskSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), vectors);
+                uint64_t mask1 = SetMaskSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 16)), vectors);
+                uint64_t mask2 = SetMaskSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 32)), vectors);
+                uint64_t mask3 = SetMaskSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 48)), vectors);
+                *bitmap++ = mask0 | (mask1 << 16) | (mask2 << 32) | (mask3 << 48);
+            }
+
+            BuildSetBitmapScalar(first, last, set, bitmap);
+        }
+
+        // AVX2 kernels
+
+        struct SetVectorsAvx2Stc
+        {
+            __m256i Low[ByteSetCls::MAX_RANGE_COUNT];
+            __m256i Width[ByteSetCls::MAX_RANGE_COUNT];
+            size_t Count;
+        };
+
+        UTILITYLIB_TARGET("avx2")
+        static void PrepareSetAvx2(const ByteSetCls& set, SetVectorsAvx2Stc& vectors)
+        {
+            vectors.Count = set.GetRangeCount();
+            for (size_t i = 0; i < vectors.Count; i++)
+            {
+                vectors.Low[i] = _mm256_set1_epi8(static_cast<char>(set.GetRangeLow(i)));
+                vectors.Width[i] = _mm256_set1_epi8(static_cast<char>(set.GetRangeHigh(i) - set.GetRangeLow(i)));
+            }
+        }
+        UTILITYLIB_TARGET("avx2")
+        static uint32_t SetMaskAvx2(__m256i block, const SetVectorsAvx2Stc& vectors)
+        {
+            __m256i match = _mm256_setzero_si256();
+            for (size_t i = 0; i < vectors.Count; i++)
+            {
+                __m256i shifted = _mm256_sub_epi8(block, vectors.Low[i]);
+                match = _mm256_or_si256(match, _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, vectors.Width[i]), shifted));
+            }
+            return static_cast<uint32_t>(_mm256_movemask_epi8(match));
+        }
+        UTILITYLIB_TARGET("avx2")
+        static const char* FindByteAvx2(const char* first, const char* last, char ch)
+        {
+            const __m256i needle = _mm256_set1_epi8(ch);
+
+            for (; last - first >= 32; first += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+                uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+                if (mask != 0)
+                {
+                    return first + std::countr_zero(mask);
+                }
+            }
+
+            return FindByteSse2(first, last, ch);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static size_t CountByteAvx2(const char* first, const char* last, char ch)
+        {
+            const __m256i needle = _mm256_set1_epi8(ch);
+            size_t count = 0;
+
+            for (; last - first >= 32; first += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+                count += std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle))));
+            }
+
+            return count + CountByteSse2(first, last, ch);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static void BuildByteBitmapAvx2(const char* first, const char* last, char ch, uint64_t* bitmap)
+        {
+            const __m256i needle = _mm256_set1_epi8(ch);
+
+            for (; last - first >= 64; first += 64)
+            {
+                uint64_t low = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), needle)));
+                uint64_t high = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + 32)), needle)));
+                *bitmap++ = low | (high << 32);
+            }
+
+            BuildByteBitmapScalar(first, last, ch, bitmap);
+        }
+        template<bool Negate>
+        UTILITYLIB_TARGET("avx2")
+        static const char* FindFirstInSetAvx2(const char* first, const char* last, const ByteSetCls& set)
+        {
+            SetVectorsAvx2Stc vectors;
+            PrepareSetAvx2(set, vectors);
+
+            for (; last - first >= 32; first += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+                uint32_t mask = SetMaskAvx2(block, vectors);
+                if (Negate)
+                {
+                    mask = ~mask;
+                }
+                if (mask != 0)
+                {
+                    return first + std::countr_zero(mask);
+                }
+            }
+
+            return FindFirstInSetSse2<Negate>(first, last, set);
+        }
+        template<bool Negate>
+        UTILITYLIB_TARGET("avx2")
+        static const char* FindLastInSetAvx2(const char* first, const char* last, const ByteSetCls& set)
+        {
+            SetVectorsAvx2Stc vectors;
+            PrepareSetAvx2(set, vectors);
+
+            for (; last - first >= 32; last -= 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(last - 32));
+                uint32_t mask = SetMaskAvx2(block, vectors);
+                if (Negate)
+                {
+                    mask = ~mask;
+                }
+                if (mask != 0)
+                {
+                    return last - 32 + (31 - std::countl_zero(mask));
+                }
+            }
+
+            return FindLastInSetSse2<Negate>(first, last, set);
+        }
+
+        UTILITYLIB_TARGET("avx2")
+        static void BuildSetBitmapAvx2(const char* first, const char* last, const ByteSetCls& set, uint64_t* bitmap)
+        {
+            SetVectorsAvx2Stc vectors;
+            PrepareSetAvx2(set, vectors);
+
+            for (; last - first >= 64; first += 64)
+            {
+                uint64_t low = SetMaskAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), vectors);
+                uint64_t high = SetMaskAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + 32)), vectors);
+                *bitmap++ = low | (high << 32);
+            }
+
+            BuildSetBitmapScalar(first, last, set, bitmap);
+        }
+
+        // AVX-512BW kernels
+        // Tails are handled with masked loads, masked out bytes are never read so they cannot fault
+
+        struct SetVectorsAvx512Stc
+        {
+            __m512i Low[ByteSetCls::MAX_RANGE_COUNT];
+            __m512i Width[ByteSetCls::MAX_RANGE_COUNT];
+            size_t Count;
+        };
+
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static uint64_t TailMaskAvx512(size_t size)
+        {
+            return size >= 64 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << size) - 1;
+        }
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static void PrepareSetAvx512(const ByteSetCls& set, SetVectorsAvx512Stc& vectors)
+        {
+            vectors.Count = set.GetRangeCount();
+            for (size_t i = 0; i < vectors.Count; i++)
+            {
+                vectors.Low[i] = _mm512_set1_epi8(static_cast<char>(set.GetRangeLow(i)));
+                vectors.Width[i] = _mm512_set1_epi8(static_cast<char>(set.GetRangeHigh(i) - set.GetRangeLow(i)));
+            }
+        }
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static uint64_t SetMaskAvx512(__m512i block, const SetVectorsAvx512Stc& vectors)
+        {
+            __mmask64 match = 0;
+            for (size_t i = 0; i < vectors.Count; i++)
+            {
+                __m512i shifted = _mm512_sub_epi8(block, vectors.Low[i]);
+                match |= _mm512_cmple_epu8_mask(shifted, vectors.Width[i]);
+            }
+            return static_cast<uint64_t>(match);
+        }
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static const char* FindByteAvx512(const char* first, const char* last, char ch)
+        {
+            const __m512i needle = _mm512_set1_epi8(ch);
+
+            while (first < last)
+            {
+                uint64_t valid = TailMaskAvx512(static_cast<size_t>(last - first));
+                __m512i block = _mm512_maskz_loadu_epi8(valid, first);
+                uint64_t mask = _mm512_cmpeq_epi8_mask(block, needle) & valid;
+                if (mask != 0)
+                {
+                    return first + std::countr_zero(mask);
+                }
+                first += 64;
+            }
+
+            return last;
+        }
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static size_t CountByteAvx512(const char* first, const char* last, char ch)
+        {
+            const __m512i needle = _mm512_set1_epi8(ch);
+            size_t count = 0;
+
+            while (first < last)
+            {
+                uint64_t valid = TailMaskAvx512(static_cast<size_t>(last - first));
+                __m512i block = _mm512_maskz_loadu_epi8(valid, first);
+                count += std::popcount(_mm512_cmpeq_epi8_mask(block, needle) & valid);
+                first += 64;
+            }
+
+            return count;
+        }
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static void BuildByteBitmapAvx512(const char* first, const char* last, char ch, uint64_t* bitmap)
+        {
+            const __m512i needle = _mm512_set1_epi8(ch);
+
+            while (first < last)
+            {
+                uint64_t valid = TailMaskAvx512(static_cast<size_t>(last - first));
+                __m512i block = _mm512_maskz_loadu_epi8(valid, first);
+                *bitmap++ = _mm512_cmpeq_epi8_mask(block, needle) & valid;
+                first += 64;
+            }
+        }
+        template<bool Negate>
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static const char* FindFirstInSetAvx512(const char* first, const char* last, const ByteSetCls& set)
+        {
+            SetVectorsAvx512Stc vectors;
+            PrepareSetAvx512(set, vectors);
+
+            while (first < last)
+            {
+                uint64_t valid = TailMaskAvx512(static_cast<size_t>(last - first));
+                __m512i block = _mm512_maskz_loadu_epi8(valid, first);
+                uint64_t mask = SetMaskAvx512(block, vectors);
+                if (Negate)
+                {
+                    mask = ~mask;
+                }
+                mask &= valid;
+                if (mask != 0)
+                {
+                    return first + std::countr_zero(mask);
+                }
+                first += 64;
+            }
+
+            return last;
+        }
+        template<bool Negate>
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static const char* FindLastInSetAvx512(const char* first, const char* last, const ByteSetCls& set)
+        {
+            SetVectorsAvx512Stc vectors;
+            PrepareSetAvx512(set, vectors);
+
+            for (; last - first >= 64; last -= 64)
+            {
+                __m512i block = _mm512_loadu_si512(last - 64);
+                uint64_t mask = SetMaskAvx512(block, vectors);
+                if (Negate)
+                {
+                    mask = ~mask;
+                }
+                if (mask != 0)
+                {
+                    return last - 64 + (63 - std::countl_zero(mask));
+                }
+            }
+
+            return FindLastInSetAvx2<Negate>(first, last, set);
+        }
+
+        UTILITYLIB_TARGET("avx512f,avx512bw")
+        static void BuildSetBitmapAvx512(const char* first, const char* last, const ByteSetCls& set, uint64_t* bitmap)
+        {
+            SetVectorsAvx512Stc vectors;
+            PrepareSetAvx512(set, vectors);
+
+            while (first < last)
+            {
+                uint64_t valid = TailMaskAvx512(static_cast<size_t>(last - first));
+                __m512i block = _mm512_maskz_loadu_epi8(valid, first);
+                *bitmap++ = SetMaskAvx512(block, vectors) & valid;
+                first += 64;
+            }
+        }
+#endif
+
+        // Kernel table, selected once according to the CPU
+        struct ScanKernelStc
+        {
+            const char* (*FindByte)(const char*, const char*, char);
+            size_t (*CountByte)(const char*, const char*, char);
+            const char* (*FindFirstOf)(const char*, const char*, const ByteSetCls&);
+            const char* (*FindFirstNotOf)(const char*, const char*, const ByteSetCls&);
+            const char* (*FindLastNotOf)(const char*, const char*, const ByteSetCls&);
+            void (*BuildSetBitmap)(const char*, const char*, const ByteSetCls&, uint64_t*);
+            void (*BuildByteBitmap)(const char*, const char*, char, uint64_t*);
+        };
+
+        static ScanKernelStc SelectKernels()
+        {
+            switch (GetSimdLevel())
+            {
+#if defined(UTILITYLIB_X86)
+                case SimdLevel::Avx512Bw:
+                {
+                    return { FindByteAvx512, CountByteAvx512, FindFirstInSetAvx512<false>, FindFirstInSetAvx512<true>, FindLastInSetAvx512<true>, BuildSetBitmapAvx512, BuildByteBitmapAvx512 };
+                }
+                case SimdLevel::Avx2:
+                {
+                    return { FindByteAvx2, CountByteAvx2, FindFirstInSetAvx2<false>, FindFirstInSetAvx2<true>, FindLastInSetAvx2<true>, BuildSetBitmapAvx2, BuildByteBitmapAvx2 };
+                }
+                case SimdLevel::Sse2:
+                {
+                    return { FindByteSse2, CountByteSse2, FindFirstInSetSse2<false>, FindFirstInSetSse2<true>, FindLastInSetSse2<true>, BuildSetBitmapSse2, BuildByteBitmapSse2 };
+                }
+#endif
+                default:
+                {
+                    return { FindByteScalar, CountByteScalar, FindFirstInSetScalar<false>, FindFirstInSetScalar<true>, FindLastInSetScalar<true>, BuildSetBitmapScalar, BuildByteBitmapScalar };
+                }
+            }
+        }
+        static const ScanKernelStc& GetKernels()
+        {
+            static const ScanKernelStc kernels = SelectKernels();
+            return kernels;
+        }
+
+        const char* FindByte(const char* first, const char* last, char ch)
+        {
+            return GetKernels().FindByte(first, last, ch);
+        }
+        size_t CountByte(const char* first, const char* last, char ch)
+        {
+            return GetKernels().CountByte(first, last, ch);
+        }
+        const char* FindFirstOf(const char* first, const char* last, const ByteSetCls& set)
+        {
+            if (set.HasCompleteRangeList() == false)
+            {
+                return FindFirstInSetScalar<false>(first, last, set);
+            }
+            return GetKernels().FindFirstOf(first, last, set);
+        }
+        const char* FindFirstNotOf(const char* first, const char* last, const ByteSetCls& set)
+        {
+            if (set.HasCompleteRangeList() == false)
+            {
+                return FindFirstInSetScalar<true>(first, last, set);
+            }
+            return GetKernels().FindFirstNotOf(first, last, set);
+        }
+        const char* FindLastNotOf(const char* first, const char* last, const ByteSetCls& set)
+        {
+            const char* found = nullptr;
+
+            if (set.HasCompleteRangeList() == false)
+            {
+                found = FindLastInSetScalar<true>(first, last, set);
+            }
+            else
+            {
+                found = GetKernels().FindLastNotOf(first, last, set);
+            }
+
+            return found != nullptr ? found : last;
+        }
+
+        void BuildSetBitmap(const char* first, const char* last, const ByteSetCls& set, uint64_t* bitmap)
+        {
+            if (set.HasCompleteRangeList() == false)
+            {
+                BuildSetBitmapScalar(first, last, set, bitmap);
+                return;
+            }
+            GetKernels().BuildSetBitmap(first, last, set, bitmap);
+        }
+        void BuildByteBitmap(const char* first, const char* last, char ch, uint64_t* bitmap)
+        {
+            GetKernels().BuildByteBitmap(first, last, ch, bitmap);
+        }
+    }
+}
@@ -0,0 +1,348 @@
+#include "SearcherCls.h"
+#include "CpuFeaturePkg.h"
+#include "ScanPkg.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(UTILITYLIB_X86)
+#include <immintrin.h>
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Short needle kernels
+        // Return index relative to haystack, or npos
+        // Needle size is at least 2 and not longer than haystack
+
+        static size_t FindShortScalar(const char* haystack, size_t haystackSize, const char* needle, size_t needleSize)
+        {
+            const char* last = haystack + haystackSize - needleSize + 1;
+            const char* candidate = haystack;
+
+            while (true)
+            {
+                candidate = FindByte(candidate, last, needle[0]);
+                if (candidate == last)
+                {
+                    return std::string_view::npos;
+                }
+                if (memcmp(candidate + 1, needle + 1, needleSize - 1) == 0)
+                {
+                    return static_cast<size_t>(candidate - haystack);
+                }
+                candidate++;
+            }
+        }
+
+#if defined(UTILITYLIB_X86)
+        UTILITYLIB_TARGET("sse2")
+        static size_t FindShortSse2(const char* haystack, size_t haystackSize, const char* needle, size_t needleSize)
+        {
+            const __m128i firstByte = _mm_set1_epi8(needle[0]);
+            const __m128i lastByte = _mm_set1_epi8(needle[needleSize - 1]);
+            size_t i = 0;
+
+            // Both blocks must be inside of the haystack
+            for (; i + needleSize - 1 + 16 <= haystackSize; i += 16)
+            {
+                __m128i firstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+                __m128i lastBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i + needleSize - 1));
+                __m128i candidates = _mm_and_si128(_mm_cmpeq_epi8(firstBlock, firstByte), _mm_cmpeq_epi8(lastBlock, lastByte));
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(candidates));
+
+                while (mask != 0)
+                {
+                    size_t candidate = i + std::countr_zero(mask);
+                    if (memcmp(haystack + candidate + 1, needle + 1, needleSize - 2) == 0)
+                    {
+                        return candidate;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+
+            size_t found = FindShortScalar(haystack + i, haystackSize - i, needle, needleSize);
+            return found != std::string_view::npos ? found + i : found;
+        }
+        UTILITYLIB_TARGET("avx2")
+        static size_t FindShortAvx2(const char* haystack, size_t haystackSize, const char* needle, size_t needleSize)
+        {
+            const __m256i firstByte = _mm256_set1_epi8(needle[0]);
+            const __m256i lastByte = _mm256_set1_epi8(needle[needleSize - 1]);
+            size_t i = 0;
+
+            for (; i + needleSize - 1 + 32 <= haystackSize; i += 32)
+            {
+                __m256i firstBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i));
+                __m256i lastBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i + needleSize - 1));
+                __m256i candidates = _mm256_and_si256(_mm256_cmpeq_epi8(firstBlock, firstByte), _mm256_cmpeq_epi8(lastBlock, lastByte));
+                uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(candidates));
+
+                while (mask != 0)
+                {
+                    size_t candidate = i + std::countr_zero(mask);
+                    if (memcmp(haystack + candidate + 1, needle + 1, needleSize - 2) == 0)
+                    {
+                        return candidate;
+                    }
+                    mask &= mask - 1;
+                }
+            }
+
+            size_t found = FindShortSse2(haystack + i, haystackSize - i, needle, needleSize);
+            return found != std::string_view::npos ? found + i : found;
+        }
+#endif
+
+        using FindShortFunction = size_t (*)(const char*, size_t, const char*, size_t);
+
+        static FindShortFunction SelectFindShort()
+        {
+            switch (GetSimdLevel())
+            {
+#if defined(UTILITYLIB_X86)
+                case SimdLevel::Avx512Bw:
+                case SimdLevel::Avx2:
+                {
+                    return FindShortAvx2;
+                }
+                case SimdLevel::Sse2:
+                {
+                    return FindShortSse2;
+                }
+#endif
+                default:
+                {
+                    return FindShortScalar;
+                }
+            }
+        }
+        static FindShortFunction GetFindShort()
+        {
+            static const FindShortFunction findShort = SelectFindShort();
+            return findShort;
+        }
+
+        SearcherCls::SearcherCls() :
+            ByteSet{},
+            CriticalPosition(0),
+            Period(0),
+            PeriodicMemory(0)
+        {
+        }
+        SearcherCls::SearcherCls(std::string_view needle) :
+            Needle(needle),
+            ByteSet{},
+            CriticalPosition(0),
+            Period(0),
+            PeriodicMemory(0)
+        {
+            if (Needle.size() > SHORT_NEEDLE_LIMIT)
+            {
+                PrepareTwoWay();
+            }
+        }
+
+        // Critical factorization of the needle, computed from the two maximal suffixes
+        // Indexes start from -1 (wrapping around size_t), as in the original description of the algorithm
+        void SearcherCls::PrepareTwoWay()
+        {
+            const unsigned char* n = reinterpret_cast<const unsigned char*>(Needle.data());
+            const size_t l = Needle.size();
+
+            // Bad character shift for the last byte of the window
+            Shift.assign(256, 0);
+            for (size_t i = 0; i < l; i++)
+            {
+                ByteSet[n[i] >> 6] |= uint64_t{ 1 } << (n[i] & 63);
+                Shift[n[i]] = i + 1;
+            }
+
+            // Maximal suffix for <
+            size_t ip = static_cast<size_t>(-1);
+            size_t jp = 0;
+            size_t k = 1;
+            size_t p = 1;
+            while (jp + k < l)
+            {
+                if (n[ip + k] == n[jp + k])
+                {
+                    if (k == p)
+                    {
+                        jp += p;
+                        k = 1;
+                    }
+                    else
+                    {
+                        k++;
+                    }
+                }
+                else if (n[ip + k] > n[jp + k])
+                {
+                    jp += k;
+                    k = 1;
+                    p = jp - ip;
+                }
+                else
+                {
+                    ip = jp++;
+                    k = p = 1;
+                }
+            }
+            size_t ms = ip;
+            size_t p0 = p;
+
+            // Maximal suffix for >
+            ip = static_cast<size_t>(-1);
+            jp = 0;
+            k = p = 1;
+            while (jp + k < l)
+            {
+                if (n[ip + k] == n[jp + k])
+                {
+                    if (k == p)
+                    {
+                        jp += p;
+                        k = 1;
+                    }
+                    else
+                    {
+                        k++;
+                    }
+                }
+                else if (n[ip + k] < n[jp + k])
+                {
+                    jp += k;
+                    k = 1;
+                    p = jp - ip;
+                }
+                else
+                {
+                    ip = jp++;
+                    k = p = 1;
+                }
+            }
+
+            // Use the longer one
+            if (ip + 1 > ms + 1)
+            {
+                ms = ip;
+            }
+            else
+            {
+                p = p0;
+            }
+
+            // Periodic needles remember how much of the window is already matched after a shift
+            if (memcmp(n, n + p, ms + 1) != 0)
+            {
+                PeriodicMemory = 0;
+                p = std::max(ms, l - ms - 1) + 1;
+            }
+            else
+            {
+                PeriodicMemory = l - p;
+            }
+
+            CriticalPosition = ms;
+            Period = p;
+        }
+
+        size_t SearcherCls::FindTwoWay(std::string_view haystack, size_t pos) const
+        {
+            const unsigned char* n = reinterpret_cast<const unsigned char*>(Needle.data());
+            const unsigned char* h = reinterpret_cast<const unsigned char*>(haystack.data()) + pos;
+            const unsigned char* z = reinterpret_cast<const unsigned char*>(haystack.data()) + haystack.size();
+            const size_t l = Needle.size();
+            const size_t ms = CriticalPosition;
+            size_t mem = 0;
+            size_t k = 0;
+
+            while (static_cast<size_t>(z - h) >= l)
+            {
+                // Check last byte of the window first, shift by the bad character rule on mismatch
+                unsigned char lastByte = h[l - 1];
+                if (((ByteSet[lastByte >> 6] >> (lastByte & 63)) & 1) != 0)
+                {
+                    k = l - Shift[lastByte];
+                    if (k != 0)
+                    {
+                        if (k < mem)
+                        {
+                            k = mem;
+                        }
+                        h += k;
+                        mem = 0;
+                        continue;
+                    }
+                }
+                else
+                {
+                    h += l;
+                    mem = 0;
+                    continue;
+                }
+
+                // Compare right half
+                for (k = std::max(ms + 1, mem); k < l && n[k] == h[k]; k++)
+                {
+                }
+                if (k < l)
+                {
+                    h += k - ms;
+                    mem = 0;
+                    continue;
+                }
+
+                // Compare left half
+                for (k = ms + 1; k > mem && n[k - 1] == h[k - 1]; k--)
+                {
+                }
+                if (k <= mem)
+                {
+                    return static_cast<size_t>(h - reinterpret_cast<const unsigned char*>(haystack.data()));
+                }
+                h += Period;
+                mem = PeriodicMemory;
+            }
+
+            return std::string_view::npos;
+        }
+
+        size_t SearcherCls::Find(std::string_view haystack, size_t pos) const
+        {
+            const size_t needleSize = Needle.size();
+
+            if (pos > haystack.size() || haystack.size() - pos < needleSize)
+            {
+                return std::string_view::npos;
+            }
+            if (needleSize == 0)
+            {
+                return pos;
+            }
+            if (needleSize == 1)
+            {
+                const char* last = haystack.data() + haystack.size();
+                const char* found = FindByte(haystack.data() + pos, last, Needle[0]);
+                return found != last ? static_cast<size_t>(found - haystack.data()) : std::string_view::npos;
+            }
+            if (needleSize <= SHORT_NEEDLE_LIMIT)
+            {
+                size_t found = GetFindShort()(haystack.data() + pos, haystack.size() - pos, Needle.data(), needleSize);
+                return found != std::string_view::npos ? found + pos : found;
+            }
+
+            return FindTwoWay(haystack, pos);
+        }
+
+        std::string_view SearcherCls::GetNeedle() const
+        {
+            return Needle;
+        }
+    }
+}
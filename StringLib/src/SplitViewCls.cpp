@@ -0,0 +1,104 @@
+#include "SplitViewCls.h"
+#include "ScanPkg.h"
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        static_assert(std::ranges::view<SplitViewCls>);
+        static_assert(std::ranges::forward_range<SplitViewCls>);
+
+        SplitViewCls::SplitViewCls() :
+            DelimiterChar('\0'),
+            IsCharDelimiter(true),
+            Mode(EmptyFields::Skip)
+        {
+        }
+        SplitViewCls::SplitViewCls(std::string_view str, char ch, EmptyFields mode) :
+            Source(str),
+            DelimiterChar(ch),
+            IsCharDelimiter(true),
+            Mode(mode)
+        {
+        }
+        SplitViewCls::SplitViewCls(std::string_view str, std::string_view delimiter, EmptyFields mode) :
+            Source(str),
+            Delimiter(delimiter),
+            DelimiterChar('\0'),
+            IsCharDelimiter(false),
+            Mode(mode)
+        {
+        }
+
+        size_t SplitViewCls::FindDelimiter(size_t pos) const
+        {
+            if (IsCharDelimiter)
+            {
+                const char* last = Source.data() + Source.size();
+                const char* found = FindByte(Source.data() + pos, last, DelimiterChar);
+                return found != last ? static_cast<size_t>(found - Source.data()) : std::string_view::npos;
+            }
+
+            // Empty delimiter never splits anything
+            if (Delimiter.GetNeedle().empty())
+            {
+                return std::string_view::npos;
+            }
+
+            return Delimiter.Find(Source, pos);
+        }
+        size_t SplitViewCls::GetDelimiterSize() const
+        {
+            return IsCharDelimiter ? 1 : Delimiter.GetNeedle().size();
+        }
+
+        SplitViewCls::Iterator SplitViewCls::begin() const
+        {
+            Iterator it;
+            it.Parent = this;
+            it.NextStart = 0;
+            it.IsEnd = false;
+            it.Advance();
+            return it;
+        }
+        std::default_sentinel_t SplitViewCls::end() const
+        {
+            return std::default_sentinel;
+        }
+
+        void SplitViewCls::Iterator::Advance()
+        {
+            const size_t sourceSize = Parent->Source.size();
+            const size_t delimiterSize = Parent->GetDelimiterSize();
+
+            while (true)
+            {
+                // Last field is already yielded
+                if (NextStart == std::string_view::npos)
+                {
+                    IsEnd = true;
+                    return;
+                }
+
+                size_t delimiterIndex = Parent->FindDelimiter(NextStart);
+                TokenStart = NextStart;
+
+                if (delimiterIndex == std::string_view::npos)
+                {
+                    TokenEnd = sourceSize;
+                    NextStart = std::string_view::npos;
+                }
+                else
+                {
+                    TokenEnd = delimiterIndex;
+                    NextStart = delimiterIndex + delimiterSize;
+                }
+
+                if (TokenStart != TokenEnd || Parent->Mode == EmptyFields::Keep)
+                {
+                    return;
+                }
+            }
+        }
+    }
+}
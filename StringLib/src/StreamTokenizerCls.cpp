@@ -0,0 +1,260 @@
+#include "StreamTokenizerCls.h"
+#include "ScanPkg.h"
+
+#include <algorithm>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        StreamTokenizerCls::StreamTokenizerCls(char ch, size_t maxTokenSize, EmptyFields mode) :
+            DelimiterChar(ch),
+            IsCharDelimiter(true),
+            Mode(mode),
+            MaxTokenSize(maxTokenSize),
+            ChunkPos(0),
+            IsPendingReturned(false),
+            IsSkipping(false)
+        {
+            Pending.reserve(MaxTokenSize + GetTailSize());
+        }
+        StreamTokenizerCls::StreamTokenizerCls(std::string_view delimiter, size_t maxTokenSize, EmptyFields mode) :
+            Delimiter(delimiter),
+            DelimiterChar('\0'),
+            IsCharDelimiter(false),
+            Mode(mode),
+            MaxTokenSize(maxTokenSize),
+            ChunkPos(0),
+            IsPendingReturned(false),
+            IsSkipping(false)
+        {
+            Pending.reserve(MaxTokenSize + GetTailSize());
+            Bridge.reserve(2 * GetTailSize());
+        }
+
+        size_t StreamTokenizerCls::FindDelimiter(std::string_view str, size_t pos) const
+        {
+            if (IsCharDelimiter)
+            {
+                const char* last = str.data() + str.size();
+                const char* found = FindByte(str.data() + pos, last, DelimiterChar);
+                return found != last ? static_cast<size_t>(found - str.data()) : std::string_view::npos;
+            }
+
+            // Empty delimiter never splits anything
+            if (Delimiter.GetNeedle().empty())
+            {
+                return std::string_view::npos;
+            }
+
+            return Delimiter.Find(str, pos);
+        }
+        size_t StreamTokenizerCls::GetDelimiterSize() const
+        {
+            return IsCharDelimiter ? 1 : Delimiter.GetNeedle().size();
+        }
+        // Bytes at the end of a chunk that can be the start of a delimiter without containing it
+        size_t StreamTokenizerCls::GetTailSize() const
+        {
+            return GetDelimiterSize() != 0 ? GetDelimiterSize() - 1 : 0;
+        }
+
+        // While a long token is skipped only the bytes that could be the start of a split delimiter are kept
+        void StreamTokenizerCls::KeepDelimiterTail(std::string_view rest)
+        {
+            size_t tailSize = GetTailSize();
+            if (rest.size() >= tailSize)
+            {
+                Pending.assign(rest.substr(rest.size() - tailSize));
+                return;
+            }
+
+            Pending.append(rest);
+            if (Pending.size() > tailSize)
+            {
+                Pending.erase(0, Pending.size() - tailSize);
+            }
+        }
+
+        void StreamTokenizerCls::Feed(std::string_view chunk)
+        {
+            Chunk = chunk;
+            ChunkPos = 0;
+        }
+
+        TokenStatus StreamTokenizerCls::Next(std::string_view& token)
+        {
+            if (IsPendingReturned)
+            {
+                Pending.clear();
+                IsPendingReturned = false;
+            }
+
+            while (true)
+            {
+                if (Pending.empty() == false || IsSkipping)
+                {
+                    TokenStatus status = NextFromPending(token);
+                    // Empty token that is skipped, or the end of a too long one, search goes on
+                    if (status == TokenStatus::Found && IsPendingReturned == false)
+                    {
+                        continue;
+                    }
+                    return status;
+                }
+
+                if (ChunkPos >= Chunk.size())
+                {
+                    return TokenStatus::NeedMoreData;
+                }
+
+                size_t found = FindDelimiter(Chunk, ChunkPos);
+                if (found == std::string_view::npos)
+                {
+                    std::string_view rest = Chunk.substr(ChunkPos);
+                    ChunkPos = Chunk.size();
+                    if (rest.size() > MaxTokenSize + GetTailSize())
+                    {
+                        IsSkipping = true;
+                        KeepDelimiterTail(rest);
+                        return TokenStatus::TooLong;
+                    }
+
+                    Pending.assign(rest);
+                    return TokenStatus::NeedMoreData;
+                }
+
+                // Whole token is in the chunk, it is returned without a copy
+                std::string_view result = Chunk.substr(ChunkPos, found - ChunkPos);
+                ChunkPos = found + GetDelimiterSize();
+                if (result.size() > MaxTokenSize)
+                {
+                    return TokenStatus::TooLong;
+                }
+                if (result.empty() && Mode == EmptyFields::Skip)
+                {
+                    continue;
+                }
+
+                token = result;
+                return TokenStatus::Found;
+            }
+        }
+
+        // Token started in an earlier chunk, its end is searched in the current one
+        // Returns TokenStatus::Found without setting IsPendingReturned when nothing is returned but the search must go on
+        TokenStatus StreamTokenizerCls::NextFromPending(std::string_view& token)
+        {
+            const size_t delimiterSize = GetDelimiterSize();
+            std::string_view rest = Chunk.substr(std::min(ChunkPos, Chunk.size()));
+            size_t pendingSize = Pending.size();
+            size_t chunkSize = 0;
+            size_t consumedSize = 0;
+            bool isFound = false;
+
+            // A delimiter that starts in Pending and ends in the chunk
+            if (GetTailSize() != 0)
+            {
+                size_t tailSize = std::min(Pending.size(), GetTailSize());
+                Bridge.assign(Pending, Pending.size() - tailSize, tailSize);
+                Bridge.append(rest.substr(0, GetTailSize()));
+
+                size_t found = FindDelimiter(Bridge, 0);
+                if (found != std::string_view::npos && found < tailSize)
+                {
+                    pendingSize = Pending.size() - tailSize + found;
+                    consumedSize = found + delimiterSize - tailSize;
+                    isFound = true;
+                }
+            }
+            if (isFound == false)
+            {
+                size_t found = FindDelimiter(rest, 0);
+                if (found != std::string_view::npos)
+                {
+                    chunkSize = found;
+                    consumedSize = found + delimiterSize;
+                    isFound = true;
+                }
+            }
+
+            if (isFound == false)
+            {
+                ChunkPos = Chunk.size();
+                if (IsSkipping)
+                {
+                    KeepDelimiterTail(rest);
+                    return TokenStatus::NeedMoreData;
+                }
+                if (Pending.size() + rest.size() > MaxTokenSize + GetTailSize())
+                {
+                    IsSkipping = true;
+                    KeepDelimiterTail(rest);
+                    return TokenStatus::TooLong;
+                }
+
+                Pending.append(rest);
+                return TokenStatus::NeedMoreData;
+            }
+
+            ChunkPos += consumedSize;
+            if (IsSkipping)
+            {
+                IsSkipping = false;
+                Pending.clear();
+                return TokenStatus::Found;
+            }
+            if (pendingSize + chunkSize > MaxTokenSize)
+            {
+                Pending.clear();
+                return TokenStatus::TooLong;
+            }
+
+            Pending.resize(pendingSize);
+            Pending.append(rest.substr(0, chunkSize));
+            if (Pending.empty() && Mode == EmptyFields::Skip)
+            {
+                return TokenStatus::Found;
+            }
+
+            token = Pending;
+            IsPendingReturned = true;
+            return TokenStatus::Found;
+        }
+
+        bool StreamTokenizerCls::Finish(std::string_view& token)
+        {
+            bool isReturned = false;
+            if (IsPendingReturned == false && IsSkipping == false && Pending.empty() == false && Pending.size() <= MaxTokenSize)
+            {
+                token = Pending;
+                isReturned = true;
+            }
+
+            // Pending is cleared on the next call, so the token stays valid until then
+            IsPendingReturned = isReturned;
+            if (isReturned == false)
+            {
+                Pending.clear();
+            }
+            IsSkipping = false;
+            Chunk = std::string_view();
+            ChunkPos = 0;
+            return isReturned;
+        }
+
+        void StreamTokenizerCls::Reset()
+        {
+            Pending.clear();
+            IsPendingReturned = false;
+            IsSkipping = false;
+            Chunk = std::string_view();
+            ChunkPos = 0;
+        }
+
+        size_t StreamTokenizerCls::GetPendingSize() const
+        {
+            return IsPendingReturned ? 0 : Pending.size();
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#include "StringBuilderCls.h"
+
+#include <cstring>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        StringBuilderCls::StringBuilderCls() :
+            StringBuilderCls(std::pmr::get_default_resource())
+        {
+        }
+        StringBuilderCls::StringBuilderCls(std::pmr::memory_resource* upstream) :
+            ArenaResource(InlineArena, INLINE_ARENA_SIZE, upstream),
+            PieceList(&ArenaResource),
+            Scratch(&ArenaResource),
+            Size(0)
+        {
+        }
+
+        void StringBuilderCls::AddScratchPiece(size_t offset, size_t size)
+        {
+            // Consecutive scratch pieces are merged
+            if (PieceList.empty() == false)
+            {
+                PieceStc& last = PieceList.back();
+                if (last.Data == nullptr && last.Offset + last.Size == offset)
+                {
+                    last.Size += size;
+                    Size += size;
+                    return;
+                }
+            }
+
+            PieceList.push_back({ nullptr, offset, size });
+            Size += size;
+        }
+
+        void StringBuilderCls::Append(char ch)
+        {
+            size_t offset = Scratch.size();
+            Scratch.push_back(ch);
+            AddScratchPiece(offset, 1);
+        }
+        void StringBuilderCls::AppendFloating(double value)
+        {
+            size_t offset = Scratch.size();
+            Scratch.resize(offset + MAX_FLOATING_CHARS);
+            size_t size = FormatFloating(value, Scratch.data() + offset);
+            Scratch.resize(offset + size);
+            AddScratchPiece(offset, size);
+        }
+
+        void StringBuilderCls::Reserve(size_t pieceCount)
+        {
+            PieceList.reserve(pieceCount);
+        }
+
+        size_t StringBuilderCls::GetSize() const
+        {
+            return Size;
+        }
+
+        size_t StringBuilderCls::CopyTo(char* out) const
+        {
+            const char* scratch = Scratch.data();
+            char* pos = out;
+
+            for (const PieceStc& piece : PieceList)
+            {
+                const char* data = piece.Data != nullptr ? piece.Data : scratch + piece.Offset;
+                memcpy(pos, data, piece.Size);
+                pos += piece.Size;
+            }
+
+            return Size;
+        }
+        void StringBuilderCls::AppendTo(std::string& out) const
+        {
+            size_t oldSize = out.size();
+            out.resize(oldSize + Size);
+            CopyTo(out.data() + oldSize);
+        }
+        std::string StringBuilderCls::ToString() const
+        {
+            std::string result;
+            AppendTo(result);
+            return result;
+        }
+
+        void StringBuilderCls::Clear()
+        {
+            PieceList.clear();
+            Scratch.clear();
+            Size = 0;
+        }
+    }
+}
@@ -1,75 +1,176 @@
 #include "StringPkg.h"
+#include "Base64Pkg.h"
+#include "EndpointCls.h"
+#include "IpAddressCls.h"
+#include "ParallelPkg.h"
+#include "ScanPkg.h"
+#include "SearcherCls.h"
+#include "StringBuilderCls.h"
+#include "WordViewCls.h"
+
+#include <cstring>
 
 namespace UtilityLib
 {
     namespace String
     {
-        std::vector<std::string> Divide(const std::string& str, const char ch)
+        // Trim functions only remove ' ' characters
+        static constexpr ByteSetCls TRIM_CHARS = ByteSetCls(" ");
+
+        // Strings per FuzzyFilter() chunk, lists that fit in one chunk are matched without starting threads
+        static constexpr size_t FUZZY_CHUNK_SIZE = 1024;
+
+        static std::string JoinViews(const std::vector<std::string>& stringList, std::string_view delimiter)
         {
-            std::vector<std::string> strList;
-            size_t startIdx = 0;
-            size_t stringSize = str.size();
+            StringBuilderCls builder;
+            builder.Reserve(stringList.size() * 2);
 
-            for (size_t i = 0; i < stringSize; i++)
+            for (size_t i = 0; i < stringList.size(); i++)
             {
-                if (str[i] == ch)
+                // Unless this is the first string, add delimiter in between strings
+                if (i != 0)
                 {
-                    std::string subStr = str.substr(startIdx, i - startIdx);
-                    if (subStr.size() != 0)
-                    {
-                        strList.push_back(subStr);
-                        startIdx = i + 1;
-                    }
+                    builder.Append(delimiter);
                 }
+                builder.Append(stringList[i]);
             }
 
-            return strList;
+            return builder.ToString();
         }
-        std::vector<std::string> Divide(const std::string& str, const std::string& substr)
+
+        // Part of a string that will be replaced: [Offset, Offset + Length) becomes Replacement
+        struct ReplacementStc
         {
-            std::vector<std::string> strList;
-            std::string piece;
-
-            // Index of the start of string piece
-            size_t startIdx = 0;
-            // Index of the first character of substring
-            size_t substrFirstChar = str.find(substr);
-            // Determined length of string piece
-            size_t len = substrFirstChar - startIdx;
-            // length of substring
-            size_t substrSize = substr.size();
-
-            // Loop through the string until specified substr cannot be found anymore
-            while (substrFirstChar != std::string::npos)
-            {
-                // Add piece to the list
-                if (len != 0)
+            size_t Offset;
+            size_t Length;
+            std::string_view Replacement;
+        };
+
+        // Builds the result in a single allocation of the exact final size
+        static std::string BuildReplaced(std::string_view str, const std::vector<ReplacementStc>& replacementList)
+        {
+            StringBuilderCls builder;
+            builder.Reserve(replacementList.size() * 2 + 1);
+
+            size_t readIndex = 0;
+            for (const ReplacementStc& replacement : replacementList)
+            {
+                builder.Append(str.substr(readIndex, replacement.Offset - readIndex));
+                builder.Append(replacement.Replacement);
+                readIndex = replacement.Offset + replacement.Length;
+            }
+            builder.Append(str.substr(readIndex));
+
+            return builder.ToString();
+        }
+
+        // Replacements are written over the string itself
+        // Only valid when no replacement is longer than the part it replaces, so writes never pass reads
+        static void ReplaceInPlace(std::string& str, const std::vector<ReplacementStc>& replacementList)
+        {
+            char* data = str.data();
+            size_t readIndex = 0;
+            size_t writeIndex = 0;
+
+            for (const ReplacementStc& replacement : replacementList)
+            {
+                size_t keptSize = replacement.Offset - readIndex;
+                if (writeIndex != readIndex)
                 {
-                    piece = str.substr(startIdx, len);
-                    strList.push_back(piece);
+                    memmove(data + writeIndex, data + readIndex, keptSize);
                 }
+                writeIndex += keptSize;
 
-                // Find the start index of next piece. It is end of previous piece + length of the substring
-                startIdx = substrFirstChar + substrSize;
+                memcpy(data + writeIndex, replacement.Replacement.data(), replacement.Replacement.size());
+                writeIndex += replacement.Replacement.size();
+                readIndex = replacement.Offset + replacement.Length;
+            }
 
-                // Find the start index of  next occurrence of substring
-                substrFirstChar = str.find(substr, startIdx);
+            size_t tailSize = str.size() - readIndex;
+            if (writeIndex != readIndex)
+            {
+                memmove(data + writeIndex, data + readIndex, tailSize);
+            }
+            str.resize(writeIndex + tailSize);
+        }
 
-                // Find the length of substring
-                if (substrFirstChar != std::string::npos)
+        static std::vector<ReplacementStc> FindReplacements(std::string_view str, const std::string& srcSubstr, const std::string& dstSubstr)
+        {
+            std::vector<ReplacementStc> replacementList;
+
+            // Empty substring would match everywhere
+            if (srcSubstr.empty())
+            {
+                return replacementList;
+            }
+
+            SearcherCls searcher(srcSubstr);
+            size_t index = searcher.Find(str);
+
+            while (index != std::string::npos)
+            {
+                replacementList.push_back({ index, srcSubstr.size(), dstSubstr });
+                index = searcher.Find(str, index + srcSubstr.size());
+            }
+
+            return replacementList;
+        }
+
+        // isShrinkOnly is set to false if any replacement is longer than the part it replaces
+        static std::vector<ReplacementStc> FindReplacements(std::string_view str, const std::vector<std::pair<std::string, std::string>>& replacementList, bool& isShrinkOnly)
+        {
+            std::vector<std::string> keywordList;
+            std::vector<size_t> keywordReplacement;
+            isShrinkOnly = true;
+
+            // Empty patterns are ignored, they would match everywhere
+            for (size_t i = 0; i < replacementList.size(); i++)
+            {
+                if (replacementList[i].first.empty() == false)
                 {
-                    len = substrFirstChar - startIdx;
+                    keywordList.push_back(replacementList[i].first);
+                    keywordReplacement.push_back(i);
                 }
-                else
+            }
+
+            KeywordMatcherCls matcher(keywordList);
+            std::vector<KeywordMatchStc> matchList = matcher.FindNonOverlapping(str);
+
+            std::vector<ReplacementStc> result;
+            result.reserve(matchList.size());
+
+            for (const KeywordMatchStc& match : matchList)
+            {
+                const std::string& dstSubstr = replacementList[keywordReplacement[match.KeywordIndex]].second;
+                result.push_back({ match.Offset, match.Length, dstSubstr });
+
+                if (dstSubstr.size() > match.Length)
                 {
-                    len = str.size() - startIdx;
-                    if (len != 0)
-                    {
-                        piece = str.substr(startIdx, len);
-                        strList.push_back(piece);
-                    }
+                    isShrinkOnly = false;
                 }
+            }
+
+            return result;
+        }
 
+        std::vector<std::string> Divide(const std::string& str, const char ch)
+        {
+            std::vector<std::string> strList;
+
+            for (std::string_view token : SplitViewCls(str, ch))
+            {
+                strList.emplace_back(token);
+            }
+
+            return strList;
+        }
+        std::vector<std::string> Divide(const std::string& str, const std::string& substr)
+        {
+            std::vector<std::string> strList;
+
+            for (std::string_view token : SplitViewCls(str, substr))
+            {
+                strList.emplace_back(token);
             }
 
             return strList;
@@ -93,244 +194,263 @@ namespace UtilityLib
             return filteredList;
         }
         std::vector<std::string> Filter(const std::vector<std::string>& strList, const std::vector<std::string>& keywordList)
+        {
+            KeywordMatcherCls matcher(keywordList);
+            return Filter(strList, matcher);
+        }
+        std::vector<std::string> Filter(const std::vector<std::string>& strList, const KeywordMatcherCls& matcher)
         {
             std::vector<std::string> filteredList;
-            size_t strListSize = strList.size();
-            size_t keywordListSize = keywordList.size();
 
-            for (size_t i = 0; i < strListSize; i++)
+            for (const std::string& str : strList)
             {
-                bool keywordFound = false;
-
-                for (size_t j = 0; j < keywordListSize; j++)
-                {
-                    size_t index = strList.at(i).find(keywordList.at(j));
-
-                    // At least one keyword is found, this string will be filtered
-                    if (index != std::string::npos)
-                    {
-                        keywordFound = true;
-                        break;
-                    }
-                }
-
-                // No keyword is found, at string to the filteredList vector
-                if (keywordFound == false)
+                // No keyword is found, add string to the filteredList vector
+                if (matcher.IsMatch(str) == false)
                 {
-                    filteredList.push_back(strList.at(i));
+                    filteredList.push_back(str);
                 }
             }
 
             return filteredList;
         }
-        std::string LeftTrim(const std::string& str)
+        std::vector<std::string> FuzzyFilter(const std::vector<std::string>& strList, const std::string& pattern, size_t maxDistance)
         {
-            std::string result = str;
-            size_t strSize = str.size();
-
-            for (size_t i = 0; i < strSize; i++)
-            {
-                if (str[i] != ' ')
-                {
-                    result = str.substr(i, strSize - i);
-                    break;
-                }
-            }
-
-            return result;
+            FuzzyMatcherCls matcher(pattern);
+            return FuzzyFilter(strList, matcher, maxDistance);
         }
-        std::string RightTrim(const std::string& str)
+        std::vector<std::string> FuzzyFilter(const std::vector<std::string>& strList, const FuzzyMatcherCls& matcher, size_t maxDistance)
         {
-            std::string result = str;
-            size_t strSize = str.size();
+            const size_t size = strList.size();
+            std::vector<uint8_t> isMatch(size, 0);
 
-            for (size_t i = strSize - 1; i > 0; i--)
+            ForEachChunk(size, ParallelOptionStc{ 0, FUZZY_CHUNK_SIZE }, [&](size_t, size_t first, size_t last)
             {
-                if (str[i] != ' ')
+                for (size_t i = first; i < last; i++)
                 {
-                    result = str.substr(0, i + 1);
-                    break;
+                    isMatch[i] = matcher.IsMatch(strList[i], maxDistance) ? 1 : 0;
                 }
-            }
-
-            return result;
-        }
-        std::string Trim(const std::string& str)
-        {
-            std::string result = LeftTrim(str);
-            result = RightTrim(result);
-            return result;
-        }
-        std::string Join(const std::vector<std::string>& stringList, const char ch)
-        {
-            std::string result;
-            size_t listSize = stringList.size();
+            });
 
-            for (size_t i = 0; i < listSize; i++)
+            std::vector<std::string> filteredList;
+            for (size_t i = 0; i < size; i++)
             {
-                result += stringList.at(i);
-
-                // Unless this is the last string, add character in between strings
-                if (i != listSize - 1)
+                if (isMatch[i] != 0)
                 {
-                    result += ch;
+                    filteredList.push_back(strList[i]);
                 }
             }
 
-            return result;
+            return filteredList;
         }
-        std::string Join(const std::vector<std::string>& stringList, const std::string& delimiter)
+        std::string LeftTrim(const std::string& str)
         {
-            std::string result;
-            size_t listSize = stringList.size();
+            const char* first = str.data();
+            const char* last = first + str.size();
 
-            for (size_t i = 0; i < listSize; i++)
-            {
-                result += stringList.at(i);
+            const char* nonSpace = FindFirstNotOf(first, last, TRIM_CHARS);
 
-                // Unless this is the last string, add character in between strings
-                if (i != listSize - 1)
-                {
-                    result += delimiter;
-                }
-            }
-
-            return result;
+            return std::string(nonSpace, last);
         }
-        bool IsStartWith(const std::string& str, const std::string& prefix)
+        std::string RightTrim(const std::string& str)
         {
-            bool result = false;
+            const char* first = str.data();
+            const char* last = first + str.size();
 
-            size_t index = str.find(prefix);
-            if (index == 0)
+            const char* nonSpace = FindLastNotOf(first, last, TRIM_CHARS);
+
+            // String consists of spaces only
+            if (nonSpace == last)
             {
-                result = true;
+                return std::string();
             }
 
-            return result;
+            return std::string(first, nonSpace + 1);
         }
-        bool IsEndWith(const std::string& str, const std::string& suffix)
+        std::string Trim(const std::string& str)
         {
-            bool result = false;
-            size_t searchStart = str.size() - suffix.size();
+            const char* first = str.data();
+            const char* last = first + str.size();
 
-            size_t index = str.find(suffix, searchStart);
-            if (index == searchStart)
+            // Both ends are found first, so the result is copied only once
+            const char* nonSpace = FindFirstNotOf(first, last, TRIM_CHARS);
+            if (nonSpace == last)
             {
-                result = true;
+                return std::string();
             }
 
-            return result;
+            return std::string(nonSpace, FindLastNotOf(nonSpace, last, TRIM_CHARS) + 1);
+        }
+        std::string Join(const std::vector<std::string>& stringList, const char ch)
+        {
+            return JoinViews(stringList, std::string_view(&ch, 1));
+        }
+        std::string Join(const std::vector<std::string>& stringList, const std::string& delimiter)
+        {
+            return JoinViews(stringList, std::string_view(delimiter));
         }
         std::string Replace(const std::string& str, const std::string& srcSubstr, const std::string& dstSubstr)
         {
             std::string result = "";
             size_t srcStrSize = srcSubstr.size();
 
-            size_t index = str.find(srcSubstr);
+            size_t index = SearcherCls(srcSubstr).Find(str);
 
             // Source substring exists
             if (index != std::string::npos)
             {
+                result.reserve(str.size() - srcStrSize + dstSubstr.size());
                 // Add string until the source substring
-                result = str.substr(0, index);
+                result.append(str, 0, index);
                 // Add destination substring
                 result += dstSubstr;
                 // Add string after the source substring
-                result += str.substr(index + srcStrSize, str.size() - index - srcStrSize);
+                result.append(str, index + srcStrSize, std::string::npos);
             }
 
             return result;
         }
         std::string ReplaceAll(const std::string& str, const std::string& srcSubstr, const std::string& dstSubstr)
         {
-            std::string result = "";
-            size_t srcStrSize = srcSubstr.size();
-            size_t startIndex = 0;
-            size_t endIndex = 0;
+            // Empty substring would match everywhere
+            if (srcSubstr.empty())
+            {
+                return str;
+            }
+
+            // Pieces go straight into the builder, no list of matches is kept
+            SearcherCls searcher(srcSubstr);
+            StringBuilderCls builder;
+            std::string_view source(str);
+            size_t readIndex = 0;
+            size_t index = searcher.Find(source);
 
-            do
+            if (index == std::string::npos)
             {
-                endIndex = str.find(srcSubstr, startIndex);
-                result += str.substr(startIndex, endIndex - startIndex);
-                result += dstSubstr;
-                startIndex = endIndex + srcStrSize;
+                return str;
+            }
 
-            } while (endIndex != std::string::npos);
+            while (index != std::string::npos)
+            {
+                builder.Append(source.substr(readIndex, index - readIndex));
+                builder.Append(dstSubstr);
+                readIndex = index + srcSubstr.size();
+                index = searcher.Find(source, readIndex);
+            }
+            builder.Append(source.substr(readIndex));
 
-            return result;
+            return builder.ToString();
         }
-        std::string ToLower(const std::string& str)
+        std::string ReplaceAll(std::string&& str, const std::string& srcSubstr, const std::string& dstSubstr)
         {
-            std::string result = "";
-            size_t size = str.size();
+            std::vector<ReplacementStc> replacementList = FindReplacements(str, srcSubstr, dstSubstr);
 
-            for (size_t i = 0; i < size; i++)
+            if (replacementList.empty())
             {
-                result += std::tolower(str[i]);
+                return std::move(str);
+            }
+            if (dstSubstr.size() > srcSubstr.size())
+            {
+                return BuildReplaced(str, replacementList);
             }
 
-            return result;
+            ReplaceInPlace(str, replacementList);
+            return std::move(str);
         }
-        std::string ToUpper(const std::string& str)
+        std::string ReplaceMany(const std::string& str, const std::vector<std::pair<std::string, std::string>>& replacementList)
         {
-            std::string result = "";
-            size_t size = str.size();
+            bool isShrinkOnly = true;
+            std::vector<ReplacementStc> matchList = FindReplacements(str, replacementList, isShrinkOnly);
 
-            for (size_t i = 0; i < size; i++)
+            if (matchList.empty())
             {
-                result += std::toupper(str[i]);
+                return str;
             }
 
-            return result;
+            return BuildReplaced(str, matchList);
         }
-        std::string RemoveSubstring(const std::string& str, const std::string& substr)
+        std::string ReplaceMany(std::string&& str, const std::vector<std::pair<std::string, std::string>>& replacementList)
         {
-            std::string result = "";
-            size_t substrSize = substr.size();
-            size_t strSize = str.size();
-            size_t startIndex = 0;
-            size_t substrStartIndex = str.find(substr);
+            bool isShrinkOnly = true;
+            std::vector<ReplacementStc> matchList = FindReplacements(str, replacementList, isShrinkOnly);
 
-            if (substrStartIndex == std::string::npos)
+            if (matchList.empty())
             {
-                return str;
+                return std::move(str);
             }
-
-            while (substrStartIndex != std::string::npos)
+            if (isShrinkOnly == false)
             {
-                result += str.substr(startIndex, substrStartIndex - startIndex);
-                startIndex = substrStartIndex + substrSize;
-                substrStartIndex = str.find(substr, startIndex);
+                return BuildReplaced(str, matchList);
             }
 
-            result += str.substr(startIndex, strSize - startIndex);
-
+            ReplaceInPlace(str, matchList);
+            return std::move(str);
+        }
+        std::string ToLower(const std::string& str)
+        {
+            std::string result(str.size(), '\0');
+            ToLowerAscii(str, result.data());
             return result;
         }
+        std::string ToLower(std::string&& str)
+        {
+            ToLowerAscii(str.data(), str.data() + str.size());
+            return std::move(str);
+        }
+        std::string ToUpper(const std::string& str)
+        {
+            std::string result(str.size(), '\0');
+            ToUpperAscii(str, result.data());
+            return result;
+        }
+        std::string ToUpper(std::string&& str)
+        {
+            ToUpperAscii(str.data(), str.data() + str.size());
+            return std::move(str);
+        }
+        std::string RemoveSubstring(const std::string& str, const std::string& substr)
+        {
+            return ReplaceAll(str, substr, std::string());
+        }
+        std::string RemoveSubstring(std::string&& str, const std::string& substr)
+        {
+            return ReplaceAll(std::move(str), substr, std::string());
+        }
         std::string RemoveSubstrings(const std::string& str, const std::vector<std::string>& substrList)
         {
-            std::string result = str;
+            return RemoveSubstrings(std::string(str), substrList);
+        }
+        std::string RemoveSubstrings(std::string&& str, const std::vector<std::string>& substrList)
+        {
+            std::vector<std::pair<std::string, std::string>> replacementList;
+            replacementList.reserve(substrList.size());
 
-            for (size_t i = 0; i < substrList.size(); i++)
+            for (const std::string& substr : substrList)
             {
-                result = RemoveSubstring(result, substrList.at(i));
+                replacementList.emplace_back(substr, std::string());
             }
 
-            return result;
+            return ReplaceMany(std::move(str), replacementList);
         }
         std::string RemoveDuplicateChars(const std::string& str)
         {
-            std::string result = "";
-            size_t size = str.size();
+            std::string result;
+            bool isSeen[256]{};
+            size_t seenCount = 0;
 
-            for (size_t i = 0; i < size; i++)
+            for (char ch : str)
             {
-                size_t index = result.find(str[i]);
+                unsigned char value = static_cast<unsigned char>(ch);
 
-                if (index == std::string::npos)
+                if (isSeen[value] == false)
                 {
-                    result += str[i];
+                    isSeen[value] = true;
+                    result += ch;
+
+                    // Every possible byte is already in result
+                    if (++seenCount == 256)
+                    {
+                        break;
+                    }
                 }
             }
 
@@ -338,61 +458,30 @@ namespace UtilityLib
         }
         std::vector<std::string> DivideToWords(const std::string& str)
         {
-            std::string word;
             std::vector<std::string> wordList;
-            size_t strSize = str.size();
-            size_t start = 0;
-
-            for (size_t i = 0; i < strSize; i++)
-            {
-                bool isLetter = ((str[i] >= 'a') &&
-                    (str[i] <= 'z')) ||
-                    ((str[i] >= 'A') &&
-                        (str[i] <= 'Z'));
-
-                bool isNumber = (str[i] >= '0') &&
-                    (str[i] <= '9');
-
-                // If the char is not a letter, number and "'"
-                if ((isLetter == false) &&
-                    (isNumber == false) &&
-                    (str[i] != '\''))
-                {
-                    word = str.substr(start, i - start);
-                    start = i;
-
-                    // Only save the word if it is not a punctiation
-                    if (word != "." && word != "," && word != ":" && word != ";" && word != "!" && word != "?")
-                    {
-                        wordList.push_back(word);
-                    }
-                }
-            }
-
-            // Save the last word if it is not punctiation
-            word = str.substr(start, strSize - start);
-            if (word != "." && word != "," && word != ":" && word != ";" && word != "!" && word != "?")
+            for (std::string_view word : WordViewCls(str))
             {
-                wordList.push_back(word);
+                wordList.emplace_back(word);
             }
-
             return wordList;
         }
         std::string RemoveDuplicateWords(const std::string& str)
         {
-            std::string result = "";
-            std::vector<std::string> wordList = DivideToWords(str);
+            std::vector<std::string_view> wordList = GetUniqueWords(str);
+
+            StringBuilderCls builder;
+            builder.Reserve(wordList.size() * 2);
 
             for (size_t i = 0; i < wordList.size(); i++)
             {
-                size_t index = result.find(wordList.at(i));
-                if (index == std::string::npos)
+                if (i != 0)
                 {
-                    result += wordList.at(i);
+                    builder.Append(' ');
                 }
+                builder.Append(wordList[i]);
             }
 
-            return result;
+            return builder.ToString();
         }
         std::vector<std::string> DivideByLength(const std::string& str, size_t partLen)
         {
@@ -420,34 +509,7 @@ namespace UtilityLib
         }
         std::string EncodeBase64(const std::string& in)
         {
-            static const std::string BASE64_CHARS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdef\
-                                                     ghijklmnopqrstuvwxyz0123456789+/";
-            std::string out;
-            int val = 0;
-            int valb = -6;
-
-            for (unsigned char c : in)
-            {
-                val = (val << 8) + c;
-                valb += 8;
-                while (valb >= 0)
-                {
-                    out.push_back(BASE64_CHARS[(val >> valb) & 0x3F]);
-                    valb -= 6;
-                }
-            }
-
-            if (valb > -6)
-            {
-                out.push_back(BASE64_CHARS[((val << 8) >> (valb + 8)) & 0x3F]);
-            }
-
-            while (out.size() % 4)
-            {
-                out.push_back('=');
-            }
-
-            return out;
+            return EncodeBase64(std::string_view(in), Base64Alphabet::Standard);
         }
         bool IsIntegral(const std::string& str)
         {
@@ -460,41 +522,25 @@ namespace UtilityLib
             }
             return false;
         }
-        bool ValidateIpAddress(const std::string& ipAddress)
+        std::string FloatingToString(float val)
         {
-            std::vector<std::string> ipParts = Divide(ipAddress, '.');
-            if (ipParts.size() != 4)
-            {
-                return false;
-            }
-
-            for (const auto& part : ipParts)
-            {
-                uint32_t ipPart = 0;
-                StringError result = StringToIntegral<uint32_t>(part, ipPart);
-
-                if (result != StringError::Success) return false;
-                if (ipPart > 255) return false;
-            }
-
-            return true;
+            char buffer[MAX_FLOATING_CHARS];
+            return std::string(buffer, FormatFloating(val, buffer));
         }
-        bool ValidatePort(const std::string& port)
+        std::string FloatingToString(double val)
         {
-            constexpr uint32_t MAX_PORT = 0xFFFF;
-            uint32_t portNum = 0;
-            StringError result = StringToIntegral<uint32_t>(port, portNum);
-
-            if (result != StringError::Success)
-            {
-                return false;
-            }
-            if (portNum > MAX_PORT)
-            {
-                return false;
-            }
-
-            return true;
+            char buffer[MAX_FLOATING_CHARS];
+            return std::string(buffer, FormatFloating(val, buffer));
+        }
+        bool ValidateIpAddress(std::string_view ipAddress)
+        {
+            IpAddressCls address;
+            return IpAddressCls::ParseV4(ipAddress, address) == StringError::Success;
+        }
+        bool ValidatePort(std::string_view port)
+        {
+            uint16_t portNum = 0;
+            return ParsePort(port, portNum) == StringError::Success;
         }
         std::string UtilityLib::String::Reverse(const std::string& str)
         {
@@ -0,0 +1,195 @@
+#include "StringPoolCls.h"
+
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <mutex>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        StringPoolCls::ShardStc::ShardStc() :
+            Count(0)
+        {
+            for (std::atomic<EntryStc*>& segment : SegmentList)
+            {
+                segment.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        uint64_t StringPoolCls::Hash(std::string_view str)
+        {
+            // std::hash is not required to mix its high bits well, they pick the shard
+            return static_cast<uint64_t>(std::hash<std::string_view>{}(str)) * 0x9E3779B97F4A7C15ull;
+        }
+
+        StringPoolCls::EntryStc& StringPoolCls::GetEntry(const ShardStc& shard, size_t index)
+        {
+            // Segment k holds FIRST_SEGMENT_SIZE << k entries
+            size_t segment = std::bit_width(index / FIRST_SEGMENT_SIZE + 1) - 1;
+            size_t offset = index - FIRST_SEGMENT_SIZE * ((size_t{ 1 } << segment) - 1);
+            return shard.SegmentList[segment].load(std::memory_order_acquire)[offset];
+        }
+
+        uint32_t StringPoolCls::FindIndex(const ShardStc& shard, std::string_view str, uint64_t hash)
+        {
+            if (shard.SlotList.empty())
+            {
+                return 0;
+            }
+
+            uint32_t tag = static_cast<uint32_t>(hash);
+            size_t mask = shard.SlotList.size() - 1;
+
+            for (size_t pos = static_cast<size_t>(hash >> SHARD_BITS) & mask;; pos = (pos + 1) & mask)
+            {
+                const SlotStc& slot = shard.SlotList[pos];
+                if (slot.Index == 0)
+                {
+                    return 0;
+                }
+                if (slot.Hash == tag)
+                {
+                    const EntryStc& entry = GetEntry(shard, slot.Index - 1);
+                    if (entry.Size == str.size() && memcmp(entry.Data, str.data(), str.size()) == 0)
+                    {
+                        return slot.Index;
+                    }
+                }
+            }
+        }
+
+        void StringPoolCls::Grow(ShardStc& shard)
+        {
+            std::vector<SlotStc> oldSlotList(shard.SlotList.empty() ? 64 : shard.SlotList.size() * 2);
+            oldSlotList.swap(shard.SlotList);
+
+            size_t mask = shard.SlotList.size() - 1;
+            for (const SlotStc& slot : oldSlotList)
+            {
+                if (slot.Index == 0)
+                {
+                    continue;
+                }
+
+                const EntryStc& entry = GetEntry(shard, slot.Index - 1);
+                uint64_t hash = Hash(std::string_view(entry.Data, entry.Size));
+
+                size_t pos = static_cast<size_t>(hash >> SHARD_BITS) & mask;
+                while (shard.SlotList[pos].Index != 0)
+                {
+                    pos = (pos + 1) & mask;
+                }
+                shard.SlotList[pos] = slot;
+            }
+        }
+
+        StringId StringPoolCls::Intern(std::string_view str)
+        {
+            if (str.size() > UINT32_MAX)
+            {
+                return INVALID_STRING_ID;
+            }
+
+            uint64_t hash = Hash(str);
+            size_t shardIndex = static_cast<size_t>(hash >> (64 - SHARD_BITS));
+            ShardStc& shard = ShardList[shardIndex];
+
+            {
+                std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+                uint32_t index = FindIndex(shard, str, hash);
+                if (index != 0)
+                {
+                    return static_cast<StringId>(((index - 1) << SHARD_BITS) | shardIndex);
+                }
+            }
+
+            std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+
+            // Another thread may have added it between the two locks
+            uint32_t index = FindIndex(shard, str, hash);
+            if (index != 0)
+            {
+                return static_cast<StringId>(((index - 1) << SHARD_BITS) | shardIndex);
+            }
+
+            // Last id of the last shard would be INVALID_STRING_ID
+            if (shard.Count == MAX_SHARD_ENTRIES - 1)
+            {
+                return INVALID_STRING_ID;
+            }
+
+            if ((shard.Count + 1) * 4 > shard.SlotList.size() * 3)
+            {
+                Grow(shard);
+            }
+
+            size_t entryIndex = shard.Count;
+            size_t segment = std::bit_width(entryIndex / FIRST_SEGMENT_SIZE + 1) - 1;
+            if (shard.SegmentList[segment].load(std::memory_order_relaxed) == nullptr)
+            {
+                size_t segmentSize = FIRST_SEGMENT_SIZE << segment;
+                void* memory = shard.Arena.allocate(segmentSize * sizeof(EntryStc), alignof(EntryStc));
+                shard.SegmentList[segment].store(static_cast<EntryStc*>(memory), std::memory_order_release);
+            }
+
+            char* data = static_cast<char*>(shard.Arena.allocate(str.size() + 1, 1));
+            memcpy(data, str.data(), str.size());
+            data[str.size()] = '\0';
+
+            EntryStc& entry = GetEntry(shard, entryIndex);
+            entry.Data = data;
+            entry.Size = static_cast<uint32_t>(str.size());
+
+            size_t mask = shard.SlotList.size() - 1;
+            size_t pos = static_cast<size_t>(hash >> SHARD_BITS) & mask;
+            while (shard.SlotList[pos].Index != 0)
+            {
+                pos = (pos + 1) & mask;
+            }
+            shard.SlotList[pos] = { static_cast<uint32_t>(hash), static_cast<uint32_t>(entryIndex + 1) };
+            shard.Count++;
+
+            return static_cast<StringId>((entryIndex << SHARD_BITS) | shardIndex);
+        }
+
+        StringId StringPoolCls::Find(std::string_view str) const
+        {
+            if (str.size() > UINT32_MAX)
+            {
+                return INVALID_STRING_ID;
+            }
+
+            uint64_t hash = Hash(str);
+            size_t shardIndex = static_cast<size_t>(hash >> (64 - SHARD_BITS));
+            const ShardStc& shard = ShardList[shardIndex];
+
+            std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+            uint32_t index = FindIndex(shard, str, hash);
+            if (index == 0)
+            {
+                return INVALID_STRING_ID;
+            }
+            return static_cast<StringId>(((index - 1) << SHARD_BITS) | shardIndex);
+        }
+
+        std::string_view StringPoolCls::GetView(StringId id) const
+        {
+            const ShardStc& shard = ShardList[id & (SHARD_COUNT - 1)];
+            const EntryStc& entry = GetEntry(shard, id >> SHARD_BITS);
+            return std::string_view(entry.Data, entry.Size);
+        }
+
+        size_t StringPoolCls::GetCount() const
+        {
+            size_t count = 0;
+            for (const ShardStc& shard : ShardList)
+            {
+                std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+                count += shard.Count;
+            }
+            return count;
+        }
+    }
+}
@@ -0,0 +1,373 @@
+#include "TextPipelineCls.h"
+#include "CasePkg.h"
+#include "ScanPkg.h"
+
+#include <algorithm>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        // Trim stages only remove ' ' characters, same as LeftTrim() and RightTrim()
+        static constexpr ByteSetCls TRIM_CHARS = ByteSetCls(" ");
+        static constexpr char SPACES[] = "                                                                ";
+        static constexpr size_t SPACES_SIZE = sizeof(SPACES) - 1;
+
+        TextPipelineCls::TextPipelineCls()
+        {
+        }
+        TextPipelineCls::TextPipelineCls(StageType type)
+        {
+            StageList.push_back({ type, SearcherCls(), std::string(), KeywordMatcherCls(), std::vector<std::string>(), 0 });
+        }
+
+        TextPipelineCls TextPipelineCls::operator|(const TextPipelineCls& next) const
+        {
+            TextPipelineCls pipeline(*this);
+            pipeline.StageList.insert(pipeline.StageList.end(), next.StageList.begin(), next.StageList.end());
+            return pipeline;
+        }
+
+        std::string TextPipelineCls::Apply(std::string_view str) const
+        {
+            std::string result;
+            result.reserve(str.size());
+
+            TextStreamCls stream(*this);
+            stream.Update(str, result);
+            stream.Finish(result);
+            return result;
+        }
+        std::string TextPipelineCls::Apply(std::istream& stream) const
+        {
+            std::string result;
+            std::string block(BLOCK_SIZE, '\0');
+            TextStreamCls textStream(*this);
+
+            while (stream.read(block.data(), static_cast<std::streamsize>(block.size())) || stream.gcount() > 0)
+            {
+                textStream.Update(std::string_view(block.data(), static_cast<size_t>(stream.gcount())), result);
+            }
+            textStream.Finish(result);
+            return result;
+        }
+
+        size_t TextPipelineCls::GetStageCount() const
+        {
+            return StageList.size();
+        }
+
+        TextStreamCls::TextStreamCls(const TextPipelineCls& pipeline) :
+            Pipeline(pipeline),
+            StateList(pipeline.StageList.size()),
+            Out(nullptr)
+        {
+            for (StageStateStc& state : StateList)
+            {
+                state.IsStarted = false;
+                state.PendingSpaces = 0;
+            }
+        }
+
+        void TextStreamCls::Update(std::string_view chunk, std::string& out)
+        {
+            Out = &out;
+            for (size_t i = 0; i < chunk.size(); i += TextPipelineCls::BLOCK_SIZE)
+            {
+                Push(0, chunk.substr(i, TextPipelineCls::BLOCK_SIZE));
+            }
+            Out = nullptr;
+        }
+        void TextStreamCls::Finish(std::string& out)
+        {
+            Out = &out;
+            Flush(0);
+            Out = nullptr;
+        }
+
+        // Every stage passes its output to the next one, the last one appends to the output string
+        void TextStreamCls::Push(size_t index, std::string_view piece)
+        {
+            if (piece.empty())
+            {
+                return;
+            }
+            if (index == StateList.size())
+            {
+                Out->append(piece);
+                return;
+            }
+
+            switch (Pipeline.StageList[index].Type)
+            {
+            case TextPipelineCls::StageType::LeftTrim:
+            case TextPipelineCls::StageType::RightTrim:
+            case TextPipelineCls::StageType::Trim:
+                PushTrim(index, piece);
+                break;
+            case TextPipelineCls::StageType::ToLower:
+            case TextPipelineCls::StageType::ToUpper:
+                PushCase(index, piece);
+                break;
+            case TextPipelineCls::StageType::ReplaceAll:
+            case TextPipelineCls::StageType::ReplaceMany:
+                PushReplace(index, piece);
+                break;
+            }
+        }
+
+        void TextStreamCls::PushSpaces(size_t index, size_t count)
+        {
+            while (count != 0)
+            {
+                size_t size = std::min(count, SPACES_SIZE);
+                Push(index, std::string_view(SPACES, size));
+                count -= size;
+            }
+        }
+
+        void TextStreamCls::PushTrim(size_t index, std::string_view piece)
+        {
+            TextPipelineCls::StageType type = Pipeline.StageList[index].Type;
+            StageStateStc& state = StateList[index];
+            const char* first = piece.data();
+            const char* last = first + piece.size();
+
+            if (type != TextPipelineCls::StageType::RightTrim && state.IsStarted == false)
+            {
+                first = FindFirstNotOf(first, last, TRIM_CHARS);
+                if (first == last)
+                {
+                    return;
+                }
+                state.IsStarted = true;
+            }
+            if (type == TextPipelineCls::StageType::LeftTrim)
+            {
+                Push(index + 1, std::string_view(first, static_cast<size_t>(last - first)));
+                return;
+            }
+
+            // Spaces at the end are only written once something else follows them
+            const char* nonSpace = FindLastNotOf(first, last, TRIM_CHARS);
+            if (nonSpace == last)
+            {
+                state.PendingSpaces += static_cast<size_t>(last - first);
+                return;
+            }
+
+            PushSpaces(index + 1, state.PendingSpaces);
+            Push(index + 1, std::string_view(first, static_cast<size_t>(nonSpace + 1 - first)));
+            state.PendingSpaces = static_cast<size_t>(last - nonSpace - 1);
+        }
+
+        void TextStreamCls::PushCase(size_t index, std::string_view piece)
+        {
+            bool isLower = Pipeline.StageList[index].Type == TextPipelineCls::StageType::ToLower;
+            std::string& scratch = StateList[index].Scratch;
+            size_t scratchSize = std::min(piece.size(), TextPipelineCls::BLOCK_SIZE);
+            if (scratch.size() < scratchSize)
+            {
+                scratch.resize(scratchSize);
+            }
+
+            // Earlier replacement stages can make a piece longer than a block
+            for (size_t i = 0; i < piece.size(); i += scratchSize)
+            {
+                std::string_view part = piece.substr(i, scratchSize);
+                if (isLower)
+                {
+                    ToLowerAscii(part, scratch.data());
+                }
+                else
+                {
+                    ToUpperAscii(part, scratch.data());
+                }
+                Push(index + 1, std::string_view(scratch.data(), part.size()));
+            }
+        }
+
+        // Appends data[0, limit) to "output" with every match that starts before limit replaced
+        // Returns index of the first byte that is not written yet (limit, or the end of a match that crosses limit)
+        size_t TextStreamCls::ReplaceRange(size_t index, std::string_view data, size_t limit, std::string& output)
+        {
+            const TextPipelineCls::StageStc& stage = Pipeline.StageList[index];
+            size_t readIndex = 0;
+
+            if (stage.Type == TextPipelineCls::StageType::ReplaceAll)
+            {
+                size_t patternSize = stage.MaxPatternSize;
+                size_t matchIndex = stage.Searcher.Find(data);
+                while (matchIndex < limit)
+                {
+                    output.append(data, readIndex, matchIndex - readIndex);
+                    output.append(stage.Replacement);
+                    readIndex = matchIndex + patternSize;
+                    matchIndex = stage.Searcher.Find(data, readIndex);
+                }
+            }
+            else
+            {
+                for (const KeywordMatchStc& match : stage.Matcher.FindNonOverlapping(data))
+                {
+                    if (match.Offset >= limit)
+                    {
+                        break;
+                    }
+                    output.append(data, readIndex, match.Offset - readIndex);
+                    output.append(stage.ReplacementList[match.KeywordIndex]);
+                    readIndex = match.Offset + match.Length;
+                }
+            }
+
+            if (readIndex < limit)
+            {
+                output.append(data, readIndex, limit - readIndex);
+                readIndex = limit;
+            }
+            return readIndex;
+        }
+
+        // A match that starts at index i is only certain once i + (longest pattern) bytes are known,
+        // matches are taken from left to right with the longest one first, so nothing before such an index can change either
+        // Replaced text is collected in the scratch buffer and passed on as a single piece,
+        // so the next stages are not called for every small part between two matches
+        void TextStreamCls::PushReplace(size_t index, std::string_view piece)
+        {
+            const TextPipelineCls::StageStc& stage = Pipeline.StageList[index];
+            StageStateStc& state = StateList[index];
+
+            if (stage.MaxPatternSize == 0)
+            {
+                Push(index + 1, piece);
+                return;
+            }
+            const size_t keepSize = stage.MaxPatternSize - 1;
+            state.Scratch.clear();
+
+            // Matches that start in the carried bytes only need the first keepSize bytes of the piece
+            if (state.Carry.empty() == false)
+            {
+                size_t carrySize = state.Carry.size();
+                size_t borrowSize = std::min(piece.size(), keepSize);
+                state.Carry.append(piece.data(), borrowSize);
+
+                std::string_view joined = state.Carry;
+                size_t limit = std::min(carrySize, joined.size() > keepSize ? joined.size() - keepSize : 0);
+                size_t readIndex = ReplaceRange(index, joined, limit, state.Scratch);
+
+                // Piece was too short to decide about every carried byte, it is carried entirely as well
+                if (readIndex < carrySize)
+                {
+                    state.Carry.erase(0, readIndex);
+                    Push(index + 1, state.Scratch);
+                    return;
+                }
+
+                piece.remove_prefix(readIndex - carrySize);
+                state.Carry.clear();
+            }
+
+            size_t limit = piece.size() > keepSize ? piece.size() - keepSize : 0;
+            size_t readIndex = ReplaceRange(index, piece, limit, state.Scratch);
+            state.Carry.assign(piece.substr(readIndex));
+            Push(index + 1, state.Scratch);
+        }
+
+        // End of the input: every stage writes what it kept, then the next one does the same
+        void TextStreamCls::Flush(size_t index)
+        {
+            if (index == StateList.size())
+            {
+                return;
+            }
+
+            StageStateStc& state = StateList[index];
+            if (state.Carry.empty() == false)
+            {
+                state.Scratch.clear();
+                ReplaceRange(index, state.Carry, state.Carry.size(), state.Scratch);
+                state.Carry.clear();
+                Push(index + 1, state.Scratch);
+            }
+            // Trailing spaces are dropped
+            state.PendingSpaces = 0;
+            state.IsStarted = false;
+
+            Flush(index + 1);
+        }
+
+        namespace Pipe
+        {
+            TextPipelineCls LeftTrim()
+            {
+                return TextPipelineCls(TextPipelineCls::StageType::LeftTrim);
+            }
+            TextPipelineCls RightTrim()
+            {
+                return TextPipelineCls(TextPipelineCls::StageType::RightTrim);
+            }
+            TextPipelineCls Trim()
+            {
+                return TextPipelineCls(TextPipelineCls::StageType::Trim);
+            }
+            TextPipelineCls ToLower()
+            {
+                return TextPipelineCls(TextPipelineCls::StageType::ToLower);
+            }
+            TextPipelineCls ToUpper()
+            {
+                return TextPipelineCls(TextPipelineCls::StageType::ToUpper);
+            }
+            TextPipelineCls ReplaceAll(std::string_view srcSubstr, std::string_view dstSubstr)
+            {
+                TextPipelineCls pipeline(TextPipelineCls::StageType::ReplaceAll);
+                TextPipelineCls::StageStc& stage = pipeline.StageList.front();
+                stage.Searcher = SearcherCls(srcSubstr);
+                stage.Replacement = dstSubstr;
+                stage.MaxPatternSize = srcSubstr.size();
+                return pipeline;
+            }
+            TextPipelineCls ReplaceMany(const std::vector<std::pair<std::string, std::string>>& replacementList)
+            {
+                TextPipelineCls pipeline(TextPipelineCls::StageType::ReplaceMany);
+                TextPipelineCls::StageStc& stage = pipeline.StageList.front();
+                std::vector<std::string> keywordList;
+
+                // Empty patterns are ignored, they would match everywhere
+                for (const std::pair<std::string, std::string>& replacement : replacementList)
+                {
+                    if (replacement.first.empty() == false)
+                    {
+                        keywordList.push_back(replacement.first);
+                        stage.ReplacementList.push_back(replacement.second);
+                        stage.MaxPatternSize = std::max(stage.MaxPatternSize, replacement.first.size());
+                    }
+                }
+
+                stage.Matcher = KeywordMatcherCls(keywordList);
+                return pipeline;
+            }
+            TextPipelineCls ReplaceTabsWithSpaces(uint32_t spaceCount)
+            {
+                return ReplaceAll("\t", std::string(spaceCount, ' '));
+            }
+            TextPipelineCls RemoveSubstring(std::string_view substr)
+            {
+                return ReplaceAll(substr, std::string_view());
+            }
+            TextPipelineCls RemoveSubstrings(const std::vector<std::string>& substrList)
+            {
+                std::vector<std::pair<std::string, std::string>> replacementList;
+                replacementList.reserve(substrList.size());
+
+                for (const std::string& substr : substrList)
+                {
+                    replacementList.emplace_back(substr, std::string());
+                }
+
+                return ReplaceMany(replacementList);
+            }
+        }
+    }
+}
@@ -0,0 +1,805 @@
+#include "Utf8Pkg.h"
+#include "CasePkg.h"
+#include "CpuFeaturePkg.h"
+#include "ScanPkg.h"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(UTILITYLIB_X86)
+#include <immintrin.h>
+#endif
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        static constexpr ByteSetCls NON_ASCII_CHARS = ByteSetCls().AddRange('\x80', '\xFF');
+
+        // Returns length of the sequence that starts at data[pos], 0 if it is not valid
+        static size_t DecodeUtf8(const unsigned char* data, size_t size, size_t pos, char32_t& codePoint)
+        {
+            unsigned char lead = data[pos];
+            if (lead < 0x80)
+            {
+                codePoint = lead;
+                return 1;
+            }
+
+            size_t length = 0;
+            char32_t minimum = 0;
+            if ((lead & 0xE0) == 0xC0)
+            {
+                length = 2;
+                minimum = 0x80;
+                codePoint = lead & 0x1F;
+            }
+            else if ((lead & 0xF0) == 0xE0)
+            {
+                length = 3;
+                minimum = 0x800;
+                codePoint = lead & 0x0F;
+            }
+            else if ((lead & 0xF8) == 0xF0)
+            {
+                length = 4;
+                minimum = 0x10000;
+                codePoint = lead & 0x07;
+            }
+            else
+            {
+                return 0;
+            }
+
+            if (size - pos < length)
+            {
+                return 0;
+            }
+            for (size_t i = 1; i < length; i++)
+            {
+                unsigned char next = data[pos + i];
+                if ((next & 0xC0) != 0x80)
+                {
+                    return 0;
+                }
+                codePoint = (codePoint << 6) | (next & 0x3F);
+            }
+
+            if (codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+            {
+                return 0;
+            }
+            return length;
+        }
+
+        // Returns number of bytes written, 1 to 4
+        static size_t EncodeUtf8(char32_t codePoint, char* out)
+        {
+            if (codePoint < 0x80)
+            {
+                out[0] = static_cast<char>(codePoint);
+                return 1;
+            }
+            if (codePoint < 0x800)
+            {
+                out[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+                out[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 2;
+            }
+            if (codePoint < 0x10000)
+            {
+                out[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+                out[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 3;
+            }
+            out[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+            out[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            return 4;
+        }
+
+        // Lowercase of the uppercase letters between U+0080 and U+07FF whose lowercase is also in that range
+        static char32_t ToLowerTwoByteCodePoint(char32_t cp)
+        {
+            // Latin-1 Supplement, U+00D7 is the multiplication sign
+            if (cp >= 0xC0 && cp <= 0xDE && cp != 0xD7) return cp + 0x20;
+
+            // Latin Extended-A, U+0130 is skipped because its lowercase is two code points
+            if ((cp >= 0x100 && cp <= 0x12F) || (cp >= 0x132 && cp <= 0x137) || (cp >= 0x14A && cp <= 0x177)) return cp | 1;
+            if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E)) return (cp & 1) != 0 ? cp + 1 : cp;
+            if (cp == 0x178) return 0xFF;
+
+            // Greek
+            if (cp == 0x386) return 0x3AC;
+            if (cp >= 0x388 && cp <= 0x38A) return cp + 0x25;
+            if (cp == 0x38C) return 0x3CC;
+            if (cp == 0x38E || cp == 0x38F) return cp + 0x3F;
+            if (cp >= 0x391 && cp <= 0x3AB && cp != 0x3A2) return cp + 0x20;
+
+            // Cyrillic
+            if (cp >= 0x400 && cp <= 0x40F) return cp + 0x50;
+            if (cp >= 0x410 && cp <= 0x42F) return cp + 0x20;
+            if ((cp >= 0x460 && cp <= 0x481) || (cp >= 0x48A && cp <= 0x4BF) || (cp >= 0x4D0 && cp <= 0x52F)) return cp | 1;
+            if (cp == 0x4C0) return 0x4CF;
+            if (cp >= 0x4C1 && cp <= 0x4CE) return (cp & 1) != 0 ? cp + 1 : cp;
+
+            return cp;
+        }
+
+        // Scalar kernels
+        // Used on non x86 targets and for tails
+
+        static size_t FindInvalidUtf8Scalar(const char* str, size_t size, size_t pos)
+        {
+            const unsigned char* data = reinterpret_cast<const unsigned char*>(str);
+
+            while (pos < size)
+            {
+                // Skip 8 ASCII bytes at a time
+                if (size - pos >= 8)
+                {
+                    uint64_t block;
+                    memcpy(&block, data + pos, sizeof(block));
+                    if ((block & 0x8080808080808080ull) == 0)
+                    {
+                        pos += 8;
+                        continue;
+                    }
+                }
+
+                char32_t codePoint;
+                size_t length = DecodeUtf8(data, size, pos, codePoint);
+                if (length == 0)
+                {
+                    return pos;
+                }
+                pos += length;
+            }
+
+            return std::string_view::npos;
+        }
+        static size_t FindInvalidUtf8Scalar(const char* str, size_t size)
+        {
+            return FindInvalidUtf8Scalar(str, size, 0);
+        }
+        static size_t CountCodePointsScalar(const char* str, size_t size)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < size; i++)
+            {
+                count += (static_cast<unsigned char>(str[i]) & 0xC0) != 0x80 ? 1 : 0;
+            }
+            return count;
+        }
+        template<typename T>
+        static size_t WidenAsciiScalar(const char* str, size_t size, T* out)
+        {
+            size_t i = 0;
+            for (; i < size && static_cast<unsigned char>(str[i]) < 0x80; i++)
+            {
+                out[i] = static_cast<T>(str[i]);
+            }
+            return i;
+        }
+        static size_t NarrowAsciiScalar(const char16_t* str, size_t size, char* out)
+        {
+            size_t i = 0;
+            for (; i < size && str[i] < 0x80; i++)
+            {
+                out[i] = static_cast<char>(str[i]);
+            }
+            return i;
+        }
+
+        // A SIMD validator found an error in the block that starts at blockStart
+        // The error may belong to a sequence that started up to 3 bytes earlier, so scalar search starts at the
+        // first sequence boundary after blockStart - 3 (everything before the block is already known to be valid)
+        static size_t LocateInvalidUtf8(const char* str, size_t size, size_t blockStart)
+        {
+            size_t pos = blockStart >= 3 ? blockStart - 3 : 0;
+            while (pos < blockStart && (static_cast<unsigned char>(str[pos]) & 0xC0) == 0x80)
+            {
+                pos++;
+            }
+            return FindInvalidUtf8Scalar(str, size, pos);
+        }
+
+#if defined(UTILITYLIB_X86)
+        // Error classes of the lookup algorithm, a byte pair is invalid when all three lookups agree on a class
+        // (Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte")
+        static constexpr uint8_t TOO_SHORT = 1 << 0;      // 11______ 0_______ or 11______ 11______
+        static constexpr uint8_t TOO_LONG = 1 << 1;       // 0_______ 10______
+        static constexpr uint8_t OVERLONG_3 = 1 << 2;     // 11100000 100_____
+        static constexpr uint8_t TOO_LARGE = 1 << 3;      // 11110100 1001____ and above
+        static constexpr uint8_t SURROGATE = 1 << 4;      // 11101101 101_____
+        static constexpr uint8_t OVERLONG_2 = 1 << 5;     // 1100000_ 10______
+        static constexpr uint8_t TOO_LARGE_1000 = 1 << 6; // 11110101 1000____ and above
+        static constexpr uint8_t OVERLONG_4 = 1 << 6;     // 11110000 1000____
+        static constexpr uint8_t TWO_CONTS = 1 << 7;      // 10______ 10______
+        static constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+        // Indexed by the high nibble of the first byte
+        static constexpr uint8_t BYTE_1_HIGH_TABLE[16] =
+        {
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+            TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+            TOO_SHORT | OVERLONG_2,
+            TOO_SHORT,
+            TOO_SHORT | OVERLONG_3 | SURROGATE,
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+        };
+        // Indexed by the low nibble of the first byte
+        static constexpr uint8_t BYTE_1_LOW_TABLE[16] =
+        {
+            CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+            CARRY | OVERLONG_2,
+            CARRY,
+            CARRY,
+            CARRY | TOO_LARGE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000
+        };
+        // Indexed by the high nibble of the second byte
+        static constexpr uint8_t BYTE_2_HIGH_TABLE[16] =
+        {
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+        };
+
+        // SSSE3 kernels
+
+        struct Utf8TablesSsse3Stc
+        {
+            __m128i Byte1High;
+            __m128i Byte1Low;
+            __m128i Byte2High;
+            __m128i IncompleteLimit;
+        };
+
+        UTILITYLIB_TARGET("ssse3")
+        static void PrepareTablesSsse3(Utf8TablesSsse3Stc& tables)
+        {
+            tables.Byte1High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(BYTE_1_HIGH_TABLE));
+            tables.Byte1Low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(BYTE_1_LOW_TABLE));
+            tables.Byte2High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(BYTE_2_HIGH_TABLE));
+
+            // A lead byte in the last 3 positions needs bytes from the next block
+            tables.IncompleteLimit = _mm_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+        }
+        UTILITYLIB_TARGET("ssse3")
+        static __m128i CheckBlockSsse3(__m128i input, __m128i previous, const Utf8TablesSsse3Stc& tables)
+        {
+            const __m128i lowNibble = _mm_set1_epi8(0x0F);
+
+            __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+            __m128i byte1High = _mm_shuffle_epi8(tables.Byte1High, _mm_and_si128(_mm_srli_epi16(prev1, 4), lowNibble));
+            __m128i byte1Low = _mm_shuffle_epi8(tables.Byte1Low, _mm_and_si128(prev1, lowNibble));
+            __m128i byte2High = _mm_shuffle_epi8(tables.Byte2High, _mm_and_si128(_mm_srli_epi16(input, 4), lowNibble));
+            __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+            // Third and fourth bytes of 3 and 4 byte sequences must be continuation bytes, and nothing else may be
+            __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+            __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+            __m128i isThird = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+            __m128i isFourth = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+            __m128i must23 = _mm_and_si128(_mm_or_si128(isThird, isFourth), _mm_set1_epi8(static_cast<char>(0x80)));
+
+            return _mm_xor_si128(must23, special);
+        }
+        UTILITYLIB_TARGET("ssse3")
+        static size_t FindInvalidUtf8Ssse3(const char* str, size_t size)
+        {
+            Utf8TablesSsse3Stc tables;
+            PrepareTablesSsse3(tables);
+
+            __m128i previous = _mm_setzero_si128();
+            __m128i incomplete = _mm_setzero_si128();
+            size_t pos = 0;
+
+            for (; size - pos >= 16; pos += 16)
+            {
+                __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+                __m128i error = incomplete;
+
+                // Pair checks of a non ASCII block also cover a sequence left open by the previous block
+                if (_mm_movemask_epi8(input) != 0)
+                {
+                    error = CheckBlockSsse3(input, previous, tables);
+                    incomplete = _mm_subs_epu8(input, tables.IncompleteLimit);
+                }
+                else
+                {
+                    incomplete = _mm_setzero_si128();
+                }
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xFFFF)
+                {
+                    return LocateInvalidUtf8(str, size, pos);
+                }
+                previous = input;
+            }
+
+            // Tail is padded with zeros, a truncated sequence at the end is then followed by ASCII and reported
+            alignas(16) char buffer[16] = {};
+            memcpy(buffer, str + pos, size - pos);
+            __m128i input = _mm_load_si128(reinterpret_cast<const __m128i*>(buffer));
+            __m128i error = CheckBlockSsse3(input, previous, tables);
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xFFFF)
+            {
+                return LocateInvalidUtf8(str, size, pos);
+            }
+            return std::string_view::npos;
+        }
+
+        // SSE2 kernels
+
+        UTILITYLIB_TARGET("sse2")
+        static size_t CountCodePointsSse2(const char* str, size_t size)
+        {
+            // Continuation bytes are 0x80 - 0xBF, that is -128 to -65 as signed bytes
+            const __m128i limit = _mm_set1_epi8(-65);
+            size_t count = 0;
+            size_t pos = 0;
+
+            for (; size - pos >= 16; pos += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+                count += std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(block, limit))));
+            }
+
+            return count + CountCodePointsScalar(str + pos, size - pos);
+        }
+        UTILITYLIB_TARGET("sse2")
+        static size_t WidenAscii16Sse2(const char* str, size_t size, char16_t* out)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            size_t pos = 0;
+
+            for (; size - pos >= 16; pos += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+                if (_mm_movemask_epi8(block) != 0)
+                {
+                    break;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos), _mm_unpacklo_epi8(block, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos + 8), _mm_unpackhi_epi8(block, zero));
+            }
+
+            return pos + WidenAsciiScalar(str + pos, size - pos, out + pos);
+        }
+        UTILITYLIB_TARGET("sse2")
+        static size_t WidenAscii32Sse2(const char* str, size_t size, char32_t* out)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            size_t pos = 0;
+
+            for (; size - pos >= 16; pos += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+                if (_mm_movemask_epi8(block) != 0)
+                {
+                    break;
+                }
+                __m128i low = _mm_unpacklo_epi8(block, zero);
+                __m128i high = _mm_unpackhi_epi8(block, zero);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos), _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos + 4), _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos + 8), _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos + 12), _mm_unpackhi_epi16(high, zero));
+            }
+
+            return pos + WidenAsciiScalar(str + pos, size - pos, out + pos);
+        }
+        UTILITYLIB_TARGET("sse2")
+        static size_t NarrowAsciiSse2(const char16_t* str, size_t size, char* out)
+        {
+            const __m128i nonAscii = _mm_set1_epi16(static_cast<short>(0xFF80));
+            size_t pos = 0;
+
+            for (; size - pos >= 16; pos += 16)
+            {
+                __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+                __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos + 8));
+                __m128i test = _mm_and_si128(_mm_or_si128(low, high), nonAscii);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(test, _mm_setzero_si128())) != 0xFFFF)
+                {
+                    break;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos), _mm_packus_epi16(low, high));
+            }
+
+            return pos + NarrowAsciiScalar(str + pos, size - pos, out + pos);
+        }
+
+        // AVX2 kernels
+        // Tails go to the scalar kernels, calling a legacy SSE kernel with dirty upper halves stalls on some CPUs
+
+        struct Utf8TablesAvx2Stc
+        {
+            __m256i Byte1High;
+            __m256i Byte1Low;
+            __m256i Byte2High;
+            __m256i IncompleteLimit;
+        };
+
+        UTILITYLIB_TARGET("avx2")
+        static void PrepareTablesAvx2(Utf8TablesAvx2Stc& tables)
+        {
+            // vpshufb looks up each 128 bit lane separately, so tables are repeated in both lanes
+            tables.Byte1High = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(BYTE_1_HIGH_TABLE)));
+            tables.Byte1Low = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(BYTE_1_LOW_TABLE)));
+            tables.Byte2High = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(BYTE_2_HIGH_TABLE)));
+            tables.IncompleteLimit = _mm256_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+        }
+        // Bytes of input shifted by N positions, with the last N bytes of previous shifted in
+        template<int N>
+        UTILITYLIB_TARGET("avx2")
+        static __m256i PreviousAvx2(__m256i input, __m256i previous)
+        {
+            return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static __m256i CheckBlockAvx2(__m256i input, __m256i previous, const Utf8TablesAvx2Stc& tables)
+        {
+            const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+
+            __m256i prev1 = PreviousAvx2<1>(input, previous);
+            __m256i byte1High = _mm256_shuffle_epi8(tables.Byte1High, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), lowNibble));
+            __m256i byte1Low = _mm256_shuffle_epi8(tables.Byte1Low, _mm256_and_si256(prev1, lowNibble));
+            __m256i byte2High = _mm256_shuffle_epi8(tables.Byte2High, _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibble));
+            __m256i special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+            __m256i prev2 = PreviousAvx2<2>(input, previous);
+            __m256i prev3 = PreviousAvx2<3>(input, previous);
+            __m256i isThird = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+            __m256i isFourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+            __m256i must23 = _mm256_and_si256(_mm256_or_si256(isThird, isFourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+
+            return _mm256_xor_si256(must23, special);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static size_t FindInvalidUtf8Avx2(const char* str, size_t size)
+        {
+            Utf8TablesAvx2Stc tables;
+            PrepareTablesAvx2(tables);
+
+            __m256i previous = _mm256_setzero_si256();
+            __m256i incomplete = _mm256_setzero_si256();
+            size_t pos = 0;
+
+            for (; size - pos >= 32; pos += 32)
+            {
+                __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + pos));
+                __m256i error = incomplete;
+
+                // Pair checks of a non ASCII block also cover a sequence left open by the previous block
+                if (_mm256_movemask_epi8(input) != 0)
+                {
+                    error = CheckBlockAvx2(input, previous, tables);
+                    incomplete = _mm256_subs_epu8(input, tables.IncompleteLimit);
+                }
+                else
+                {
+                    incomplete = _mm256_setzero_si256();
+                }
+
+                if (_mm256_testz_si256(error, error) == 0)
+                {
+                    return LocateInvalidUtf8(str, size, pos);
+                }
+                previous = input;
+            }
+
+            alignas(32) char buffer[32] = {};
+            memcpy(buffer, str + pos, size - pos);
+            __m256i input = _mm256_load_si256(reinterpret_cast<const __m256i*>(buffer));
+            __m256i error = CheckBlockAvx2(input, previous, tables);
+
+            if (_mm256_testz_si256(error, error) == 0)
+            {
+                return LocateInvalidUtf8(str, size, pos);
+            }
+            return std::string_view::npos;
+        }
+        UTILITYLIB_TARGET("avx2")
+        static size_t CountCodePointsAvx2(const char* str, size_t size)
+        {
+            const __m256i limit = _mm256_set1_epi8(-65);
+            size_t count = 0;
+            size_t pos = 0;
+
+            for (; size - pos >= 32; pos += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + pos));
+                count += std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(block, limit))));
+            }
+
+            return count + CountCodePointsScalar(str + pos, size - pos);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static size_t WidenAscii16Avx2(const char* str, size_t size, char16_t* out)
+        {
+            size_t pos = 0;
+
+            for (; size - pos >= 32; pos += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + pos));
+                if (_mm256_movemask_epi8(block) != 0)
+                {
+                    break;
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + pos), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(block)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + pos + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(block, 1)));
+            }
+
+            return pos + WidenAsciiScalar(str + pos, size - pos, out + pos);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static size_t WidenAscii32Avx2(const char* str, size_t size, char32_t* out)
+        {
+            size_t pos = 0;
+
+            for (; size - pos >= 16; pos += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+                if (_mm_movemask_epi8(block) != 0)
+                {
+                    break;
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + pos), _mm256_cvtepu8_epi32(block));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + pos + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(block, 8)));
+            }
+
+            return pos + WidenAsciiScalar(str + pos, size - pos, out + pos);
+        }
+        UTILITYLIB_TARGET("avx2")
+        static size_t NarrowAsciiAvx2(const char16_t* str, size_t size, char* out)
+        {
+            const __m256i nonAscii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+            size_t pos = 0;
+
+            for (; size - pos >= 32; pos += 32)
+            {
+                __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + pos));
+                __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + pos + 16));
+                __m256i test = _mm256_and_si256(_mm256_or_si256(low, high), nonAscii);
+                if (_mm256_testz_si256(test, test) == 0)
+                {
+                    break;
+                }
+
+                // vpackuswb packs each 128 bit lane separately, the permute puts the quarters back in order
+                __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + pos), packed);
+            }
+
+            return pos + NarrowAsciiScalar(str + pos, size - pos, out + pos);
+        }
+#endif
+
+        // Kernel table, selected once according to the CPU
+        struct Utf8KernelStc
+        {
+            size_t (*FindInvalid)(const char*, size_t);
+            size_t (*CountCodePoints)(const char*, size_t);
+            size_t (*WidenAscii16)(const char*, size_t, char16_t*);
+            size_t (*WidenAscii32)(const char*, size_t, char32_t*);
+            size_t (*NarrowAscii)(const char16_t*, size_t, char*);
+        };
+
+        static Utf8KernelStc SelectKernels()
+        {
+#if defined(UTILITYLIB_X86)
+            const CpuFeatureStc& features = GetCpuFeatures();
+            if (features.Avx2)
+            {
+                return { FindInvalidUtf8Avx2, CountCodePointsAvx2, WidenAscii16Avx2, WidenAscii32Avx2, NarrowAsciiAvx2 };
+            }
+            if (features.Ssse3)
+            {
+                return { FindInvalidUtf8Ssse3, CountCodePointsSse2, WidenAscii16Sse2, WidenAscii32Sse2, NarrowAsciiSse2 };
+            }
+            if (features.Sse2)
+            {
+                return { FindInvalidUtf8Scalar, CountCodePointsSse2, WidenAscii16Sse2, WidenAscii32Sse2, NarrowAsciiSse2 };
+            }
+#endif
+            return { FindInvalidUtf8Scalar, CountCodePointsScalar, WidenAsciiScalar<char16_t>, WidenAsciiScalar<char32_t>, NarrowAsciiScalar };
+        }
+        static const Utf8KernelStc& GetKernels()
+        {
+            static const Utf8KernelStc kernels = SelectKernels();
+            return kernels;
+        }
+
+        bool ValidateUtf8(std::string_view str)
+        {
+            return GetKernels().FindInvalid(str.data(), str.size()) == std::string_view::npos;
+        }
+        size_t FindInvalidUtf8(std::string_view str)
+        {
+            return GetKernels().FindInvalid(str.data(), str.size());
+        }
+        size_t CountUtf8CodePoints(std::string_view str)
+        {
+            return GetKernels().CountCodePoints(str.data(), str.size());
+        }
+
+        // UTF-8 never takes fewer code units than UTF-16 or UTF-32, so the output is sized to the input first
+        // ASCII runs are widened by the kernel, the rest is decoded one sequence at a time until the next run
+        template<typename T, typename WidenFunction>
+        static StringError DecodeUtf8String(std::string_view str, std::basic_string<T>& out, WidenFunction widen)
+        {
+            const unsigned char* data = reinterpret_cast<const unsigned char*>(str.data());
+            const size_t size = str.size();
+
+            out.resize(size);
+            T* dst = out.data();
+            size_t pos = 0;
+
+            while (pos < size)
+            {
+                size_t count = widen(str.data() + pos, size - pos, dst);
+                pos += count;
+                dst += count;
+
+                // Mixed part, decoded one sequence at a time until the next 16 byte window
+                size_t windowEnd = size - pos > 16 ? pos + 16 : size;
+                while (pos < windowEnd)
+                {
+                    if (data[pos] < 0x80)
+                    {
+                        *dst++ = static_cast<T>(data[pos++]);
+                        continue;
+                    }
+
+                    char32_t codePoint;
+                    size_t length = DecodeUtf8(data, size, pos, codePoint);
+                    if (length == 0)
+                    {
+                        out.clear();
+                        return StringError::InvalidArgument;
+                    }
+                    pos += length;
+
+                    if (sizeof(T) == 2 && codePoint >= 0x10000)
+                    {
+                        codePoint -= 0x10000;
+                        *dst++ = static_cast<T>(0xD800 + (codePoint >> 10));
+                        *dst++ = static_cast<T>(0xDC00 + (codePoint & 0x3FF));
+                    }
+                    else
+                    {
+                        *dst++ = static_cast<T>(codePoint);
+                    }
+                }
+            }
+
+            out.resize(static_cast<size_t>(dst - out.data()));
+            return StringError::Success;
+        }
+
+        StringError Utf8ToUtf16(std::string_view str, std::u16string& out)
+        {
+            return DecodeUtf8String(str, out, GetKernels().WidenAscii16);
+        }
+        StringError Utf8ToUtf32(std::string_view str, std::u32string& out)
+        {
+            return DecodeUtf8String(str, out, GetKernels().WidenAscii32);
+        }
+
+        StringError Utf16ToUtf8(std::u16string_view str, std::string& out)
+        {
+            const size_t size = str.size();
+
+            // A UTF-16 code unit is at most 3 bytes, surrogate pairs are 4 bytes for 2 units
+            out.resize(size * 3);
+            char* dst = out.data();
+            size_t pos = 0;
+
+            while (pos < size)
+            {
+                size_t count = GetKernels().NarrowAscii(str.data() + pos, size - pos, dst);
+                pos += count;
+                dst += count;
+
+                size_t windowEnd = size - pos > 16 ? pos + 16 : size;
+                while (pos < windowEnd)
+                {
+                    char32_t codePoint = str[pos++];
+                    if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+                    {
+                        // Only a high surrogate followed by a low surrogate is valid
+                        if (codePoint > 0xDBFF || pos == size || str[pos] < 0xDC00 || str[pos] > 0xDFFF)
+                        {
+                            out.clear();
+                            return StringError::InvalidArgument;
+                        }
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (str[pos++] - 0xDC00);
+                    }
+                    dst += EncodeUtf8(codePoint, dst);
+                }
+            }
+
+            out.resize(static_cast<size_t>(dst - out.data()));
+            return StringError::Success;
+        }
+        StringError Utf32ToUtf8(std::u32string_view str, std::string& out)
+        {
+            out.resize(str.size() * 4);
+            char* dst = out.data();
+
+            for (char32_t codePoint : str)
+            {
+                if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+                {
+                    out.clear();
+                    return StringError::InvalidArgument;
+                }
+                dst += EncodeUtf8(codePoint, dst);
+            }
+
+            out.resize(static_cast<size_t>(dst - out.data()));
+            return StringError::Success;
+        }
+
+        void ToLowerUtf8(char* first, char* last)
+        {
+            ToLowerAscii(first, last);
+
+            const unsigned char* data = reinterpret_cast<const unsigned char*>(first);
+            const size_t size = static_cast<size_t>(last - first);
+            char* pos = const_cast<char*>(FindFirstOf(first, last, NON_ASCII_CHARS));
+
+            while (pos != last)
+            {
+                char32_t codePoint;
+                size_t offset = static_cast<size_t>(pos - first);
+                size_t length = DecodeUtf8(data, size, offset, codePoint);
+
+                if (length == 0)
+                {
+                    // Invalid byte is left as it is
+                    length = 1;
+                }
+                else if (length == 2)
+                {
+                    EncodeUtf8(ToLowerTwoByteCodePoint(codePoint), pos);
+                }
+
+                pos = const_cast<char*>(FindFirstOf(pos + length, last, NON_ASCII_CHARS));
+            }
+        }
+        void ToLowerUtf8(std::string_view src, char* dst)
+        {
+            if (src.data() != dst && src.empty() == false)
+            {
+                memmove(dst, src.data(), src.size());
+            }
+            ToLowerUtf8(dst, dst + src.size());
+        }
+    }
+}
@@ -0,0 +1,213 @@
+#include "WordViewCls.h"
+
+#include <bit>
+#include <functional>
+
+namespace UtilityLib
+{
+    namespace String
+    {
+        static_assert(std::ranges::view<WordViewCls>);
+        static_assert(std::ranges::forward_range<WordViewCls>);
+
+        // Word count is only an upper bound of distinct words, so the initial hash set of GetUniqueWords() is capped
+        // to stay in cache, it grows when distinct words need more room
+        static constexpr size_t MAX_INITIAL_SLOT_COUNT = size_t{ 1 } << 16;
+
+        WordViewCls::WordViewCls()
+        {
+        }
+        WordViewCls::WordViewCls(std::string_view str, const ByteSetCls& wordChars) :
+            Source(str),
+            WordChars(wordChars)
+        {
+        }
+
+        WordViewCls::Iterator WordViewCls::begin() const
+        {
+            Iterator it;
+            it.Parent = this;
+            it.IsEnd = false;
+            it.Advance();
+            return it;
+        }
+        std::default_sentinel_t WordViewCls::end() const
+        {
+            return std::default_sentinel;
+        }
+
+        // Moves to the next 64 byte block that has a word start or end, returns false at the end of the source
+        bool WordViewCls::Iterator::LoadBlock()
+        {
+            const std::string_view source = Parent->Source;
+
+            while (true)
+            {
+                if (BitmapIndex == BitmapCount)
+                {
+                    size_t start = BitmapStart + BitmapCount * 64;
+                    if (start >= source.size())
+                    {
+                        return false;
+                    }
+
+                    size_t end = source.size() - start > BITMAP_SIZE * 64 ? start + BITMAP_SIZE * 64 : source.size();
+                    BuildSetBitmap(source.data() + start, source.data() + end, Parent->WordChars, Bitmap);
+                    BitmapStart = start;
+                    BitmapCount = (end - start + 63) / 64;
+                    BitmapIndex = 0;
+                }
+
+                // A bit differs from the one before it where a word starts or ends
+                // Bits after the end of the source are clear, so the last word always gets its end
+                uint64_t mask = Bitmap[BitmapIndex];
+                uint64_t transitions = mask ^ ((mask << 1) | Carry);
+                Carry = mask >> 63;
+                BlockStart = BitmapStart + BitmapIndex * 64;
+                BitmapIndex++;
+
+                size_t count = 0;
+                while (transitions != 0)
+                {
+                    TransitionList[count++] = static_cast<uint8_t>(std::countr_zero(transitions));
+                    transitions &= transitions - 1;
+                }
+
+                if (count != 0)
+                {
+                    TransitionIndex = 0;
+                    TransitionCount = count;
+                    return true;
+                }
+            }
+        }
+        void WordViewCls::Iterator::Advance()
+        {
+            if (TransitionIndex == TransitionCount && LoadBlock() == false)
+            {
+                IsEnd = true;
+                return;
+            }
+            size_t start = BlockStart + TransitionList[TransitionIndex++];
+
+            // Source can end right after a word that fills the last block
+            size_t end = Parent->Source.size();
+            if (TransitionIndex != TransitionCount || LoadBlock())
+            {
+                end = BlockStart + TransitionList[TransitionIndex++];
+            }
+
+            Word = Parent->Source.substr(start, end - start);
+        }
+
+        size_t CountWords(std::string_view str, const ByteSetCls& wordChars)
+        {
+            constexpr size_t CHUNK_WORDS = 64;
+            uint64_t bitmap[CHUNK_WORDS];
+
+            const char* first = str.data();
+            const char* last = first + str.size();
+
+            // Every word character that follows a separator (or the start of the string) starts a word
+            size_t count = 0;
+            uint64_t carry = 0;
+            while (first != last)
+            {
+                const char* chunkLast = static_cast<size_t>(last - first) > CHUNK_WORDS * 64 ? first + CHUNK_WORDS * 64 : last;
+                size_t wordCount = (static_cast<size_t>(chunkLast - first) + 63) / 64;
+                BuildSetBitmap(first, chunkLast, wordChars, bitmap);
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    uint64_t mask = bitmap[i];
+                    count += static_cast<size_t>(std::popcount(mask & ~((mask << 1) | carry)));
+                    carry = mask >> 63;
+                }
+
+                first = chunkLast;
+            }
+            return count;
+        }
+
+        std::vector<std::string_view> GetUniqueWords(std::string_view str, const ByteSetCls& wordChars)
+        {
+            // Index is word index + 1, 0 marks an empty slot
+            struct SlotStc
+            {
+                uint32_t Hash;
+                uint32_t Index;
+            };
+
+            std::vector<std::string_view> wordList;
+
+            size_t wordCount = CountWords(str, wordChars);
+            if (wordCount == 0)
+            {
+                return wordList;
+            }
+
+            // Word count is an upper bound of distinct words, keep the set at most half full
+            size_t slotCount = std::bit_ceil(wordCount * 2);
+            if (slotCount > MAX_INITIAL_SLOT_COUNT)
+            {
+                slotCount = MAX_INITIAL_SLOT_COUNT;
+            }
+            std::vector<SlotStc> slotList(slotCount);
+            size_t mask = slotCount - 1;
+
+            std::hash<std::string_view> hasher;
+
+            for (std::string_view word : WordViewCls(str, wordChars))
+            {
+                uint64_t hash = static_cast<uint64_t>(hasher(word));
+                uint32_t tag = static_cast<uint32_t>(hash >> 32);
+                size_t pos = static_cast<size_t>(hash) & mask;
+                bool isNew = true;
+
+                while (slotList[pos].Index != 0)
+                {
+                    const SlotStc& slot = slotList[pos];
+                    if (slot.Hash == tag && wordList[slot.Index - 1] == word)
+                    {
+                        isNew = false;
+                        break;
+                    }
+                    pos = (pos + 1) & mask;
+                }
+
+                if (isNew == false)
+                {
+                    continue;
+                }
+
+                wordList.push_back(word);
+                slotList[pos] = { tag, static_cast<uint32_t>(wordList.size()) };
+
+                // Only reached when the initial size was capped
+                if (wordList.size() * 4 > slotList.size() * 3)
+                {
+                    std::vector<SlotStc> oldSlotList(slotList.size() * 2);
+                    oldSlotList.swap(slotList);
+                    mask = slotList.size() - 1;
+
+                    for (const SlotStc& slot : oldSlotList)
+                    {
+                        if (slot.Index == 0)
+                        {
+                            continue;
+                        }
+
+                        size_t newPos = static_cast<size_t>(hasher(wordList[slot.Index - 1])) & mask;
+                        while (slotList[newPos].Index != 0)
+                        {
+                            newPos = (newPos + 1) & mask;
+                        }
+                        slotList[newPos] = slot;
+                    }
+                }
+            }
+
+            return wordList;
+        }
+    }
+}
@@ -38,8 +38,8 @@ namespace UtilityLib
             static std::variant<TftpError, TftpServerCls> Initialize(const std::string& directoryPath);
 
             void HandleClients();
-            void HandleReadRequest(RrqWrqPacketStc packet, std::string ipAddress, std::string port);
-            void HandleWriteRequest(RrqWrqPacketStc packet, std::string ipAddress, std::string port);
+            void HandleReadRequest(RrqWrqPacketStc packet, UtilityLib::Socket::EndpointCls client);
+            void HandleWriteRequest(RrqWrqPacketStc packet, UtilityLib::Socket::EndpointCls client);
         };
     }
 }
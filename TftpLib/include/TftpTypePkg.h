@@ -1,8 +1,9 @@
 #ifndef TFTPYPEPKG_H
 #define TFTPYPEPKG_H
 
-#include <map>
+#include <array>
 #include <string>
+#include <string_view>
 
 namespace UtilityLib
 {
@@ -81,22 +82,56 @@ namespace UtilityLib
         const size_t MIN_PACKET_SIZE = ACK_PACKET_SIZE;
         const size_t MAX_DATA_SIZE = 512;
         const size_t MAX_PACKET_SIZE = OPCODE_SIZE + BLOCK_SIZE + MAX_DATA_SIZE;
-        const std::map<TftpError, std::string> ERROR_MESSAGES({ { TftpError::NotDefined, "Unknown request" },
-                                                                { TftpError::FileNotFound, "File does not exist" },
-                                                                { TftpError::AccessViolation, "Access not permitted" },
-                                                                { TftpError::DiskFullAllocationExceeded, "Disk full or allocation exceeded" },
-                                                                { TftpError::IllegalTftpOperation, "TFTP Operation is illegal" },
-                                                                { TftpError::UnknownTransferId, "Unknown transfer ID" },
-                                                                { TftpError::FileAlreadyExists, "File already exists" },
-                                                                { TftpError::NoSuchUser, "Specified user does not exist" },
-                                                                { TftpError::UnknownErrorCode, "TFTP server returned an unknown error code" },
-                                                                { TftpError::WinsockError, "Network not available" },
-                                                                { TftpError::CannotSaveReadFileToDisk, "Can not write to the provided path" },
-                                                                { TftpError::UndefinedResponse, "TFTP Server returned an unknown message" },
-                                                                { TftpError::FileAtSpecifiedPathNotFound, "File does not exist at the specified path" } });
-        const std::map<Mode, std::string> MODE_MAPPING({ { Mode::NetAscii, "netascii" },
-                                                         { Mode::Octet, "octet" },
-                                                         { Mode::Mail, "mail" } });
+        // Indexed by TftpError, tables are constant initialized so they cost nothing at startup
+        inline constexpr std::array<std::string_view, static_cast<size_t>(TftpError::Success) + 1> ERROR_MESSAGES = {
+            "Unknown request",                                // NotDefined
+            "File does not exist",                            // FileNotFound
+            "Access not permitted",                           // AccessViolation
+            "Disk full or allocation exceeded",               // DiskFullAllocationExceeded
+            "TFTP Operation is illegal",                      // IllegalTftpOperation
+            "Unknown transfer ID",                            // UnknownTransferId
+            "File already exists",                            // FileAlreadyExists
+            "Specified user does not exist",                  // NoSuchUser
+            "TFTP server returned an unknown error code",     // UnknownErrorCode
+            "Network not available",                          // WinsockError
+            "IP address is not valid",                        // InvalidIpAddress
+            "Can not write to the provided path",             // CannotSaveReadFileToDisk
+            "TFTP Server returned an unknown message",        // UndefinedResponse
+            "File does not exist at the specified path",      // FileAtSpecifiedPathNotFound
+            ""                                                // Success
+        };
+        // Indexed by Mode
+        inline constexpr std::array<std::string_view, 3> MODE_MAPPING = { "netascii", "octet", "mail" };
+        inline constexpr size_t MAX_MODE_NAME_SIZE = 8;
+
+        // GetErrorMessage()
+        //
+        // Summary:
+        // Returns the message of an error code
+        //
+        // Arguments:
+        // TftpError error  --- In
+        //
+        // Returns:
+        // std::string_view
+        constexpr std::string_view GetErrorMessage(TftpError error)
+        {
+            return ERROR_MESSAGES.at(static_cast<size_t>(error));
+        }
+        // GetModeName()
+        //
+        // Summary:
+        // Returns the name of a transfer mode as it is written in RRQ and WRQ packets
+        //
+        // Arguments:
+        // Mode mode  --- In (Mode::Invalid throws std::out_of_range)
+        //
+        // Returns:
+        // std::string_view
+        constexpr std::string_view GetModeName(Mode mode)
+        {
+            return MODE_MAPPING.at(static_cast<size_t>(mode));
+        }
     }
 }
 
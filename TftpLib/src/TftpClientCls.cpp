@@ -74,7 +74,7 @@ namespace UtilityLib
             size_t recvBytes = MAX_PACKET_SIZE;
             uint16_t prevBlock = 0;
 
-            std::string fromIpAddr, fromPort;
+            EndpointCls from;
             std::string fileContent;
             std::string dataPacket, ackPacket;
 
@@ -104,7 +104,7 @@ namespace UtilityLib
                 }
                 else [[unlikely]]
                     {
-                        result = UdpClient.RecvFrom(dataPacket, MAX_PACKET_SIZE, recvBytes, fromIpAddr, fromPort);
+                        result = UdpClient.RecvFrom(dataPacket, MAX_PACKET_SIZE, recvBytes, from);
                         if (result != WinsockError::Success)
                         {
                             return TftpError::WinsockError;
@@ -112,7 +112,7 @@ namespace UtilityLib
 
                         // Server will accept initial requests through port 69, then will randomly select a new port to continue file transfer
                         // Change Port to the new port selected by server
-                        UdpClient.SetPort(fromPort);
+                        UdpClient.SetPort(from.GetPort());
                         firstIteration = false;
                     }
 
@@ -163,7 +163,7 @@ namespace UtilityLib
             size_t sentBytes = 0;
             size_t recvBytes = 0;
             std::string ackPacket;
-            std::string fromIpAddr, fromPort;
+            EndpointCls from;
 
             // Read file that will be send
             std::string fullpath = UtilityLib::FileIO::CreateFullPath(filename, pathToFile);
@@ -185,7 +185,7 @@ namespace UtilityLib
             if (result != WinsockError::Success) return TftpError::WinsockError;
 
             // Read response from server
-            result = UdpClient.RecvFrom(ackPacket, MAX_PACKET_SIZE, recvBytes, fromIpAddr, fromPort);
+            result = UdpClient.RecvFrom(ackPacket, MAX_PACKET_SIZE, recvBytes, from);
             auto parsedAckPacket = ParsePacket(ackPacket);
             if (std::holds_alternative<AckPacketStc>(parsedAckPacket) == false) return TftpError::UndefinedResponse;
 
@@ -193,7 +193,7 @@ namespace UtilityLib
             if (ack.Block != 0) return TftpError::UndefinedResponse;
 
             // Change port from 69 to whatever server decided to continue sending
-            UdpClient.SetPort(fromPort);
+            UdpClient.SetPort(from.GetPort());
 
             // Ack received successfully, start to send files
             uint16_t block = 1;
@@ -203,7 +203,7 @@ namespace UtilityLib
                 result = UdpClient.SendTo(dataPacket, dataPacket.size(), sentBytes);
                 if (result != WinsockError::Success) return TftpError::WinsockError;
 
-                result = UdpClient.RecvFrom(ackPacket, ACK_PACKET_SIZE, recvBytes, fromIpAddr, fromPort);
+                result = UdpClient.RecvFrom(ackPacket, ACK_PACKET_SIZE, recvBytes, from);
                 if (result != WinsockError::Success) return TftpError::WinsockError;
 
                 parsedAckPacket = ParsePacket(ackPacket);
@@ -1,4 +1,7 @@
 #include "TftpPacketPkg.h"
+#include "InlineStringCls.h"
+
+#include <array>
 
 namespace UtilityLib
 {
@@ -70,14 +73,14 @@ namespace UtilityLib
         Mode ExtractMode(const std::string& packet)
         {
             size_t firstNullTerminator = packet.find_first_of('\0');
-            std::string mode = UtilityLib::String::ToLower(packet.substr(firstNullTerminator + 1, packet.size() - firstNullTerminator + 1));
+            std::string_view mode = std::string_view(packet).substr(firstNullTerminator + 1);
         
-            size_t findIndex = mode.find("octet");
+            size_t findIndex = UtilityLib::String::FindIgnoreCase(mode, "octet");
             if (findIndex != std::string::npos)
             {
                 return Mode::Octet;
             }
-            findIndex = mode.find("netascii");
+            findIndex = UtilityLib::String::FindIgnoreCase(mode, "netascii");
             if (findIndex != std::string::npos)
             {
                 return Mode::NetAscii;
@@ -90,77 +93,46 @@ namespace UtilityLib
             return Mode::Invalid;
         }
         
-        std::string CreateRrqPacket(const std::string& filename, Mode mode, size_t& packetSize)
+        // "\0<mode>\0", the part of RRQ and WRQ packets after the filename, built at compile time for every mode
+        static constexpr auto REQUEST_SUFFIX_LIST = []()
         {
-            const size_t nullTerminatorCount = 2;
-        
-            std::string modeName = MODE_MAPPING.at(mode);
-            size_t filenameSize = filename.size();
-            size_t modeSize = modeName.size();
-        
-            packetSize = OPCODE_SIZE + filenameSize + modeSize + nullTerminatorCount;
-        
-            std::string packet(packetSize, '\0');
-        
-            // Opcode
-            packet[0] = 0;
-            packet[1] = static_cast<char>(Opcode::ReadRequest);
-        
-            // Filename
-            for (size_t i = 0; i < filenameSize; i++)
+            std::array<UtilityLib::String::InlineStringCls<MAX_MODE_NAME_SIZE + 2>, MODE_MAPPING.size()> suffixList;
+            for (size_t i = 0; i < MODE_MAPPING.size(); i++)
             {
-                packet[i + 2] = filename[i];
+                suffixList[i].push_back('\0');
+                suffixList[i].append(MODE_MAPPING[i]);
+                suffixList[i].push_back('\0');
             }
-        
-            // Null terminator
-            packet[OPCODE_SIZE + filenameSize] = '\0';
-        
-            // Mode
-            for (size_t i = 0; i < modeSize; i++)
-            {
-                packet[OPCODE_SIZE + filenameSize + 1 + i] = modeName[i];
-            }
-        
-            // Null terminator
-            packet[packetSize - 1] = '\0';
-        
+            return suffixList;
+        }();
+
+        static std::string CreateRequestPacket(Opcode opcode, const std::string& filename, Mode mode, size_t& packetSize)
+        {
+            std::string_view suffix = REQUEST_SUFFIX_LIST.at(static_cast<size_t>(mode));
+
+            packetSize = OPCODE_SIZE + filename.size() + suffix.size();
+
+            std::string packet;
+            packet.reserve(packetSize);
+
+            // Opcode
+            packet.push_back('\0');
+            packet.push_back(static_cast<char>(opcode));
+
+            // Filename, then null terminated mode
+            packet.append(filename);
+            packet.append(suffix);
+
             return packet;
         }
+
+        std::string CreateRrqPacket(const std::string& filename, Mode mode, size_t& packetSize)
+        {
+            return CreateRequestPacket(Opcode::ReadRequest, filename, mode, packetSize);
+        }
         std::string CreateWrqPacket(const std::string& filename, Mode mode, size_t& packetSize)
         {
-            const size_t nullTerminatorCount = 2;
-        
-            std::string modeName = MODE_MAPPING.at(mode);
-            size_t filenameSize = filename.size();
-            size_t modeSize = modeName.size();
-        
-            packetSize = OPCODE_SIZE + filenameSize + modeSize + nullTerminatorCount;
-        
-            std::string packet(packetSize, '\0');
-        
-            // Opcode
-            packet[0] = 0;
-            packet[1] = static_cast<char>(Opcode::WriteRequest);
-        
-            // Filename
-            for (size_t i = 0; i < filenameSize; i++)
-            {
-                packet[i + 2] = filename[i];
-            }
-        
-            // Null terminator
-            packet[OPCODE_SIZE + filenameSize] = '\0';
-        
-            // Mode
-            for (size_t i = 0; i < modeSize; i++)
-            {
-                packet[OPCODE_SIZE + filenameSize + 1 + i] = modeName[i];
-            }
-        
-            // Null terminator
-            packet[packetSize - 1] = '\0';
-        
-            return packet;
+            return CreateRequestPacket(Opcode::WriteRequest, filename, mode, packetSize);
         }
         std::string CreateAckPacket(uint16_t block, size_t& packetSize)
         {
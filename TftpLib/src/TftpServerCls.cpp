@@ -61,9 +61,9 @@ namespace UtilityLib
                 std::string buffer;
                 size_t bufferLen = MAX_PACKET_SIZE;
                 size_t recvByteCount = 0;
-                std::string clientIp, clientPort;
+                EndpointCls client;
 
-                WinsockError result = UdpServer.RecvFrom(buffer, bufferLen, recvByteCount, clientIp, clientPort);
+                WinsockError result = UdpServer.RecvFrom(buffer, bufferLen, recvByteCount, client);
 
                 if (result != WinsockError::Success)
                     continue;
@@ -76,12 +76,12 @@ namespace UtilityLib
 
                 if (packet.Opcode == Opcode::ReadRequest)
                 {
-                    std::thread t(&TftpServerCls::HandleReadRequest, this, packet, clientIp, clientPort);
+                    std::thread t(&TftpServerCls::HandleReadRequest, this, packet, client);
                     t.detach();
                 }
                 else if (packet.Opcode == Opcode::WriteRequest)
                 {
-                    std::thread t(&TftpServerCls::HandleWriteRequest, this, packet, clientIp, clientPort);
+                    std::thread t(&TftpServerCls::HandleWriteRequest, this, packet, client);
                     t.detach();
                 }
                 else
@@ -92,14 +92,14 @@ namespace UtilityLib
                     errMsg += "Invalid TFTP Operation";
 
                     size_t sentByteCount = 0;
-                    UdpServer.SendTo(errMsg, errMsg.size(), sentByteCount, clientIp, clientPort);
+                    UdpServer.SendTo(errMsg, errMsg.size(), sentByteCount, client);
                 }
             }
         }
 
-        void TftpServerCls::HandleReadRequest(RrqWrqPacketStc packet, std::string ipAddress, std::string port)
+        void TftpServerCls::HandleReadRequest(RrqWrqPacketStc packet, EndpointCls client)
         {
-            auto udpServerInit = UdpServerCls::Initialize(port, BlockingMode::Blocking, ipAddress);
+            auto udpServerInit = UdpServerCls::Initialize(client, BlockingMode::Blocking);
             if (std::holds_alternative<WinsockError>(udpServerInit))
                 return;
 
@@ -121,10 +121,10 @@ namespace UtilityLib
             {
                 dataPacket = CreateDataPacket(block, dividedFileContent.at(i), packetSize);
 
-                WinsockError result = udpServer.SendTo(dataPacket, packetSize, sentBytes, ipAddress, port);
+                WinsockError result = udpServer.SendTo(dataPacket, packetSize, sentBytes, client);
                 if (result != WinsockError::Success) break;
 
-                result = udpServer.RecvFrom(ackPacket, MAX_PACKET_SIZE, recvBytes, ipAddress, port);
+                result = udpServer.RecvFrom(ackPacket, MAX_PACKET_SIZE, recvBytes, client);
                 if (result != WinsockError::Success)
                 {
                     if (result == WinsockError::CheckLastWinsockError)
@@ -144,9 +144,9 @@ namespace UtilityLib
             }
         }
 
-        void TftpServerCls::HandleWriteRequest(RrqWrqPacketStc packet, std::string ipAddress, std::string port)
+        void TftpServerCls::HandleWriteRequest(RrqWrqPacketStc packet, EndpointCls client)
         {
-            auto udpServerInit = UdpServerCls::Initialize(port, BlockingMode::Blocking, ipAddress);
+            auto udpServerInit = UdpServerCls::Initialize(client, BlockingMode::Blocking);
             if (std::holds_alternative<WinsockError>(udpServerInit))
                 return;
 
@@ -178,10 +178,10 @@ namespace UtilityLib
             while (recvBlockSize == MAX_PACKET_SIZE)
             {
                 ackPacket = CreateAckPacket(block, packetSize);
-                if (udpServer.SendTo(ackPacket, packetSize, sentByteCount, ipAddress, port) != WinsockError::Success)
+                if (udpServer.SendTo(ackPacket, packetSize, sentByteCount, client) != WinsockError::Success)
                     break;
 
-                if (udpServer.RecvFrom(dataPacket, MAX_PACKET_SIZE, recvByteCount, ipAddress, port) != WinsockError::Success)
+                if (udpServer.RecvFrom(dataPacket, MAX_PACKET_SIZE, recvByteCount, client) != WinsockError::Success)
                     break;
 
                 auto parsedPacket = ParsePacket(dataPacket);